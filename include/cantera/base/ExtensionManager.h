@@ -105,6 +105,14 @@ public:
     //! reaction rate type.
     static string getSolutionWrapperType(const string& userType);
 
+    //! Check whether reaction rate types implemented in an external language have
+    //! been registered. Reactions using such rates may not be constructed
+    //! concurrently.
+    //! @since New in %Cantera 3.1.
+    static bool hasReactionDataLinkers() {
+        return !s_ReactionData_linkers.empty();
+    }
+
 protected:
     //! Functions for wrapping and linking ReactionData objects
     static map<string, function<void(ReactionDataDelegator&)>> s_ReactionData_linkers;
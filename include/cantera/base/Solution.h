@@ -111,6 +111,18 @@ public:
 
     AnyMap parameters(bool withInput=false) const;
 
+    //! Create an independent copy of this Solution object, including its adjacent
+    //! phases and current thermodynamic state.
+    /*!
+     * The copy is created from the serialized phase definition (see YamlWriter),
+     * such that rate multipliers and other settings that are not part of the phase
+     * definition are not copied. Copies are useful for creating objects that
+     * can be used concurrently by multiple threads.
+     *
+     * @since New in %Cantera 3.1.
+     */
+    shared_ptr<Solution> clone();
+
     //! Access input data associated with header definition
     const AnyMap& header() const;
     AnyMap& header();
@@ -39,6 +39,62 @@ private:
     SolutionArray(const SolutionArray& arr, const vector<int>& indices);
 
 public:
+    //! Read-only view of a double-valued SolutionArray component.
+    /*!
+     * A ComponentView provides access to data held by a SolutionArray without
+     * copying. Entry `k` of the view corresponds to entry `k` of the SolutionArray.
+     * Views are invalidated by any operation that resizes the SolutionArray or that
+     * replaces the data of an extra component.
+     * @since New in %Cantera 3.1.
+     */
+    class ComponentView
+    {
+    public:
+        ComponentView() = default;
+
+        /**
+         *  @param data  Pointer to the first entry
+         *  @param stride  Distance between consecutive entries in the data buffer
+         *  @param size  Number of entries
+         *  @param index  Optional locations of entries within the data buffer
+         */
+        ComponentView(const double* data, size_t stride, size_t size,
+                      const int* index=nullptr)
+            : m_data(data), m_stride(stride), m_size(size), m_index(index) {}
+
+        //! Number of entries.
+        size_t size() const {
+            return m_size;
+        }
+
+        //! Distance between consecutive entries in the data buffer.
+        size_t stride() const {
+            return m_stride;
+        }
+
+        //! Pointer to the data buffer. If indices() is `nullptr`, entry `k` is located
+        //! at `data()[k * stride()]`, otherwise at `data()[indices()[k] * stride()]`.
+        const double* data() const {
+            return m_data;
+        }
+
+        //! Locations of entries within the data buffer, if entries cannot be reached
+        //! using a constant stride; `nullptr` otherwise.
+        const int* indices() const {
+            return m_index;
+        }
+
+        double operator[](size_t k) const {
+            return m_data[(m_index ? m_index[k] : k) * m_stride];
+        }
+
+    private:
+        const double* m_data = nullptr;
+        size_t m_stride = 1;
+        size_t m_size = 0;
+        const int* m_index = nullptr;
+    };
+
     virtual ~SolutionArray();
 
     /**
@@ -136,6 +192,15 @@ public:
      */
     AnyValue getComponent(const string& name) const;
 
+    /**
+     *  Retrieve a read-only view of a component of the SolutionArray by name.
+     *  Unlike getComponent(), no data are copied. Views are available for
+     *  components that define the state and for extra components holding arrays of
+     *  type double.
+     *  @since New in %Cantera 3.1.
+     */
+    ComponentView getComponentView(const string& name) const;
+
     /**
      *  Set a component of the SolutionArray by name.
      *  The passed AnyValue should containing an array with length size() with a type
@@ -220,6 +285,9 @@ public:
     /**
      *  Write SolutionArray data to a CSV file.
      *
+     *  Floating point values are written using the shortest representation that
+     *  round-trips exactly; rows of large arrays are formatted in parallel.
+     *
      *  @param fname  Name of CSV file
      *  @param overwrite  Force overwrite if file exists; optional (default=`false`)
      *  @param basis  Output mass (`"Y"`/`"mass"`) or mole (`"X"`/`"mole"`) fractions;
@@ -289,6 +357,51 @@ public:
               const string& desc="", bool overwrite=false, int compression=0,
               const string& basis="");
 
+    /**
+     *  Stream SolutionArray data to a HDF container file.
+     *
+     *  Once streaming is enabled, entries added via append() are buffered in memory
+     *  and written to extendable HDF datasets whenever the number of buffered
+     *  entries reaches *buffer*; after each write, the SolutionArray is emptied.
+     *  This allows for recording long simulations with a bounded memory footprint.
+     *  Remaining entries are written by flush(), closeStream() or upon destruction.
+     *  The resulting file is read using restore().
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier for the subgroup holding the SolutionArray data and
+     *      metadata objects. If omitted (`""`), the subgroup name defaults to `"data"`
+     *  @param desc  Custom comment describing dataset to be stored
+     *  @param buffer  Number of entries held in memory before data are written to
+     *      file; also used as HDF chunk size (default=1000)
+     *  @param overwrite  Force overwrite if file and/or data entry exists; optional
+     *      (default=`false`)
+     *  @param compression  Compression level (0-9); (default=0)
+     *
+     *  @note Metadata are written along with the first block of data; subsequent
+     *      changes of metadata or of the list of extra components are not
+     *      supported.
+     *  @since New in %Cantera 3.1.
+     */
+    void stream(const string& fname, const string& name, const string& sub="",
+                const string& desc="", int buffer=1000, bool overwrite=false,
+                int compression=0);
+
+    //! Write buffered entries to the HDF stream set up by stream() and empty the
+    //! SolutionArray. Has no effect if streaming is not enabled.
+    //! @since New in %Cantera 3.1.
+    void flush();
+
+    //! Flush buffered entries and stop streaming to the HDF container file.
+    //! @since New in %Cantera 3.1.
+    void closeStream();
+
+    //! Number of entries written to the HDF stream set up by stream().
+    //! @since New in %Cantera 3.1.
+    size_t streamedSize() const {
+        return m_streamSize;
+    }
+
     /**
      *  Read header information from a HDF container file.
      *
@@ -305,14 +418,60 @@ public:
      */
     static AnyMap readHeader(const AnyMap& root, const string& name);
 
+    /**
+     *  Restore SolutionArray data from a CSV file.
+     *
+     *  Reads data previously written by writeEntry(const string&, bool, const
+     *  string&). Large files are read in blocks, which are parsed in parallel.
+     *  Columns holding species data are identified by prefixes `X_` or `Y_`; state
+     *  information is restored from temperature, density or pressure and species
+     *  fractions. Remaining columns are restored as extra components, where column
+     *  types are detected from the first data row.
+     *
+     *  @param fname  Name of CSV file
+     *  @since New in %Cantera 3.1.
+     */
+    void readEntry(const string& fname);
+
     /**
      *  Restore SolutionArray data from a HDF container file.
      *
+     *  For one-dimensional data, a contiguous range of entries can be selected; only
+     *  the corresponding hyperslabs are read from file.
+     *
      *  @param fname  Name of HDF container file
      *  @param name  Identifier of group holding header information
      *  @param sub  Name identifier of subgroup holding SolutionArray data
+     *  @param start  First entry to be read (default=0)
+     *  @param count  Maximum number of entries to be read; if omitted (npos), all
+     *      entries following *start* are read
      */
-    void readEntry(const string& fname, const string& name, const string& sub);
+    void readEntry(const string& fname, const string& name, const string& sub,
+                   size_t start=0, size_t count=npos);
+
+    /**
+     *  Read selected components from a HDF container file without restoring the
+     *  SolutionArray.
+     *
+     *  Only the requested datasets (or dataset columns) are read from file, which
+     *  makes this method suitable for extracting a few properties from large files.
+     *  Components are names of stored state properties (for example `"T"` or
+     *  `"pressure"`), names of extra components, or species names; species are read
+     *  from the corresponding column of stored mole or mass fractions.
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier of subgroup holding SolutionArray data
+     *  @param components  Names of components to be read
+     *  @param start  First entry to be read (default=0)
+     *  @param count  Maximum number of entries to be read; if omitted (npos), all
+     *      entries following *start* are read
+     *  @returns  AnyMap holding data for each requested component
+     *  @since New in %Cantera 3.1.
+     */
+    AnyMap readComponents(const string& fname, const string& name, const string& sub,
+                          const vector<string>& components, size_t start=0,
+                          size_t count=npos) const;
 
     /**
      *  Restore SolutionArray data from AnyMap. Used by YAML serialization.
@@ -327,9 +486,10 @@ public:
      *  Restore SolutionArray data and header information from a container file.
      *
      *  This method retrieves data from a YAML or HDF files that were previously saved
-     *  using the save() method.
+     *  using the save() method. CSV files are restored using readEntry(const string&);
+     *  as CSV files do not hold header information, an empty AnyMap is returned.
      *
-     *  @param fname  Name of container file (YAML or HDF)
+     *  @param fname  Name of container file (YAML, HDF or CSV)
      *  @param name  Identifier of location within the container file; this node/group
      *      contains header information and a subgroup holding actual SolutionArray data
      *  @param sub  Name identifier for the subgroup holding the SolutionArray data and
@@ -398,6 +558,13 @@ protected:
 
     bool m_shared = false; //!< `true` if data are shared from another object
     vector<int> m_active; //!< Vector of locations referencing active entries
+
+    string m_streamFile; //!< HDF container file receiving streamed data
+    string m_streamPath; //!< Group within HDF container file holding streamed data
+    size_t m_streamBuffer = 0; //!< Number of buffered entries triggering a flush
+    int m_streamCompression = 0; //!< HDF compression level used for streaming
+    size_t m_streamSize = 0; //!< Number of entries written to HDF stream
+    vector<string> m_streamComponents; //!< Components written to HDF stream
 };
 
 }
@@ -86,6 +86,13 @@ public:
     //! @param meta  AnyMap containing attributes
     void writeAttributes(const string& id, const AnyMap& meta);
 
+    //! Delete an attribute from a specified location; if the attribute does not
+    //! exist, the call has no effect.
+    //! @param id  storage location within file
+    //! @param attr  name of attribute to be deleted
+    //! @since New in %Cantera 3.1.
+    void deleteAttribute(const string& id, const string& attr);
+
     //! Read dataset from a specified location
     //! @param id  storage location within file
     //! @param name  name of vector/matrix entry
@@ -93,12 +100,29 @@ public:
     //! @param cols  number of matrix columns, if applicable; if 0, a vector is
     //!     expected, if npos, the size is detected automatically; otherwise, an exact
     //!     number of columns needs to be matched.
+    //! @param offset  if specified, read the hyperslab of *rows* rows starting at row
+    //!     *offset* rather than the complete dataset (default=npos)
     //! @returns  matrix or vector containing data; implemented for types
     //!     `vector<double>`, `vector<long int>`, `vector<string>`,
     //!     `vector<vector<double>>`, `vector<vector<long int>>` and
     //!     `vector<vector<string>>`
-    AnyValue readData(const string& id,
-                      const string& name, size_t rows, size_t cols=npos) const;
+    AnyValue readData(const string& id, const string& name, size_t rows,
+                      size_t cols=npos, size_t offset=npos) const;
+
+    //! Read selected columns of a floating point matrix from a specified location
+    //!
+    //! Only the requested hyperslabs are read from file, which avoids loading
+    //! complete datasets when few columns are needed.
+    //! @param id  storage location within file
+    //! @param name  name of matrix entry
+    //! @param columns  indices of columns to be read
+    //! @param offset  first row to be read
+    //! @param rows  number of rows to be read
+    //! @returns  vector of columns, where each entry holds *rows* values
+    //! @since New in %Cantera 3.1.
+    vector<vector<double>> readColumns(const string& id, const string& name,
+                                       const vector<size_t>& columns, size_t offset,
+                                       size_t rows) const;
 
     //! Write dataset to a specified location
     //! @param id  storage location within file
@@ -109,6 +133,24 @@ public:
     //!     `vector<vector<string>>`
     void writeData(const string& id, const string& name, const AnyValue& data);
 
+    //! Append dataset to a specified location
+    //!
+    //! If the dataset does not exist, it is created as an extendable (chunked) HDF
+    //! dataset; otherwise, the existing dataset is resized along its first dimension
+    //! and *data* is written to the new rows. Repeated calls thus allow for writing
+    //! large data sets incrementally without holding them in memory.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  vector or matrix containing data; implemented for types
+    //!     `vector<double>`, `vector<long int>`, `vector<vector<double>>` and
+    //!     `vector<vector<long int>>`
+    //! @param chunk  number of rows per HDF chunk; only used when the dataset is
+    //!     created
+    //! @returns  number of rows of the dataset after the append operation
+    //! @since New in %Cantera 3.1.
+    size_t appendData(const string& id, const string& name, const AnyValue& data,
+                      size_t chunk);
+
 private:
 #if CT_USE_HDF5
     //! ensure that HDF group is readable
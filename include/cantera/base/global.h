@@ -96,6 +96,22 @@ void appdelete();
 //! @copydoc Application::thread_complete
 void thread_complete();
 
+//! Evaluate `task(i)` for all indices `i` in `[0, n)` using multiple threads.
+//!
+//! Indices are split into contiguous ranges that are processed concurrently, where
+//! the calling thread processes the first range. Log messages and warnings issued by
+//! other threads are buffered and written by the calling thread after all tasks are
+//! complete, which preserves their order and ensures that loggers installed by
+//! language interfaces are only invoked from the calling thread. Exceptions are
+//! rethrown on the calling thread.
+//!
+//! @param n  Number of tasks
+//! @param task  Function evaluated for each index; tasks must not modify shared data
+//! @param minChunk  Minimum number of tasks per thread; if *n* is less than twice
+//!     this value, all tasks are evaluated sequentially by the calling thread
+//! @since New in %Cantera 3.1.
+void parallelFor(size_t n, const function<void(size_t)>& task, size_t minChunk=1);
+
 //! @defgroup globalSettings  Global Cantera Settings
 //! @brief Functions for accessing global %Cantera settings.
 //! @ingroup globalData
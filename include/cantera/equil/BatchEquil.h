@@ -0,0 +1,111 @@
+/**
+ *  @file BatchEquil.h
+ *  Equilibrium calculations for arrays of thermodynamic states
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BATCHEQUIL_H
+#define CT_BATCHEQUIL_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/AnyMap.h"
+
+namespace Cantera
+{
+
+class SolutionArray;
+
+//! Equilibrate each state of a SolutionArray.
+/*!
+ * States are distributed over a number of threads, where each thread processes
+ * a contiguous range of states using an independent copy of the Solution object
+ * associated with the SolutionArray. Within each thread, the element potential
+ * solver (ChemEquil) is started from the converged solution of the most similar
+ * of the recently solved states (warm start), where similarity is measured by
+ * the relative difference in temperature, the difference in the logarithm of
+ * the pressure and the differences in the elemental mass fractions of the
+ * initial states. For arrays of states that vary smoothly, such as grids of
+ * equivalence ratios and temperatures, this avoids most of the cost of
+ * estimating the starting point for each state. If the warm start fails, the
+ * default starting estimate is used instead.
+ *
+ * With the `auto` solver, states for which the element potential solver fails
+ * are equilibrated using the VCS solver, analogous to ThermoPhase::equilibrate.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup equilGroup
+ */
+class BatchEquil
+{
+public:
+    BatchEquil() = default;
+
+    //! Set the solver. Options are `auto` (the default), `element_potential`,
+    //! `vcs` and `gibbs`; see ThermoPhase::equilibrate. Warm starts are only used
+    //! by the `auto` and `element_potential` solvers.
+    void setSolver(const string& solver);
+
+    //! Set the relative tolerance
+    void setTolerance(double rtol) {
+        m_rtol = rtol;
+    }
+
+    //! Set the maximum number of steps of the solver
+    void setMaxSteps(int maxSteps) {
+        m_maxSteps = maxSteps;
+    }
+
+    //! Set the maximum number of outer temperature or pressure iterations used
+    //! by the `vcs` and `gibbs` solvers
+    void setMaxIterations(int maxIter) {
+        m_maxIter = maxIter;
+    }
+
+    //! Set the maximum number of threads. If zero (the default), the number of
+    //! concurrent threads supported by the hardware is used.
+    void setMaxThreads(size_t n) {
+        m_maxThreads = n;
+    }
+
+    //! Set the number of recently solved states considered when searching for a
+    //! warm start. If zero, warm starts are disabled. The default is 32.
+    void setNeighborWindow(size_t n) {
+        m_window = n;
+    }
+
+    //! Equilibrate all states of *states*, holding the property pair *XY*
+    //! constant.
+    /*!
+     * Returns a new SolutionArray with the same shape, metadata and extra
+     * components as *states*, containing the equilibrium states. The input array
+     * is not modified. If the equilibrium calculation fails for any state, an
+     * exception is thrown.
+     */
+    shared_ptr<SolutionArray> equilibrate(SolutionArray& states, const string& XY);
+
+    //! Statistics for the last call to equilibrate(): the number of states
+    //! (`states`), the number of states solved starting from a warm start
+    //! (`warm_starts`), the number of states solved using the VCS solver after
+    //! the element potential solver failed (`fallbacks`), and the total number of
+    //! element potential solver iterations (`iterations`).
+    AnyMap stats() const;
+
+protected:
+    string m_solver = "auto"; //!< Equilibrium solver
+    double m_rtol = 1e-9; //!< Relative tolerance
+    int m_maxSteps = 50000; //!< Maximum number of solver steps
+    int m_maxIter = 100; //!< Maximum number of outer iterations
+    size_t m_maxThreads = 0; //!< Maximum number of threads
+    size_t m_window = 32; //!< Number of states considered for warm starts
+
+    size_t m_nStates = 0; //!< Number of states in the last call to equilibrate()
+    size_t m_nWarm = 0; //!< Number of successful warm starts
+    size_t m_nFallback = 0; //!< Number of fallbacks to the VCS solver
+    size_t m_nIter = 0; //!< Total number of element potential solver iterations
+};
+
+}
+
+#endif
@@ -120,6 +120,49 @@ public:
     int equilibrate(ThermoPhase& s, const char* XY, vector<double>& elMoles,
                     int loglevel = 0);
 
+    //! Set the starting estimate used by the next call to equilibrate().
+    /*!
+     * The estimate is typically the solution of a previous equilibrium problem
+     * at similar conditions (see lastSolution()). If the solver fails to converge
+     * from this estimate, the calculation is repeated using the default starting
+     * estimate. The estimate is only used once.
+     *
+     * @param x  Dimensionless element potentials @f$ \lambda_m/RT @f$, followed
+     *     by the temperature [K]. Length #m_mm + 1.
+     * @since New in %Cantera 3.1.
+     */
+    void setInitialEstimate(const vector<double>& x);
+
+    //! Solution of the last successful call to equilibrate(), containing the
+    //! dimensionless element potentials @f$ \lambda_m/RT @f$ followed by the
+    //! temperature [K].
+    //! @since New in %Cantera 3.1.
+    const vector<double>& lastSolution() const {
+        return m_lastSolution;
+    }
+
+    //! Set the tolerance for reusing the solution of the previous problem.
+    /*!
+     * If positive, equilibrate(ThermoPhase&, const char*, int) uses the solution
+     * of the previous call as the starting estimate if no estimate has been set
+     * using setInitialEstimate() and the element mole fractions and the logarithm
+     * of the pressure of the new initial state each differ by less than *tol*
+     * from those of the previous initial state. The default is zero, which
+     * disables reuse.
+     *
+     * @since New in %Cantera 3.1.
+     */
+    void setReuseTolerance(double tol) {
+        m_reuseTol = tol;
+    }
+
+    //! Returns `true` if the last successful call to equilibrate() converged
+    //! starting from the estimate set using setInitialEstimate().
+    //! @since New in %Cantera 3.1.
+    bool warmStarted() const {
+        return m_warmStarted;
+    }
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOpt
@@ -127,13 +170,26 @@ public:
     EquilOpt options;
 
 protected:
+    //! Solve the equilibrium problem for the specified element moles.
+    /*!
+     * @param s  phase object to be equilibrated
+     * @param XY  property pair to hold constant
+     * @param elMolesGoal  specified vector of element abundances
+     * @param warmStart  If `true`, start from the estimate set using
+     *     setInitialEstimate() instead of estimating the temperature and element
+     *     potentials.
+     * @param loglevel  Specify amount of debug logging (0 to disable)
+     */
+    int solveEquil(ThermoPhase& s, const char* XY, vector<double>& elMolesGoal,
+                   bool warmStart, int loglevel);
+
     //! Pointer to the ThermoPhase object used to initialize this object.
     /*!
      * This ThermoPhase object must be compatible with the ThermoPhase objects
      * input from the equilibrate function. Currently, this means that the 2
      * ThermoPhases have to have consist of the same species and elements.
      */
-    ThermoPhase* m_phase;
+    ThermoPhase* m_phase = nullptr;
 
     //! number of atoms of element m in species k.
     double nAtoms(size_t k, size_t m) const {
@@ -141,7 +197,9 @@ protected:
     }
 
     /**
-     * Prepare for equilibrium calculations.
+     * Prepare for equilibrium calculations. Work arrays and the last solution
+     * are retained if the object was previously initialized for the same phase
+     * and the elemental composition of the species is unchanged.
      * @param s object representing the solution phase.
      */
     void initialize(ThermoPhase& s);
@@ -162,6 +220,11 @@ protected:
     //! MultiPhaseEquil solver.
     int setInitialMoles(ThermoPhase& s, vector<double>& elMoleGoal, int loglevel = 0);
 
+    //! Choose a set of linearly independent component species for the current
+    //! composition of *s*, and order the elements accordingly.
+    //! @since New in %Cantera 3.1.
+    void updateComponents(ThermoPhase& s, vector<double>& elMolesGoal);
+
     //! Generate a starting estimate for the element potentials.
     int estimateElementPotentials(ThermoPhase& s, vector<double>& lambda,
                                   vector<double>& elMolesGoal, int loglevel = 0);
@@ -248,8 +311,8 @@ protected:
                       vector<double>& eMolesCalc, vector<double>& n_i_calc,
                       double pressureConst);
 
-    size_t m_mm; //!< number of elements in the phase
-    size_t m_kk; //!< number of species in the phase
+    size_t m_mm = 0; //!< number of elements in the phase
+    size_t m_kk = 0; //!< number of species in the phase
     size_t m_skip = npos;
 
     //! This is equal to the rank of the stoichiometric coefficient matrix when
@@ -296,6 +359,22 @@ protected:
     double m_elemFracCutoff = 1e-100;
     bool m_doResPerturb = false;
 
+    //! Starting estimate set using setInitialEstimate()
+    vector<double> m_initialEstimate;
+
+    //! Element potentials and temperature of the last converged solution
+    vector<double> m_lastSolution;
+
+    //! `true` if the last solution started from #m_initialEstimate
+    bool m_warmStarted = false;
+
+    //! Element mole fractions and log pressure of the initial state of the last
+    //! successful call to equilibrate(ThermoPhase&, const char*, int)
+    vector<double> m_lastInput;
+
+    //! Tolerance for reusing #m_lastSolution; see setReuseTolerance()
+    double m_reuseTol = 0.0;
+
     vector<size_t> m_orderVectorElements;
     vector<size_t> m_orderVectorSpecies;
 
@@ -25,6 +25,7 @@
 #include "cantera/equil/vcs_defs.h"
 #include "cantera/equil/vcs_internal.h"
 #include "cantera/base/Array.h"
+#include "cantera/numerics/DenseMatrix.h"
 
 namespace Cantera
 {
@@ -980,6 +981,21 @@ private:
     vector<double> m_aw;
     vector<double> m_wx;
 
+    //! Work matrix for the linear systems formed from the formula vectors of
+    //! the component species in vcs_basopt() and vcs_elcorr(). Kept as a
+    //! member so that repeated basis evaluations do not reallocate it.
+    DenseMatrix m_compMatrix;
+
+    //! Species mole numbers with the interfacial voltage unknowns zeroed out,
+    //! used by vcs_elab() to evaluate the element abundances as a single
+    //! matrix-vector product. Length = #m_nsp.
+    vector<double> m_molNumMasked;
+
+    //! Indices of the component species that currently have zero moles. Filled
+    //! by vcs_deltag() to limit the check for formation reactions which would
+    //! consume a zeroed component.
+    vector<size_t> m_zeroedComponents;
+
 public:
     //! Print level for print routines
     int m_printLvl;
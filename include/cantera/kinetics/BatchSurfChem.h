@@ -0,0 +1,113 @@
+/**
+ *  @file BatchSurfChem.h
+ *  Surface coverage calculations for arrays of gas phase states
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BATCHSURFCHEM_H
+#define CT_BATCHSURFCHEM_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+class SolutionArray;
+
+//! Calculate the surface coverages of an interface in contact with each state of
+//! an array of states of an adjacent phase.
+/*!
+ * This class is intended for models where the surface coverages are needed at a
+ * large number of locations, such as the wall cells of a catalytic channel. For
+ * each state of the adjacent (gas) phase, the coverages are either solved for the
+ * pseudo-steady state (see InterfaceKinetics::solvePseudoSteadyStateProblem) or
+ * advanced in time (see InterfaceKinetics::advanceCoverages). The surface is
+ * evaluated at the temperature and pressure of the gas state.
+ *
+ * States are distributed over a number of threads, where each thread processes a
+ * contiguous range of states using an independent copy of the interface and its
+ * adjacent phases. Each thread keeps its pseudo-steady state solver for all of its
+ * states. Likewise, advance() sets up one ImplicitSurfChem integrator per thread,
+ * which is reinitialized for each state rather than recreated, and otherwise uses
+ * the same settings as InterfaceKinetics::advanceCoverages. Unless initial
+ * coverages are given for each state, the pseudo-steady state solver is started
+ * from the coverages of the previous state handled by the same thread, which is
+ * efficient if neighboring states in the array are similar, for example for
+ * adjacent cells of a computational grid.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup surfSolverGroup
+ */
+class BatchSurfChem
+{
+public:
+    //! Constructor
+    /*!
+     * @param surf  Interface for which coverages are calculated. Its current
+     *     coverages are used as the initial guess for the first state handled by
+     *     each thread.
+     */
+    explicit BatchSurfChem(shared_ptr<Solution> surf);
+
+    //! Set the maximum number of threads. If zero (the default), the number of
+    //! concurrent threads supported by the hardware is used.
+    void setMaxThreads(size_t n) {
+        m_maxThreads = n;
+    }
+
+    //! Set the relative and absolute tolerances used by advance()
+    void setTolerances(double rtol, double atol) {
+        m_rtol = rtol;
+        m_atol = atol;
+    }
+
+    //! Set the maximum number of integrator steps for each state used by
+    //! advance()
+    void setMaxSteps(size_t maxSteps) {
+        m_maxSteps = maxSteps;
+    }
+
+    //! Calculate the pseudo-steady state coverages for each state of *gas*.
+    /*!
+     * @param gas  States of one of the phases adjacent to the interface
+     * @returns a SolutionArray of states of the interface with the same shape and
+     *     metadata as *gas*.
+     */
+    shared_ptr<SolutionArray> solve(SolutionArray& gas);
+
+    //! Calculate the pseudo-steady state coverages for each state of *gas*,
+    //! starting from the coverages of the corresponding state of *initial*.
+    shared_ptr<SolutionArray> solve(SolutionArray& gas, SolutionArray& initial);
+
+    //! Advance the coverages of each state of *initial* by the time *dt* in contact
+    //! with the corresponding state of *gas*.
+    /*!
+     * @param gas  States of one of the phases adjacent to the interface
+     * @param initial  States of the interface with the initial coverages
+     * @param dt  Time interval [s]
+     * @returns a SolutionArray of states of the interface with the same shape and
+     *     metadata as *gas*.
+     */
+    shared_ptr<SolutionArray> advance(SolutionArray& gas, SolutionArray& initial,
+                                      double dt);
+
+protected:
+    //! Calculate coverages for all states of *gas*, where *initial* may be
+    //! `nullptr` and a time interval of zero indicates a pseudo-steady state
+    //! calculation.
+    shared_ptr<SolutionArray> run(SolutionArray& gas, SolutionArray* initial,
+                                  double dt);
+
+    shared_ptr<Solution> m_surf; //!< Interface
+    size_t m_maxThreads = 0; //!< Maximum number of threads
+    double m_rtol = 1e-7; //!< Relative tolerance used by advance()
+    double m_atol = 1e-14; //!< Absolute tolerance used by advance()
+    size_t m_maxSteps = 20000; //!< Maximum number of integrator steps per state
+};
+
+}
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ *  @file BruteForceSensitivity.h
+ *  Sensitivity analysis by perturbation of reaction rate multipliers
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_BRUTEFORCESENSITIVITY_H
+#define CT_BRUTEFORCESENSITIVITY_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+class Solution;
+class SolutionArray;
+
+//! Base class for brute-force sensitivity analysis with respect to reaction rate
+//! multipliers.
+/*!
+ * The model is solved once with the nominal rate multipliers, and once more for
+ * each perturbed reaction, with the multiplier of that reaction increased by the
+ * relative amount @f$ \Delta k @f$ set using setPerturbation(). The normalized
+ * sensitivity of each objective @f$ G @f$ with respect to the rate of reaction
+ * @f$ i @f$ is evaluated as
+ *
+ * @f[
+ *     S_i = \frac{G(k_i (1 + \Delta k)) - G(k_i)}{G(k_i) \Delta k}
+ * @f]
+ *
+ * Perturbed runs are distributed over a number of threads. Each thread uses an
+ * independent copy of the model, created from a copy of the Solution object
+ * passed to the constructor, and solves the unperturbed model before its first
+ * perturbed run. Derived classes may use this solution as the initial state of
+ * each perturbed run (warm start).
+ *
+ * Derived classes implement the model to be solved and the objectives by
+ * overriding newWorker().
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup kineticsmgr
+ */
+class BruteForceSensitivity
+{
+public:
+    //! Create a sensitivity analysis for models based on the Solution *sol*. The
+    //! thermodynamic state of *sol* at the time compute() is called is used as the
+    //! initial state of all model copies.
+    BruteForceSensitivity(shared_ptr<Solution> sol);
+    virtual ~BruteForceSensitivity() = default;
+
+    //! Set the relative perturbation of the rate multipliers. The default is 0.01.
+    void setPerturbation(double dk);
+
+    //! Get the relative perturbation of the rate multipliers
+    double perturbation() const {
+        return m_dk;
+    }
+
+    //! Set the indices of reactions to be perturbed. If empty (the default), all
+    //! reactions are perturbed.
+    void setReactions(const vector<size_t>& reactions) {
+        m_reactions = reactions;
+    }
+
+    //! Get the indices of reactions to be perturbed
+    const vector<size_t>& reactions() const {
+        return m_reactions;
+    }
+
+    //! Set the maximum number of threads. If zero (the default), the number of
+    //! concurrent threads supported by the hardware is used.
+    void setMaxThreads(size_t n) {
+        m_maxThreads = n;
+    }
+
+    //! Get the maximum number of threads
+    size_t maxThreads() const {
+        return m_maxThreads;
+    }
+
+    //! Names of the objectives
+    const vector<string>& objectiveNames() const {
+        return m_names;
+    }
+
+    //! Evaluate sensitivities of all objectives with respect to each perturbed
+    //! reaction.
+    /*!
+     * Returns a SolutionArray with one entry per perturbed reaction, where the
+     * extra components `reaction-index` and `equation` identify the reaction, and
+     * one extra component per objective contains the normalized sensitivities.
+     * Sensitivities for perturbed runs that failed are set to NaN. The metadata
+     * contain the relative perturbation (`perturbation`), the objective values of
+     * the unperturbed model (`base-values`), and the number of failed runs
+     * (`failed-runs`).
+     */
+    shared_ptr<SolutionArray> compute();
+
+    //! Objective values of the unperturbed model from the last call to compute()
+    const vector<double>& baseValues() const {
+        return m_base;
+    }
+
+protected:
+    //! An independent copy of the model, which is used by a single thread.
+    class Worker
+    {
+    public:
+        virtual ~Worker() = default;
+
+        //! The Kinetics object containing the perturbed reactions
+        virtual Kinetics& kinetics() = 0;
+
+        //! Solve the model and evaluate the objectives.
+        /*!
+         * @param warmStart  If `false`, the model is solved starting from its
+         *     initial state, and the solution is retained as the unperturbed
+         *     solution. If `true`, the model is solved starting from the unperturbed
+         *     solution, where supported by the model.
+         * @param[out] values  Values of the objectives
+         */
+        virtual void solve(bool warmStart, vector<double>& values) = 0;
+    };
+
+    //! Create a new copy of the model based on the Solution *sol*, which is an
+    //! independent copy of the Solution passed to the constructor.
+    virtual unique_ptr<Worker> newWorker(shared_ptr<Solution> sol) = 0;
+
+    //! Add an objective named *name*
+    void addObjectiveName(const string& name);
+
+    //! Create an independent copy of the Solution *sol*, including its current
+    //! thermodynamic state and rate multipliers
+    static shared_ptr<Solution> cloneSolution(shared_ptr<Solution> sol);
+
+    shared_ptr<Solution> m_sol; //!< Solution defining the reaction mechanism
+    double m_dk = 0.01; //!< Relative perturbation of rate multipliers
+    vector<size_t> m_reactions; //!< Indices of perturbed reactions
+    size_t m_maxThreads = 0; //!< Maximum number of threads
+    vector<string> m_names; //!< Names of objectives
+    vector<double> m_base; //!< Objective values of the unperturbed model
+};
+
+}
+
+#endif
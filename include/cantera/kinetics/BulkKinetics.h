@@ -47,6 +47,7 @@ public:
     void getFwdRateConstants(double* kfwd) override;
     void getEquilibriumConstants(double* kc) override;
     void getRevRateConstants(double* krev, bool doIrreversible=false) override;
+    void getNetProductionRates(double* wdot) override;
 
     void getDeltaGibbs(double* deltaG) override;
     void getDeltaEnthalpy(double* deltaH) override;
@@ -93,6 +94,67 @@ public:
 
     //! @}
 
+    //! @name Active reaction subsets
+    //!
+    //! The evaluation of rate constants, third-body concentrations, equilibrium
+    //! constants and concentration products can be restricted to a subset of
+    //! active reactions. A reaction is active if it is marked as active by
+    //! setActiveReactions() and it is not skipped automatically based on the
+    //! threshold set by setSkipThreshold(). Inactive reactions are treated as if
+    //! their rate multipliers were zero: their forward rate constants and rates of
+    //! progress are zero.
+    //!
+    //! Reactions deactivated by setActiveReactions() do not contribute to
+    //! derivatives of rate constants, rates of progress or production rates.
+    //! Reactions skipped automatically are evaluated for all derivatives, including
+    //! the analytical Jacobians returned by netRatesOfProgress_ddX() and related
+    //! methods, such that derivatives are consistent with the rates of progress.
+    //! @{
+
+    //! Set the reactions to be evaluated.
+    //! @param active  flags indicating active reactions, with length nReactions();
+    //!     an empty vector marks all reactions as active
+    //! @since New in %Cantera 3.1.
+    void setActiveReactions(const vector<bool>& active);
+
+    //! Flags set by setActiveReactions(); empty if all reactions are marked as
+    //! active.
+    //! @since New in %Cantera 3.1.
+    const vector<bool>& activeReactions() const {
+        return m_userActive;
+    }
+
+    //! Set the concentration threshold used to skip reactions automatically.
+    /*!
+     * Reactions are skipped if both the forward and reverse rates of progress
+     * contain the activity concentration of a species whose magnitude is less than
+     * or equal to the threshold as a factor. A negative value disables automatic
+     * skipping (default).
+     *
+     * With a threshold of zero, only reactions with identically zero rates of
+     * progress are skipped, which leaves rates of progress and production rates
+     * unchanged. Forward rate constants of skipped reactions are reported as zero.
+     *
+     * As derivatives with respect to a species with small or zero concentration
+     * are generally nonzero, skipping is suspended while evaluating derivatives.
+     * Alternating evaluations of rates and derivatives at the same state therefore
+     * require the rate constants of the skipped reactions to be evaluated again.
+     * @since New in %Cantera 3.1.
+     */
+    void setSkipThreshold(double threshold);
+
+    //! Concentration threshold used to skip reactions automatically.
+    //! @since New in %Cantera 3.1.
+    double skipThreshold() const {
+        return m_skipThreshold;
+    }
+
+    //! Number of reactions evaluated at the current state
+    //! @since New in %Cantera 3.1.
+    size_t nActiveReactions();
+
+    //! @}
+
 protected:
     //! @name Internal service methods
     //!
@@ -104,7 +166,8 @@ protected:
     //! Multiply rate with third-body collider concentrations
     void processThirdBodies(double* rop);
 
-    //! Multiply rate with inverse equilibrium constant
+    //! Multiply rate with inverse equilibrium constant. Entries of inactive
+    //! reactions are expected to be zero and are not modified.
     void applyEquilibriumConstants(double* rop);
 
     //! Multiply rate with scaled temperature derivatives of the inverse
@@ -141,6 +204,23 @@ protected:
     Eigen::SparseMatrix<double> calculateCompositionDerivatives(
         StoichManagerN& stoich, const vector<double>& in, bool ddX=true);
 
+    //! Update the set of active reactions from the flags set by the user and the
+    //! current concentrations, and update the rate evaluators if it changed.
+    //! Returns `true` if the set of active reactions changed.
+    bool updateActiveReactions();
+
+    //! Update rates of progress for the evaluation of derivatives, where
+    //! reactions are not skipped automatically
+    void updateDerivativeROP();
+
+    //! Update rates of progress, skipping reactions automatically unless
+    //! #m_skipSuspended is set
+    void updateActiveROP();
+
+    //! Get forward rate constants used for composition derivatives
+    //! (see updateDerivativeROP())
+    void getDerivativeRateConstants(double* kfwd);
+
     //! Helper function ensuring that all rate derivatives can be calculated
     //! @param name  method name used for error output
     //! @throw CanteraError if ideal gas assumption does not hold
@@ -171,6 +251,12 @@ protected:
     //! Physical concentrations, as calculated by ThermoPhase::getConcentrations
     vector<double> m_phys_conc;
 
+    //! Table for the fused evaluation of rates of progress and net production rates
+    FusedStoichManager m_fusedStoich;
+
+    //! Net production rates, evaluated along with the rates of progress
+    vector<double> m_wdot;
+
     //! Derivative settings
     bool m_jac_skip_third_bodies;
     bool m_jac_skip_falloff;
@@ -178,6 +264,30 @@ protected:
 
     bool m_ROP_ok = false;
 
+    //! @name Active reaction subsets
+    //! @{
+
+    vector<bool> m_userActive; //!< Active reactions set by setActiveReactions()
+    double m_skipThreshold = -1.0; //!< Threshold for skipping reactions automatically
+
+    //! Indices of species with nonzero reaction orders in the forward rate
+    //! expression of each reaction
+    vector<vector<size_t>> m_fwdOrderSpecies;
+
+    //! Indices of species with nonzero reaction orders in the reverse rate
+    //! expression of each reaction; empty for irreversible reactions
+    vector<vector<size_t>> m_revOrderSpecies;
+
+    vector<bool> m_active; //!< Reactions evaluated at the current state
+    vector<size_t> m_activeIndex; //!< Indices of reactions evaluated
+    vector<size_t> m_activeRevIndex; //!< Indices of reversible reactions evaluated
+    bool m_activeChanged = true; //!< Indicates whether the active set needs updating
+
+    //! Indicates whether automatic skipping is suspended for derivatives
+    bool m_skipSuspended = false;
+
+    //! @}
+
     //! Buffers for partial rop results with length nReactions()
     vector<double> m_rbuf0;
     vector<double> m_rbuf1;
@@ -11,6 +11,7 @@
 #include "cantera/kinetics/MultiRate.h"
 #include "cantera/base/Array.h"
 #include "cantera/base/global.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -19,6 +20,11 @@ namespace Cantera
 /**
  * The data container `ChebyshevData` holds precalculated data common to
  * all `ChebyshevRate` objects.
+ *
+ * If the rates handled by a Kinetics object are registered using setRates(), the
+ * Chebyshev polynomials of all rates are reduced to polynomials in the reduced
+ * temperature whenever the pressure changes. These one-dimensional polynomials are
+ * then evaluated jointly for all rates at each temperature.
  */
 struct ChebyshevData : public ReactionData
 {
@@ -26,14 +32,14 @@ struct ChebyshevData : public ReactionData
 
     void update(double T) override;
 
-    void update(double T, double P) override {
-        ReactionData::update(T);
-        pressure = P;
-        log10P = std::log10(P);
-    }
+    void update(double T, double P) override;
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
 
+    //! Register the rate objects for joint evaluation
+    //! @since New in %Cantera 3.1.
+    void setRates(const vector<ReactionRate*>& rates);
+
     using ReactionData::update;
 
     //! Perturb pressure of data container
@@ -53,8 +59,29 @@ struct ChebyshevData : public ReactionData
     double pressure = NAN; //!< pressure
     double log10P = 0.0; //!< base 10 logarithm of pressure
 
+    //! Rate constants of the registered rates evaluated at #rateTemperature
+    Eigen::ArrayXd rateCoefficients;
+
+    //! Temperature used to evaluate #rateCoefficients
+    double rateTemperature = NAN;
+
 protected:
     double m_pressure_buf = -1.0; //!< buffered pressure
+
+    //! Chebyshev coefficients of the registered rates for each pressure index, with
+    //! one row per rate and one column per temperature index. Coefficients are
+    //! padded with zeros for rates with fewer temperature or pressure points.
+    vector<Eigen::ArrayXXd> m_coeffs;
+
+    //! Terms appearing in the reduced temperature and pressure of each rate
+    Eigen::ArrayXd m_TrNum, m_TrDen, m_PrNum, m_PrDen;
+
+    //! Coefficients of the polynomials in the reduced temperature at the current
+    //! pressure, with one row for each registered rate
+    Eigen::ArrayXXd m_dotProd;
+
+    //! Pressure used to evaluate #m_dotProd
+    double m_dotProdLog10P = NAN;
 };
 
 //! Pressure-dependent rate expression where the rate coefficient is expressed
@@ -90,6 +117,8 @@ protected:
  */
 class ChebyshevRate final : public ReactionRate
 {
+    friend struct ChebyshevData;
+
 public:
     //! Default constructor.
     ChebyshevRate() = default;
@@ -156,6 +185,11 @@ public:
      *  @param shared_data  data shared by all reactions of a given type
      */
     double evalFromStruct(const ChebyshevData& shared_data) {
+        if (m_dataIndex < static_cast<size_t>(shared_data.rateCoefficients.size())
+            && shared_data.temperature == shared_data.rateTemperature)
+        {
+            return shared_data.rateCoefficients[m_dataIndex];
+        }
         double Tr = (2 * shared_data.recipT + TrNum_) * TrDen_;
         double Cnm1 = Tr;
         double Cn = 1;
@@ -227,6 +261,10 @@ protected:
 
     Array2D m_coeffs; //!<< coefficient array
     vector<double> dotProd_; //!< dot product of coeffs with the reduced pressure polynomial
+
+    //! Index of this rate within ChebyshevData::rateCoefficients, or @ref npos if
+    //! the rate is evaluated individually
+    size_t m_dataIndex = npos;
 };
 
 }
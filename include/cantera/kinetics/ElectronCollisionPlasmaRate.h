@@ -19,6 +19,12 @@ namespace Cantera
 /**
  * The data container `ElectronCollisionPlasmaData` holds precalculated data common to
  * all `ElectronCollisionPlasmaRate` objects.
+ *
+ * The cross sections of all rates handled by a MultiRate object are interpolated to
+ * the electron energy levels of the PlasmaPhase whenever the levels change and are
+ * stored as a matrix with one row per rate (see setRates()). The rate coefficients
+ * of all rates are then obtained from a single matrix-vector product with the
+ * electron energy distribution multiplied by quadrature weights.
  */
 struct ElectronCollisionPlasmaData : public ReactionData
 {
@@ -31,18 +37,48 @@ struct ElectronCollisionPlasmaData : public ReactionData
         ReactionData::invalidateCache();
         energyLevels.resize(0);
         distribution.resize(0);
+        m_dist_number = -1;
+        m_level_number = -1;
     }
 
+    //! Set up the joint evaluation of rate coefficients for a set of rates
+    /*!
+     * @param rates  Rate objects handled by a MultiRate object; objects that are
+     *     not ElectronCollisionPlasmaRate objects are skipped.
+     * @since New in %Cantera 3.1.
+     */
+    void setRates(const vector<ReactionRate*>& rates);
+
     vector<double> energyLevels; //!< electron energy levels
     vector<double> distribution; //!< electron energy distribution
     bool levelChanged;
 
+    //! Rate coefficients [m3/kmol/s] of the rates registered using setRates()
+    vector<double> rateCoefficients;
+
 protected:
+    //! Interpolate the cross sections of all registered rates to #energyLevels and
+    //! update the quadrature weights
+    void updateCrossSections();
+
     //! integer that is incremented when electron energy distribution changes
     int m_dist_number = -1;
 
     //! integer that is incremented when electron energy level changes
     int m_level_number = -1;
+
+    //! Energy levels [eV] of the cross section data of registered rates
+    vector<vector<double>> m_rateEnergyLevels;
+
+    //! Cross sections [m2] of registered rates at #m_rateEnergyLevels
+    vector<vector<double>> m_rateCrossSections;
+
+    //! Cross sections [m2] of registered rates interpolated to #energyLevels, with
+    //! one row per rate
+    Eigen::MatrixXd m_crossSections;
+
+    //! Quadrature weights for integrating over the squared energy levels
+    Eigen::VectorXd m_weights;
 };
 
 
@@ -88,6 +124,8 @@ protected:
  */
 class ElectronCollisionPlasmaRate : public ReactionRate
 {
+    friend struct ElectronCollisionPlasmaData;
+
 public:
     ElectronCollisionPlasmaRate() = default;
 
@@ -144,6 +182,11 @@ private:
 
     //! collision cross sections [m2] after interpolation
     vector<double> m_crossSectionsInterpolated;
+
+    //! Index of the rate coefficient of this rate within
+    //! ElectronCollisionPlasmaData::rateCoefficients, or @ref npos if the rate is
+    //! evaluated individually
+    size_t m_dataIndex = npos;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #include "cantera/kinetics/Arrhenius.h"
 #include "MultiRate.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -16,6 +17,13 @@ class AnyMap;
 /**
  * The data container `FalloffData` holds precalculated data common to
  * all Falloff related reaction rate classes.
+ *
+ * If the rates handled by a Kinetics object are registered using setRates(), the
+ * parameters of the low- and high-pressure limits and of the falloff functions are
+ * stored in contiguous arrays. Whenever the temperature or the third-body
+ * concentrations change, the rate constants of all registered rates are then
+ * evaluated jointly using Eigen array expressions, with one kernel for each of the
+ * Lindemann, Troe, SRI and Tsang parameterizations.
  */
 struct FalloffData : public ReactionData
 {
@@ -29,6 +37,10 @@ struct FalloffData : public ReactionData
 
     using ReactionData::update;
 
+    //! Register the rate objects for joint evaluation
+    //! @since New in %Cantera 3.1.
+    void setRates(const vector<ReactionRate*>& rates);
+
     //! Perturb third-body concentration vector of data container
     /**
      * The method is used for the evaluation of numerical derivatives.
@@ -53,12 +65,46 @@ struct FalloffData : public ReactionData
     double molar_density = NAN; //!< used to determine if updates are needed
     vector<double> conc_3b; //!< vector of effective third-body concentrations
 
+    //! Rate constants of the registered rates evaluated at #rateTemperature
+    Eigen::ArrayXd rateCoefficients;
+
+    //! Temperature used to evaluate #rateCoefficients
+    double rateTemperature = NAN;
+
 protected:
+    //! Evaluate #rateCoefficients for the current temperature and third-body
+    //! concentrations
+    void updateRateCoefficients();
+
     //! integer that is incremented when composition changes
     int m_state_mf_number = -1;
     //! boolean indicating whether 3-rd body values are perturbed
     bool m_perturbed = false;
     vector<double> m_conc_3b_buf; //!< buffered third-body concentrations
+
+    //! Falloff parameterization of the registered rates; one of `Lindemann`,
+    //! `Troe`, `SRI` or `Tsang`, or empty if rates are evaluated individually
+    string m_falloffType;
+
+    //! Indices of the registered rates within #conc_3b
+    vector<size_t> m_rateIndices;
+
+    Eigen::ArrayXd m_lowA; //!< Pre-exponential factors of the low-pressure limits
+    Eigen::ArrayXd m_lowB; //!< Temperature exponents of the low-pressure limits
+    Eigen::ArrayXd m_lowEa_R; //!< Activation energies of the low-pressure limits [K]
+    Eigen::ArrayXd m_highA; //!< Pre-exponential factors of the high-pressure limits
+    Eigen::ArrayXd m_highB; //!< Temperature exponents of the high-pressure limits
+    Eigen::ArrayXd m_highEa_R; //!< Activation energies of the high-pressure limits [K]
+
+    //! Flags (1.0 or 0.0) indicating chemically activated reactions
+    Eigen::ArrayXd m_chemAct;
+
+    //! Parameters of the falloff functions, where each column holds one parameter
+    //! for all registered rates (Troe: @f$ a, 1/T_3, 1/T_1, T_2 @f$;
+    //! SRI: @f$ a, b, c, d, e @f$; Tsang: @f$ A, B @f$)
+    Eigen::ArrayXXd m_falloffParams;
+
+    Eigen::ArrayXd m_conc; //!< Third-body concentrations of the registered rates
 };
 
 
@@ -155,6 +201,11 @@ public:
     //! Evaluate reaction rate
     //! @param shared_data  data shared by all reactions of a given type
     double evalFromStruct(const FalloffData& shared_data) {
+        if (m_dataIndex < static_cast<size_t>(shared_data.rateCoefficients.size())
+            && shared_data.temperature == shared_data.rateTemperature)
+        {
+            return shared_data.rateCoefficients[m_dataIndex];
+        }
         updateTemp(shared_data.temperature, m_work.data());
         m_rc_low = m_lowRate.evalRate(shared_data.logT, shared_data.recipT);
         m_rc_high = m_highRate.evalRate(shared_data.logT, shared_data.recipT);
@@ -229,6 +280,12 @@ protected:
     double m_rc_low = NAN; //!< Evaluated reaction rate in the low-pressure limit
     double m_rc_high = NAN; //!< Evaluated reaction rate in the high-pressure limit
     vector<double> m_work; //!< Work vector
+
+    //! Index of this rate within the arrays of FalloffData, or @ref npos if the
+    //! rate is evaluated individually
+    size_t m_dataIndex = npos;
+
+    friend struct FalloffData;
 };
 
 
@@ -359,6 +416,8 @@ protected:
 
     //! parameter T_2 in the 4-parameter Troe falloff function. [K]
     double m_t2;
+
+    friend struct FalloffData;
 };
 
 //! The SRI falloff function
@@ -462,6 +521,8 @@ protected:
 
     //! parameter d in the 5-parameter SRI falloff function. Dimensionless.
     double m_e;
+
+    friend struct FalloffData;
 };
 
 //! The 1- or 2-parameter Tsang falloff parameterization.
@@ -547,6 +608,8 @@ protected:
 
     //! parameter b in the Tsang F_cent formulation. [K^-1]
     double m_b;
+
+    friend struct FalloffData;
 };
 
 typedef FalloffRate Falloff;
@@ -0,0 +1,96 @@
+/**
+ * @file GeneratedKinetics.h
+ * Bulk kinetics evaluated by code from KineticsCodeGenerator loaded at runtime
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_GENERATEDKINETICS_H
+#define CT_GENERATEDKINETICS_H
+
+#include "BulkKinetics.h"
+
+namespace Cantera
+{
+
+//! Bulk kinetics where the species production rates and their derivatives are
+//! evaluated by mechanism-specific code generated by KineticsCodeGenerator.
+/*!
+ * The generated source needs to be compiled into a shared library, which is loaded
+ * when the object is constructed. The kinetics type remains `bulk`, and the
+ * reacting phase and the reactions are added in the same way as for BulkKinetics.
+ * They need to be identical to those used to generate the code; only the number
+ * of species and reactions is checked when the generated functions are called.
+ * All other properties, for example rates of progress or rate constants, are
+ * evaluated by BulkKinetics.
+ *
+ * The generated code assumes unity rate multipliers, and reactions modified after
+ * the code was generated are not taken into account by getNetProductionRates() and
+ * netProductionRates_ddCi().
+ *
+ * @since New in %Cantera 3.1.
+ * @warning  This class is an experimental part of %Cantera and may be
+ *           changed or removed without notice.
+ * @ingroup kineticsmgr
+ */
+class GeneratedKinetics : public BulkKinetics
+{
+public:
+    //! Constructor
+    //! @param library  Path to the shared library containing the generated code.
+    //!     Platform-specific prefixes and extensions (for example, `lib` and `.so`)
+    //!     are added if the library is not found as given.
+    //! @param prefix  Prefix of the names of the generated functions; see
+    //!     KineticsCodeGenerator::setPrefix()
+    GeneratedKinetics(const string& library, const string& prefix);
+
+    void getNetProductionRates(double* wdot) override;
+
+    //! Calculate derivatives of the species net production rates with respect to
+    //! species concentrations using the analytical derivatives of the generated
+    //! code. Unlike the approximation used by BulkKinetics, the derivatives include
+    //! contributions of third-body colliders and of falloff reactions.
+    Eigen::SparseMatrix<double> netProductionRates_ddCi() override;
+
+    //! Evaluate the generated code at the state given by temperature *T* [K],
+    //! pressure *P* [Pa] and species concentrations *C* [kmol/m^3], independent of
+    //! the state of the reacting phase.
+    //! @param[out] wdot  Net production rates [kmol/m^3/s]. Length: nTotalSpecies().
+    //! @param[out] jac  If not `nullptr`, derivatives of the net production rates
+    //!     with respect to the species concentrations at constant *T* and *P*, where
+    //!     `jac[k * nTotalSpecies() + j]` holds the derivative of the production
+    //!     rate of species *k* with respect to the concentration of species *j*.
+    void evalGenerated(double T, double P, const double* C, double* wdot,
+                       double* jac=nullptr);
+
+protected:
+    //! Check that the reacting phase and reactions match the generated code
+    void checkMechanism(const string& method);
+
+    //! Type of the generated function evaluating the net production rates
+    typedef void (wdot_t)(double, double, const double*, double*);
+
+    //! Type of the generated function evaluating the net production rates and
+    //! their derivatives
+    typedef void (wdot_ddC_t)(double, double, const double*, double*, double*);
+
+    //! Handle keeping the shared library loaded
+    shared_ptr<void> m_library;
+
+    //! Generated function `<prefix>_getNetProductionRates`
+    wdot_t* m_wdot = nullptr;
+
+    //! Generated function `<prefix>_getNetProductionRates_ddC`
+    wdot_ddC_t* m_wdot_ddC = nullptr;
+
+    size_t m_nSpecies = 0; //!< Number of species of the generated code
+    size_t m_nReactions = 0; //!< Number of reactions of the generated code
+
+    vector<double> m_C; //!< Work array for species concentrations
+    vector<double> m_jac; //!< Work array for the dense Jacobian
+};
+
+}
+
+#endif
@@ -82,6 +82,12 @@ public:
      */
     void initialize(double t0=0.0);
 
+    //! Reinitialize the integrator with the current coverages, keeping the solver
+    //! memory allocated by initialize(). Use in combination with integrate0() to
+    //! integrate a sequence of problems of the same size.
+    //! @since New in %Cantera 3.1.
+    void reinitialize(double t0=0.0);
+
     /**
      *  Set the maximum integration step-size.  Note, setting this value to zero
      *  disables this option
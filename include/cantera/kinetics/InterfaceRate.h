@@ -11,6 +11,7 @@
 
 #include "cantera/base/global.h"
 #include "cantera/kinetics/BlowersMaselRate.h"
+#include "cantera/numerics/eigen_sparse.h"
 #include "MultiRate.h"
 
 namespace Cantera
@@ -25,6 +26,11 @@ class AnyMap;
  *
  * The data container inherits from BlowersMaselData, where density is used to
  * hold the site density [kmol/m^2].
+ *
+ * Coverage dependencies of all rates handled by a MultiRate object are evaluated
+ * jointly: parameters are collected in sparse coverage dependency matrices with one
+ * row per coverage-dependent rate (see setRates()), which are multiplied by vectors
+ * of coverages, powers of coverages and logarithms of coverages once per state.
  */
 struct InterfaceData : public BlowersMaselData
 {
@@ -40,6 +46,23 @@ struct InterfaceData : public BlowersMaselData
 
     virtual void perturbTemperature(double deltaT);
 
+    //! Set up the joint evaluation of coverage dependencies for a set of rates
+    /*!
+     * Rows of the coverage dependency matrices are assigned to all rates with
+     * coverage dependencies, which then use the coverage terms calculated by
+     * updateCoverageTerms() instead of evaluating them individually.
+     *
+     * @param rates  Rate objects handled by a MultiRate object; objects not derived
+     *     from InterfaceRateBase are skipped.
+     * @since New in %Cantera 3.1.
+     */
+    void setRates(const vector<ReactionRate*>& rates);
+
+    //! Evaluate the coverage terms of all rates registered using setRates() from
+    //! sparse matrix-vector products.
+    //! @since New in %Cantera 3.1.
+    void updateCoverageTerms();
+
     void resize(size_t nSpecies, size_t nReactions, size_t nPhases) override {
         coverages.resize(nSpecies, 0.);
         logCoverages.resize(nSpecies, 0.);
@@ -57,6 +80,27 @@ struct InterfaceData : public BlowersMaselData
     vector<double> electricPotentials; //!< electric potentials of phases
     vector<double> standardChemPotentials; //!< standard state chemical potentials
     vector<double> standardConcentrations; //!< standard state concentrations
+
+    //! Coverage contributions to the pre-exponential factor of rates registered
+    //! using setRates()
+    vector<double> acov;
+    //! Coverage contributions to the activation energy [K] of rates registered
+    //! using setRates()
+    vector<double> ecov;
+    //! Coverage terms of rates registered using setRates()
+    vector<double> mcov;
+
+protected:
+    //! Exponential coverage dependencies; one column per species
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_covA;
+    //! Activation energy dependencies; columns correspond to the entries of
+    //! #m_covPowers
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_covE;
+    //! Power-law coverage dependencies; one column per species
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_covM;
+    //! First to fourth powers of the coverages of all species, followed by a
+    //! constant entry used for zeroth-order polynomial coefficients
+    vector<double> m_covPowers;
 };
 
 
@@ -91,6 +135,8 @@ struct InterfaceData : public BlowersMaselData
  */
 class InterfaceRateBase
 {
+    friend struct InterfaceData;
+
 public:
     InterfaceRateBase();
 
@@ -252,6 +298,10 @@ protected:
     vector<bool> m_lindep; //!< Vector holding boolean for linear dependence
     vector<double> m_mc; //!< Vector holding coverage-specific power-law exponents
 
+    //! Row of this rate in the coverage dependency matrices of InterfaceData, or
+    //! @ref npos if coverage terms are evaluated individually
+    size_t m_covRow = npos;
+
 private:
     //! Pairs of species index and multipliers to calculate enthalpy change
     vector<pair<size_t, double>> m_stoichCoeffs;
@@ -1116,9 +1116,9 @@ public:
      * @warning  This method is an experimental part of the %Cantera API and
      *      may be changed or removed without notice.
      *
-     * @since New in %Cantera 3.0.
+     * @since New in %Cantera 3.0. Changed to a virtual method in %Cantera 3.1.
      */
-    Eigen::SparseMatrix<double> netProductionRates_ddCi();
+    virtual Eigen::SparseMatrix<double> netProductionRates_ddCi();
 
     /** @} End of Kinetics Derivatives */
     //! @} End of addtogroup derivGroup
@@ -1310,6 +1310,18 @@ public:
      */
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
 
+    /**
+     * Release the input data retained by the reactions of this Kinetics object.
+     * Fields of the reaction definitions which are not needed to reconstruct the
+     * reactions, such as user-defined fields, are discarded, which reduces the memory
+     * used by large mechanisms once setup is complete. The location of each reaction
+     * in the input file is kept for use in error messages. The parsed input file
+     * itself is cached separately; see AnyMap::clearCachedFile().
+     *
+     * @since New in %Cantera 3.1
+     */
+    void clearReactionInput();
+
     /**
      * Return the Reaction object for reaction *i*. Changes to this object do
      * not affect the Kinetics object until the #modifyReaction function is
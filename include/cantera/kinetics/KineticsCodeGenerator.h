@@ -0,0 +1,91 @@
+/**
+ * @file KineticsCodeGenerator.h
+ * Generation of mechanism-specific C++ source code for gas phase kinetics
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_KINETICSCODEGENERATOR_H
+#define CT_KINETICSCODEGENERATOR_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Solution;
+
+//! Generate C++ source code evaluating the species production rates of a fixed
+//! gas phase mechanism.
+/*!
+ * The generated code contains straight-line expressions for each reaction, where
+ * rate parameters, third-body efficiencies and stoichiometric coefficients are
+ * written as literal constants, which allows the compiler to inline and fold all
+ * mechanism-specific data. The source does not depend on %Cantera and only
+ * requires a C++11 compiler. The following functions with C linkage are generated,
+ * where `<prefix>` is set by setPrefix():
+ *
+ * - `int <prefix>_nSpecies()` and `int <prefix>_nReactions()`
+ * - `void <prefix>_getThermo(double T, double* cp_R, double* h_RT, double* s_R)`:
+ *   non-dimensional heat capacities, enthalpies and entropies of the species in
+ *   their reference state
+ * - `void <prefix>_getNetProductionRates(double T, double P, const double* C,
+ *   double* wdot)`: net production rates [kmol/m^3/s] for temperature *T* [K],
+ *   pressure *P* [Pa] and species concentrations *C* [kmol/m^3]
+ * - `void <prefix>_getNetProductionRates_ddC(double T, double P, const double* C,
+ *   double* wdot, double* jac)`: net production rates and their analytical
+ *   derivatives with respect to the species concentrations at constant temperature
+ *   and pressure, where `jac[k * nSpecies + j]` holds the derivative of the
+ *   production rate of species *k* with respect to the concentration of species
+ *   *j*. Derivatives include contributions of third-body colliders and of the
+ *   dependence of falloff rates on the third-body concentration.
+ *
+ * The results correspond to the net production rates of the Kinetics object used
+ * to generate the code, assuming unity rate multipliers. Supported are
+ * `ideal-gas` phases with 7-coefficient NASA polynomials and `gas` kinetics with
+ * Arrhenius, three-body, falloff (Lindemann, Troe, SRI and Tsang), chemically
+ * activated, PLOG and Chebyshev reactions.
+ *
+ * The generated code may be compiled into an application, or into a shared library
+ * that is loaded at runtime by GeneratedKinetics, which replaces the evaluation of
+ * the net production rates and their derivatives by the generated functions. When
+ * compiled into a shared library, the functions are exported unless the macro
+ * `CT_CODEGEN_EXPORT` is already defined.
+ *
+ * @since New in %Cantera 3.1.
+ * @warning  This class is an experimental part of %Cantera and may be
+ *           changed or removed without notice.
+ * @ingroup kineticsmgr
+ */
+class KineticsCodeGenerator
+{
+public:
+    //! Constructor
+    //! @param soln  Solution object with the phase and kinetics to be generated
+    explicit KineticsCodeGenerator(shared_ptr<Solution> soln);
+
+    //! Set the prefix of the names of the generated functions. The prefix needs to
+    //! be a valid C identifier; by default, the name of the Solution object is used
+    //! if it is a valid identifier, and `mechanism` otherwise.
+    void setPrefix(const string& prefix);
+
+    //! Get the prefix of the names of the generated functions
+    const string& prefix() const {
+        return m_prefix;
+    }
+
+    //! Return the generated source code
+    string toSource() const;
+
+    //! Write the generated source code to the specified file
+    void toFile(const string& filename) const;
+
+protected:
+    shared_ptr<Solution> m_soln; //!< Solution object used to generate the code
+    string m_prefix; //!< Prefix of generated function names
+};
+
+}
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ *  @file MechanismReducer.h
+ *  On-the-fly mechanism reduction using the directed relation graph method
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_MECHANISMREDUCER_H
+#define CT_MECHANISMREDUCER_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+class Kinetics;
+
+//! Dynamic mechanism reduction based on the directed relation graph (DRG) or the
+//! directed relation graph with error propagation (DRGEP) methods.
+/*!
+ * The species interaction graph is constructed from the current net rates of
+ * progress of a Kinetics object. For DRGEP, the direct interaction coefficient
+ * between species @f$ A @f$ and @f$ B @f$ is
+ *
+ * @f[
+ *     r_{AB} = \frac{\left| \sum_i \nu_{A,i} \omega_i \delta_{B,i} \right|}
+ *                   {\max(P_A, C_A)}
+ * @f]
+ *
+ * where @f$ \nu_{A,i} @f$ is the net stoichiometric coefficient of species
+ * @f$ A @f$ in reaction @f$ i @f$, @f$ \omega_i @f$ is the net rate of progress,
+ * @f$ \delta_{B,i} @f$ is unity if species @f$ B @f$ participates in reaction
+ * @f$ i @f$ and zero otherwise, and @f$ P_A @f$ and @f$ C_A @f$ are the total
+ * production and consumption rates of species @f$ A @f$. The importance of each
+ * species is the maximum product of interaction coefficients along any path
+ * starting from one of the target species. For DRG, the direct
+ * interaction coefficient is
+ *
+ * @f[
+ *     r_{AB} = \frac{\sum_i \left| \nu_{A,i} \omega_i \delta_{B,i} \right|}
+ *                   {\sum_i \left| \nu_{A,i} \omega_i \right|}
+ * @f]
+ *
+ * such that contributions of reactions with opposing rates do not cancel, and
+ * species are either important (1) or unimportant (0) depending on whether they
+ * can be reached from a target species along edges with @f$ r_{AB} @f$ above the
+ * threshold.
+ *
+ * Species with an importance below the threshold are inactive, and reactions
+ * involving any inactive species are deactivated. For BulkKinetics, inactive
+ * reactions are excluded from evaluation using BulkKinetics::setActiveReactions;
+ * for other Kinetics types, their rate multipliers are set to zero.
+ *
+ * References:
+ * - T. Lu and C. K. Law. A directed relation graph method for mechanism
+ *   reduction. *Proc. Combust. Inst.* 30:1333-1341, 2005.
+ * - P. Pepiot-Desjardins and H. Pitsch. An efficient error-propagation-based
+ *   reduction method for large chemical kinetic mechanisms. *Combust. Flame*
+ *   154:67-81, 2008.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup kineticsmgr
+ */
+class MechanismReducer
+{
+public:
+    //! Create a reducer for the Kinetics object *kin*. The Kinetics object must
+    //! not be destroyed before the reducer.
+    MechanismReducer(Kinetics& kin);
+
+    //! Set the reduction method; either `DRGEP` (default) or `DRG`
+    void setMethod(const string& method);
+
+    //! Get the reduction method
+    string method() const {
+        return m_drgep ? "DRGEP" : "DRG";
+    }
+
+    //! Set the importance threshold below which species are deactivated
+    void setThreshold(double threshold);
+
+    //! Get the importance threshold
+    double threshold() const {
+        return m_threshold;
+    }
+
+    //! Set the target species, which are always retained
+    void setTargets(const vector<string>& targets);
+
+    //! Evaluate species importance at the current state of the Kinetics object,
+    //! and update the sets of active species and reactions.
+    /*!
+     * The importance is evaluated from the rates of the complete mechanism, so
+     * this method should be called while reductions are not applied. Returns
+     * `true` if the set of active reactions changed.
+     */
+    bool update();
+
+    //! Deactivate unimportant reactions. The current set of active reactions
+    //! (for BulkKinetics) or the multipliers of deactivated reactions are saved.
+    void apply();
+
+    //! Restore the active reactions or multipliers saved by apply()
+    void restore();
+
+    //! Return `true` if the reduction is currently applied
+    bool applied() const {
+        return m_applied;
+    }
+
+    //! Species importance from the last call to update()
+    const vector<double>& importance() const {
+        return m_importance;
+    }
+
+    //! Return `true` if species *k* was active after the last call to update()
+    bool speciesActive(size_t k) const {
+        return m_activeSpecies[k];
+    }
+
+    //! Return `true` if reaction *i* was active after the last call to update()
+    bool reactionActive(size_t i) const {
+        return m_activeReactions[i];
+    }
+
+    //! Number of active species
+    size_t nActiveSpecies() const;
+
+    //! Number of active reactions
+    size_t nActiveReactions() const;
+
+protected:
+    //! Set up stoichiometric matrices from the current reactions
+    void setup();
+
+    Kinetics& m_kin;
+
+    bool m_drgep = true; //!< Use DRGEP; otherwise, DRG
+    double m_threshold = 1e-3; //!< Importance threshold
+    vector<size_t> m_targets; //!< Indices of target species
+
+    //! Net stoichiometric coefficients (species by reactions)
+    Eigen::SparseMatrix<double> m_nu;
+
+    //! Participation matrix (species by reactions); entries are unity for each
+    //! species participating in a reaction
+    Eigen::SparseMatrix<double> m_delta;
+
+    //! Transpose of #m_delta
+    Eigen::SparseMatrix<double> m_deltaT;
+
+    vector<double> m_importance; //!< Species importance
+    vector<bool> m_activeSpecies; //!< Active species
+    vector<bool> m_activeReactions; //!< Active reactions
+
+    bool m_applied = false; //!< Indicates whether the reduction is applied
+
+    //! Indices and saved multipliers of reactions deactivated by apply()
+    vector<pair<size_t, double>> m_deactivated;
+
+    //! Active reactions of a BulkKinetics object saved by apply()
+    vector<bool> m_savedMask;
+
+    vector<double> m_ropnet; //!< Work array for net rates of progress
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@ class MultiRate final : public MultiRateBase
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
     CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
+    CT_DEFINE_HAS_MEMBER(has_setRates, setRates)
 
 public:
     string type() override {
@@ -36,8 +37,10 @@ public:
 
     void add(size_t rxn_index, ReactionRate& rate) override {
         m_indices[rxn_index] = m_rxn_rates.size();
+        setActive({});
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
         m_shared.invalidateCache();
+        m_ratesChanged = true;
     }
 
     bool replace(size_t rxn_index, ReactionRate& rate) override {
@@ -52,6 +55,7 @@ public:
                  "with a new rate of type '{}'.", type(), rate.type());
         }
         m_shared.invalidateCache();
+        m_ratesChanged = true;
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
@@ -63,20 +67,42 @@ public:
     void resize(size_t nSpecies, size_t nReactions, size_t nPhases) override {
         m_shared.resize(nSpecies, nReactions, nPhases);
         m_shared.invalidateCache();
+        m_ratesChanged = true;
     }
 
     void getRateConstants(double* kf) override {
+        if (m_masked) {
+            for (size_t j : m_active) {
+                auto& [iRxn, rate] = m_rxn_rates[j];
+                kf[iRxn] = rate.evalFromStruct(m_shared);
+            }
+            return;
+        }
         for (auto& [iRxn, rate] : m_rxn_rates) {
             kf[iRxn] = rate.evalFromStruct(m_shared);
         }
     }
 
+    void setActive(const vector<bool>& active) override {
+        m_active.clear();
+        m_masked = !active.empty();
+        if (m_masked) {
+            for (size_t j = 0; j < m_rxn_rates.size(); j++) {
+                if (active[m_rxn_rates[j].first]) {
+                    m_active.push_back(j);
+                }
+            }
+        }
+        // newly activated reactions require updated rate data
+        m_shared.invalidateCache();
+    }
+
     void processRateConstants_ddT(double* rop, const double* kf, double deltaT) override
     {
         if constexpr (has_ddT<RateType>::value) {
-            for (const auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType& rate) {
                 rop[iRxn] *= rate.ddTScaledFromStruct(m_shared);
-            }
+            });
         } else {
             // perturb conditions
             double dTinv = 1. / (m_shared.temperature * deltaT);
@@ -84,12 +110,12 @@ public:
             _update();
 
             // apply numerical derivative
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType& rate) {
                 if (kf[iRxn] != 0.) {
                     double k1 = rate.evalFromStruct(m_shared);
                     rop[iRxn] *= dTinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
-            }
+            });
 
             // revert changes
             m_shared.restore();
@@ -104,20 +130,20 @@ public:
             m_shared.perturbPressure(deltaP);
             _update();
 
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType& rate) {
                 if (kf[iRxn] != 0.) {
                     double k1 = rate.evalFromStruct(m_shared);
                     rop[iRxn] *= dPinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
-            }
+            });
 
             // revert changes
             m_shared.restore();
             _update();
         } else {
-            for (const auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType&) {
                 rop[iRxn] = 0.;
-            }
+            });
         }
     }
 
@@ -129,7 +155,7 @@ public:
             m_shared.perturbThirdBodies(deltaM);
             _update();
 
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType& rate) {
                 if (kf[iRxn] != 0. && m_shared.conc_3b[iRxn] > 0.) {
                     double k1 = rate.evalFromStruct(m_shared);
                     rop[iRxn] *= dMinv * (k1 / kf[iRxn] - 1.);
@@ -137,7 +163,7 @@ public:
                 } else {
                     rop[iRxn] = 0.;
                 }
-            }
+            });
 
             // revert changes
             m_shared.restore();
@@ -147,9 +173,9 @@ public:
                 // do not overwrite existing entries
                 return;
             }
-            for (const auto& [iRxn, rate] : m_rxn_rates) {
+            _forActive([&](size_t iRxn, RateType&) {
                 rop[iRxn] = 0.;
-            }
+            });
         }
     }
 
@@ -169,6 +195,18 @@ public:
     }
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override {
+        if constexpr (has_setRates<DataType>::value) {
+            // shared data depending on the set of rate objects is only used for
+            // updates based on the state of a Kinetics object
+            if (m_ratesChanged) {
+                vector<ReactionRate*> rates;
+                for (auto& [i, rxn] : m_rxn_rates) {
+                    rates.push_back(&rxn);
+                }
+                m_shared.setRates(rates);
+                m_ratesChanged = false;
+            }
+        }
         bool changed = m_shared.update(phase, kin);
         if (changed) {
             // call helper function only if needed: implementation depends on whether
@@ -193,9 +231,29 @@ public:
     }
 
 protected:
+    //! Apply *f* to the reaction index and rate object of each active reaction
+    template <class Func>
+    void _forActive(Func&& f) {
+        if (m_masked) {
+            for (size_t j : m_active) {
+                f(m_rxn_rates[j].first, m_rxn_rates[j].second);
+            }
+            return;
+        }
+        for (auto& [iRxn, rate] : m_rxn_rates) {
+            f(iRxn, rate);
+        }
+    }
+
     //! Helper function to process updates
     void _update() {
         if constexpr (has_update<RateType>::value) {
+            if (m_masked) {
+                for (size_t j : m_active) {
+                    m_rxn_rates[j].second.updateFromStruct(m_shared);
+                }
+                return;
+            }
             for (auto& [i, rxn] : m_rxn_rates) {
                 rxn.updateFromStruct(m_shared);
             }
@@ -205,6 +263,16 @@ protected:
     //! Vector of pairs of reaction rates indices and reaction rates
     vector<pair<size_t, RateType>> m_rxn_rates;
     map<size_t, size_t> m_indices; //! Mapping of indices
+
+    //! Indices within #m_rxn_rates of active reactions, if evaluation is restricted
+    //! to a subset of reactions (see setActive())
+    vector<size_t> m_active;
+    bool m_masked = false; //!< Indicates whether evaluation is restricted
+
+    //! Indicates whether rate objects were added or replaced since the shared data
+    //! were last set up for the current set of rates (used if `DataType::setRates`
+    //! is defined)
+    bool m_ratesChanged = true;
     DataType m_shared;
 };
 
@@ -52,6 +52,14 @@ public:
     //! @param kf  array of rate constants
     virtual void getRateConstants(double* kf) = 0;
 
+    //! Restrict evaluation of rate constants to a subset of reactions.
+    //! Rate constants of inactive reactions are not updated by getRateConstants().
+    //! Adding a reaction rate removes the restriction.
+    //! @param active  flags indicating active reactions, indexed by reaction number;
+    //!     an empty vector marks all reactions as active
+    //! @since New in %Cantera 3.1.
+    virtual void setActive(const vector<bool>& active) = 0;
+
     //! Evaluate all rate constant temperature derivatives handled by the evaluator;
     //! which are multiplied with the array of rate-of-progress variables.
     //! Depending on the implementation of a rate object, either an exact derivative or
@@ -7,6 +7,7 @@
 #define CT_PLOGRATE_H
 
 #include "cantera/kinetics/Arrhenius.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -15,6 +16,15 @@ namespace Cantera
 /**
  * The data container `PlogData` holds precalculated data common to
  * all `PlogRate` objects.
+ *
+ * If the rates handled by a Kinetics object are registered using setRates(), rates
+ * with a single Arrhenius expression at each reference pressure are collapsed into
+ * effective modified Arrhenius expressions whenever the pressure changes. Since
+ * the logarithm of the rate constant is interpolated linearly in the logarithm of
+ * the pressure, the effective parameters are the interpolated parameters of the
+ * two neighboring reference pressures. All collapsed rates are then evaluated
+ * jointly for each temperature, such that at constant pressure, PLOG rates have
+ * the same cost as plain Arrhenius rates.
  */
 struct PlogData : public ReactionData
 {
@@ -22,14 +32,14 @@ struct PlogData : public ReactionData
 
     void update(double T) override;
 
-    void update(double T, double P) override {
-        ReactionData::update(T);
-        pressure = P;
-        logP = std::log(P);
-    }
+    void update(double T, double P) override;
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
 
+    //! Register the rate objects for joint evaluation
+    //! @since New in %Cantera 3.1.
+    void setRates(const vector<ReactionRate*>& rates);
+
     using ReactionData::update;
 
     //! Perturb pressure of data container
@@ -49,8 +59,35 @@ struct PlogData : public ReactionData
     double pressure = NAN; //!< pressure
     double logP = 0.0; //!< logarithm of pressure
 
+    //! Logarithms of the effective pre-exponential factors of the registered rates
+    //! at the current pressure, or NaN for rates that cannot be collapsed
+    Eigen::ArrayXd logA;
+    Eigen::ArrayXd b; //!< Effective temperature exponents
+    Eigen::ArrayXd Ea_R; //!< Effective activation energies [K]
+
+    //! Rate constants of the registered rates evaluated at #rateTemperature
+    Eigen::ArrayXd rateCoefficients;
+
+    //! Temperature used to evaluate #rateCoefficients
+    double rateTemperature = NAN;
+
 protected:
     double m_pressure_buf = -1.0; //!< buffered pressure
+
+    //! Offsets of the reference pressures of each registered rate within
+    //! #m_refLogP. Length: number of registered rates + 1
+    vector<size_t> m_refStart;
+
+    //! Logarithms of the reference pressures of all registered rates, including
+    //! the bounding entries used for extrapolation
+    vector<double> m_refLogP;
+
+    //! Arrhenius parameters at the reference pressures, where @f$ \ln A @f$ is
+    //! NaN for pressures with more than one rate expression
+    vector<double> m_refLogA, m_refB, m_refEa_R;
+
+    //! Pressure used to evaluate #logA, #b and #Ea_R
+    double m_collapsedLogP = NAN;
 };
 
 
@@ -75,6 +112,8 @@ protected:
  */
 class PlogRate final : public ReactionRate
 {
+    friend struct PlogData;
+
 public:
     //! Default constructor.
     PlogRate() = default;
@@ -139,6 +178,17 @@ public:
      *  @param shared_data  data shared by all reactions of a given type
      */
     double evalFromStruct(const PlogData& shared_data) {
+        if (m_dataIndex < static_cast<size_t>(shared_data.logA.size())
+            && !std::isnan(shared_data.logA[m_dataIndex]))
+        {
+            // effective Arrhenius expression at the current pressure
+            if (shared_data.temperature == shared_data.rateTemperature) {
+                return shared_data.rateCoefficients[m_dataIndex];
+            }
+            return std::exp(shared_data.logA[m_dataIndex]
+                            + shared_data.b[m_dataIndex] * shared_data.logT
+                            - shared_data.Ea_R[m_dataIndex] * shared_data.recipT);
+        }
         double log_k1, log_k2;
         if (ilow1_ == ilow2_) {
             log_k1 = rates_[ilow1_].evalLog(shared_data.logT, shared_data.recipT);
@@ -194,6 +244,10 @@ protected:
     size_t ilow1_, ilow2_, ihigh1_, ihigh2_;
 
     double rDeltaP_ = -1.0; //!< reciprocal of (logP2 - logP1)
+
+    //! Index of this rate within the arrays of PlogData, or @ref npos if the rate
+    //! is evaluated individually
+    size_t m_dataIndex = npos;
 };
 
 }
@@ -100,7 +100,13 @@ public:
     //! @param units  unit definitions specific to rate information
     virtual void setParameters(const AnyMap& node, const UnitStack& units) {
         setRateUnits(units);
-        m_input = node;
+        // Rate input is reduced to the input file metadata and the equation;
+        // serialization relies on getParameters() to reconstruct the rate
+        m_input.clear();
+        m_input.copyMetadata(node);
+        if (node.hasKey("equation")) {
+            m_input["equation"] = node["equation"];
+        }
     }
 
     //! Return the parameters such that an identical Reaction could be reconstructed
@@ -226,7 +232,8 @@ protected:
                                   "Not implemented by '{}' object.", type());
     }
 
-    //! Input data used for specific models
+    //! Location of the rate definition in the input file and the reaction equation,
+    //! used for error messages
     AnyMap m_input;
 
     //! Index of reaction rate within kinetics evaluator
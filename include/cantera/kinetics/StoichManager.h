@@ -148,6 +148,10 @@ public:
         R[m_rxn] *= S[m_ic0];
     }
 
+    void appendOrders(vector<vector<pair<size_t, double>>>& orders) const {
+        orders[m_rxn].emplace_back(m_ic0, 1.0);
+    }
+
     void incrementReaction(const double* S, double* R) const {
         R[m_rxn] += S[m_ic0];
     }
@@ -172,6 +176,11 @@ public:
         out[m_rxn] = R[m_rxn] * factor;
     }
 
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     //! Reaction number
     size_t m_rxn;
@@ -210,6 +219,11 @@ public:
         }
     }
 
+    void appendOrders(vector<vector<pair<size_t, double>>>& orders) const {
+        orders[m_rxn].emplace_back(m_ic0, 1.0);
+        orders[m_rxn].emplace_back(m_ic1, 1.0);
+    }
+
     void incrementReaction(const double* S, double* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1];
     }
@@ -239,6 +253,11 @@ public:
         out[m_rxn] = 2 * R[m_rxn] * factor;
     }
 
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     //! Reaction index -> index into the ROP vector
     size_t m_rxn;
@@ -281,6 +300,12 @@ public:
         }
     }
 
+    void appendOrders(vector<vector<pair<size_t, double>>>& orders) const {
+        orders[m_rxn].emplace_back(m_ic0, 1.0);
+        orders[m_rxn].emplace_back(m_ic1, 1.0);
+        orders[m_rxn].emplace_back(m_ic2, 1.0);
+    }
+
     void incrementReaction(const double* S, double* R) const {
         R[m_rxn] += S[m_ic0] + S[m_ic1] + S[m_ic2];
     }
@@ -314,6 +339,11 @@ public:
         out[m_rxn] = 3 * R[m_rxn] * factor;
     }
 
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     size_t m_rxn;
     size_t m_ic0;
@@ -363,6 +393,14 @@ public:
         }
     }
 
+    void appendOrders(vector<vector<pair<size_t, double>>>& orders) const {
+        for (size_t n = 0; n < m_n; n++) {
+            if (m_order[n] != 0.0) {
+                orders[m_rxn].emplace_back(m_ic[n], m_order[n]);
+            }
+        }
+    }
+
     void incrementSpecies(const double* input, double* output) const {
         double x = input[m_rxn];
         for (size_t n = 0; n < m_n; n++) {
@@ -431,6 +469,11 @@ public:
         out[m_rxn] = m_sum_order * R[m_rxn] * factor;
     }
 
+    //! Index of the reaction
+    size_t rxnNumber() const {
+        return m_rxn;
+    }
+
 private:
     //! Length of the m_ic vector
     /*!
@@ -547,6 +590,21 @@ inline static void _scale(InputIter begin, InputIter end,
     }
 }
 
+template<class Vec>
+inline static void _selectActive(const Vec& all, const vector<bool>& active,
+                                 Vec& selected)
+{
+    selected.clear();
+    if (active.empty()) {
+        return;
+    }
+    for (const auto& c : all) {
+        if (active[c.rxnNumber()]) {
+            selected.push_back(c);
+        }
+    }
+}
+
 /**
  * This class handles operations involving the stoichiometric coefficients on
  * one side of a reaction (reactant or product) for a set of reactions
@@ -716,10 +774,31 @@ public:
                 m_cn_list.emplace_back(rxn, k, order, stoich);
             }
         }
+        setActive({});
         m_ready = false;
     }
 
+    //! Restrict multiply(), derivatives() and scale() to a subset of reactions.
+    //! Adding a reaction removes the restriction.
+    //! @param active  flags indicating active reactions, indexed by reaction number;
+    //!     an empty vector marks all reactions as active
+    //! @since New in %Cantera 3.1.
+    void setActive(const vector<bool>& active) {
+        m_masked = !active.empty();
+        _selectActive(m_c1_list, active, m_c1_active);
+        _selectActive(m_c2_list, active, m_c2_active);
+        _selectActive(m_c3_list, active, m_c3_active);
+        _selectActive(m_cn_list, active, m_cn_active);
+    }
+
     void multiply(const double* input, double* output) const {
+        if (m_masked) {
+            _multiply(m_c1_active.begin(), m_c1_active.end(), input, output);
+            _multiply(m_c2_active.begin(), m_c2_active.end(), input, output);
+            _multiply(m_c3_active.begin(), m_c3_active.end(), input, output);
+            _multiply(m_cn_active.begin(), m_cn_active.end(), input, output);
+            return;
+        }
         _multiply(m_c1_list.begin(), m_c1_list.end(), input, output);
         _multiply(m_c2_list.begin(), m_c2_list.end(), input, output);
         _multiply(m_c3_list.begin(), m_c3_list.end(), input, output);
@@ -781,25 +860,69 @@ public:
     {
         // calculate derivative entries using known sparse storage order
         std::fill(m_values.begin(), m_values.end(), 0.);
-        _derivatives(m_c1_list.begin(), m_c1_list.end(), conc, rates, m_values);
-        _derivatives(m_c2_list.begin(), m_c2_list.end(), conc, rates, m_values);
-        _derivatives(m_c3_list.begin(), m_c3_list.end(), conc, rates, m_values);
-        _derivatives(m_cn_list.begin(), m_cn_list.end(), conc, rates, m_values);
+        if (m_masked) {
+            _derivatives(m_c1_active.begin(), m_c1_active.end(), conc, rates, m_values);
+            _derivatives(m_c2_active.begin(), m_c2_active.end(), conc, rates, m_values);
+            _derivatives(m_c3_active.begin(), m_c3_active.end(), conc, rates, m_values);
+            _derivatives(m_cn_active.begin(), m_cn_active.end(), conc, rates, m_values);
+        } else {
+            _derivatives(m_c1_list.begin(), m_c1_list.end(), conc, rates, m_values);
+            _derivatives(m_c2_list.begin(), m_c2_list.end(), conc, rates, m_values);
+            _derivatives(m_c3_list.begin(), m_c3_list.end(), conc, rates, m_values);
+            _derivatives(m_cn_list.begin(), m_cn_list.end(), conc, rates, m_values);
+        }
 
         return Eigen::Map<Eigen::SparseMatrix<double>>(
             m_stoichCoeffs.cols(), m_stoichCoeffs.rows(), m_values.size(),
             m_outerIndices.data(), m_innerIndices.data(), m_values.data());
     }
 
-    //! Scale input by reaction order and factor
+    //! Scale input by reaction order and factor. If restricted to active
+    //! reactions, entries of inactive reactions are not modified.
     void scale(const double* in, double* out, double factor) const
     {
+        if (m_masked) {
+            _scale(m_c1_active.begin(), m_c1_active.end(), in, out, factor);
+            _scale(m_c2_active.begin(), m_c2_active.end(), in, out, factor);
+            _scale(m_c3_active.begin(), m_c3_active.end(), in, out, factor);
+            _scale(m_cn_active.begin(), m_cn_active.end(), in, out, factor);
+            return;
+        }
         _scale(m_c1_list.begin(), m_c1_list.end(), in, out, factor);
         _scale(m_c2_list.begin(), m_c2_list.end(), in, out, factor);
         _scale(m_c3_list.begin(), m_c3_list.end(), in, out, factor);
         _scale(m_cn_list.begin(), m_cn_list.end(), in, out, factor);
     }
 
+    //! Get the species indices and reaction orders of the concentration products
+    //! evaluated by multiply()
+    /*!
+     * @param[out] orders  Pairs of species index and reaction order, indexed by
+     *     reaction number. Species with integer stoichiometric coefficients are
+     *     repeated with unit order. Needs to be sized to the number of reactions.
+     * @param[out] general  Flags indicating reactions with arbitrary reaction
+     *     orders, indexed by reaction number. Needs to be sized to the number of
+     *     reactions.
+     * @since New in %Cantera 3.1.
+     */
+    void getOrders(vector<vector<pair<size_t, double>>>& orders,
+                   vector<bool>& general) const
+    {
+        for (const auto& c : m_c1_list) {
+            c.appendOrders(orders);
+        }
+        for (const auto& c : m_c2_list) {
+            c.appendOrders(orders);
+        }
+        for (const auto& c : m_c3_list) {
+            c.appendOrders(orders);
+        }
+        for (const auto& c : m_cn_list) {
+            c.appendOrders(orders);
+            general[c.rxnNumber()] = true;
+        }
+    }
+
 private:
     bool m_ready; //!< Boolean flag indicating whether object is fully configured
 
@@ -808,6 +931,14 @@ private:
     vector<C3> m_c3_list;
     vector<C_AnyN> m_cn_list;
 
+    //! Compacted copies of the reaction lists containing only active reactions,
+    //! used if #m_masked is set (see setActive())
+    vector<C1> m_c1_active;
+    vector<C2> m_c2_active;
+    vector<C3> m_c3_active;
+    vector<C_AnyN> m_cn_active;
+    bool m_masked = false; //!< Indicates whether evaluation is restricted
+
     //! Sparse matrices for stoichiometric coefficients
     SparseTriplets m_coeffList;
     Eigen::SparseMatrix<double> m_stoichCoeffs;
@@ -818,6 +949,193 @@ private:
     vector<double> m_values;
 };
 
+/**
+ * Fused evaluation of rates of progress and species production rates.
+ *
+ * Forward and reverse rates of progress, net rates of progress and net production
+ * rates are calculated in a single traversal of a compacted table. For each
+ * reaction, the table holds the concentration factors of the forward and reverse
+ * rate expressions as well as the net stoichiometric coefficients in contiguous
+ * arrays. Compared to separate calls of StoichManagerN::multiply(),
+ * StoichManagerN::incrementSpecies() and StoichManagerN::decrementSpecies(), the
+ * rate and concentration vectors are streamed once rather than several times.
+ *
+ * Concentration products of reactions with arbitrary reaction orders are
+ * evaluated in log space, that is, as the exponential of the sum of the logarithms
+ * of the concentrations weighted by the reaction orders. Consistent with
+ * StoichManagerN, concentration products of reactions with unit orders are zero if
+ * more than one concentration is negative, and concentration products with
+ * arbitrary reaction orders are zero if any concentration is non-positive.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup Stoichiometry
+ */
+class FusedStoichManager
+{
+public:
+    //! Set up the table
+    /*!
+     * @param reactants  Stoichiometry manager for the reactants of all reactions
+     * @param revProducts  Stoichiometry manager for the products of reversible
+     *     reactions
+     * @param netStoich  Net stoichiometric coefficient matrix, with species as
+     *     rows and reactions as columns
+     */
+    void resizeCoeffs(const StoichManagerN& reactants,
+                      const StoichManagerN& revProducts,
+                      const Eigen::SparseMatrix<double>& netStoich)
+    {
+        size_t nRxn = netStoich.cols();
+        m_nSpc = netStoich.rows();
+        m_fwd.assign(nRxn, {});
+        m_rev.assign(nRxn, {});
+        m_net.assign(nRxn, {});
+        m_fwdGeneral.assign(nRxn, false);
+        m_revGeneral.assign(nRxn, false);
+        reactants.getOrders(m_fwd, m_fwdGeneral);
+        revProducts.getOrders(m_rev, m_revGeneral);
+        for (int i = 0; i < netStoich.outerSize(); i++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(netStoich, i); it; ++it)
+            {
+                if (it.value() != 0.0) {
+                    m_net[i].emplace_back(it.row(), it.value());
+                }
+            }
+        }
+        setActive({});
+    }
+
+    //! Number of reactions in the table
+    size_t nReactions() const {
+        return m_fwd.size();
+    }
+
+    //! Restrict evaluate() to a subset of reactions
+    //! @param active  flags indicating active reactions, indexed by reaction number;
+    //!     an empty vector marks all reactions as active
+    void setActive(const vector<bool>& active) {
+        m_rxn.clear();
+        for (size_t i = 0; i < m_fwd.size(); i++) {
+            if (active.empty() || active[i]) {
+                m_rxn.push_back(i);
+            }
+        }
+        _compact(m_fwd, m_fwdStart, m_fwdSpecies, m_fwdOrder);
+        _compact(m_rev, m_revStart, m_revSpecies, m_revOrder);
+        _compact(m_net, m_netStart, m_netSpecies, m_netStoich);
+        m_fwdFlags.resize(m_rxn.size());
+        m_revFlags.resize(m_rxn.size());
+        for (size_t n = 0; n < m_rxn.size(); n++) {
+            m_fwdFlags[n] = m_fwdGeneral[m_rxn[n]];
+            m_revFlags[n] = m_revGeneral[m_rxn[n]];
+        }
+    }
+
+    //! Evaluate rates of progress and net production rates of active reactions
+    /*!
+     * @param conc  Activity concentrations of all species
+     * @param rkcn  Reciprocal equilibrium constants, which are zero for
+     *     irreversible reactions
+     * @param[in,out] ropf  On input, forward rate coefficients including
+     *     third-body concentrations; on output, forward rates of progress
+     * @param[out] ropr  Reverse rates of progress
+     * @param[out] ropnet  Net rates of progress
+     * @param[out] wdot  Net production rates of all species
+     */
+    void evaluate(const double* conc, const double* rkcn, double* ropf, double* ropr,
+                  double* ropnet, double* wdot) const
+    {
+        std::fill(wdot, wdot + m_nSpc, 0.0);
+        for (size_t n = 0; n < m_rxn.size(); n++) {
+            size_t i = m_rxn[n];
+            double kf = ropf[i];
+            ropf[i] = kf * _product(conc, m_fwdStart[n], m_fwdStart[n + 1],
+                                    m_fwdSpecies, m_fwdOrder, m_fwdFlags[n]);
+            ropr[i] = 0.0;
+            if (rkcn[i] != 0.0) {
+                ropr[i] = kf * rkcn[i] * _product(conc, m_revStart[n],
+                    m_revStart[n + 1], m_revSpecies, m_revOrder, m_revFlags[n]);
+            }
+            double q = ropf[i] - ropr[i];
+            ropnet[i] = q;
+            for (size_t j = m_netStart[n]; j < m_netStart[n + 1]; j++) {
+                wdot[m_netSpecies[j]] += m_netStoich[j] * q;
+            }
+        }
+    }
+
+private:
+    //! Concentration product for the table entries from *start* to *end*
+    static double _product(const double* conc, size_t start, size_t end,
+                           const vector<size_t>& species, const vector<double>& order,
+                           bool general)
+    {
+        if (general) {
+            double logProd = 0.0;
+            for (size_t j = start; j < end; j++) {
+                double c = conc[species[j]];
+                if (c <= 0.0) {
+                    return 0.0;
+                }
+                logProd += order[j] * std::log(c);
+            }
+            return std::exp(logProd);
+        }
+        double prod = 1.0;
+        int nNegative = 0;
+        for (size_t j = start; j < end; j++) {
+            double c = conc[species[j]];
+            prod *= c;
+            nNegative += (c < 0.0);
+        }
+        return (nNegative > 1) ? 0.0 : prod;
+    }
+
+    //! Store entries of the active reactions in contiguous arrays
+    void _compact(const vector<vector<pair<size_t, double>>>& entries,
+                  vector<size_t>& start, vector<size_t>& species,
+                  vector<double>& values) const
+    {
+        start.assign(1, 0);
+        species.clear();
+        values.clear();
+        for (size_t i : m_rxn) {
+            for (const auto& [k, value] : entries[i]) {
+                species.push_back(k);
+                values.push_back(value);
+            }
+            start.push_back(species.size());
+        }
+    }
+
+    size_t m_nSpc = 0; //!< Number of species
+
+    //! @name Entries for all reactions, indexed by reaction number
+    //! @{
+    vector<vector<pair<size_t, double>>> m_fwd; //!< Forward orders
+    vector<vector<pair<size_t, double>>> m_rev; //!< Reverse orders
+    vector<vector<pair<size_t, double>>> m_net; //!< Net stoichiometric coefficients
+    vector<bool> m_fwdGeneral; //!< Forward orders are arbitrary
+    vector<bool> m_revGeneral; //!< Reverse orders are arbitrary
+    //! @}
+
+    //! @name Compacted table of active reactions
+    //! @{
+    vector<size_t> m_rxn; //!< Reaction indices
+    vector<size_t> m_fwdStart; //!< Offsets of the forward orders of each reaction
+    vector<size_t> m_fwdSpecies; //!< Species indices of the forward orders
+    vector<double> m_fwdOrder; //!< Forward orders
+    vector<size_t> m_revStart; //!< Offsets of the reverse orders of each reaction
+    vector<size_t> m_revSpecies; //!< Species indices of the reverse orders
+    vector<double> m_revOrder; //!< Reverse orders
+    vector<size_t> m_netStart; //!< Offsets of the net stoichiometric coefficients
+    vector<size_t> m_netSpecies; //!< Species indices of the net coefficients
+    vector<double> m_netStoich; //!< Net stoichiometric coefficients
+    vector<bool> m_fwdFlags; //!< Forward orders are arbitrary
+    vector<bool> m_revFlags; //!< Reverse orders are arbitrary
+    //! @}
+};
+
 }
 
 #endif
@@ -9,12 +9,20 @@
 #define CT_THIRDBODYCALC_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
 
 //! Calculate and apply third-body effects on reaction rates, including non-
 //! unity third-body efficiencies.
+//!
+//! Efficiencies that differ from the default efficiency of each reaction are
+//! stored in a compressed row (CSR) matrix, such that the third-body concentrations
+//! of all reactions are obtained in a single pass over contiguous arrays. The same
+//! matrix is used to set up the multipliers for derivatives with respect to species
+//! concentrations.
 //! @ingroup rateEvaluators
 class ThirdBodyCalc
 {
@@ -30,62 +38,99 @@ public:
         } else {
             m_no_mass_action_index.push_back(m_reaction_index.size() - 1);
         }
+        setActive({});
 
-        m_species.emplace_back();
-        m_eff.emplace_back();
         for (const auto& [k, efficiency] : efficiencies) {
             AssertTrace(k != npos);
-            m_species.back().push_back(k);
-            m_eff.back().push_back(efficiency - default_efficiency);
             m_efficiencyList.emplace_back(
-                static_cast<int>(rxnNumber),
+                static_cast<int>(m_reaction_index.size() - 1),
                 static_cast<int>(k), efficiency - default_efficiency);
         }
+        m_ready = false;
     }
 
     //! Resize the sparse coefficient matrix
     void resizeCoeffs(size_t nSpc, size_t nRxn) {
-        // Sparse Efficiency coefficient matrix
-        Eigen::SparseMatrix<double> efficiencies;
-        efficiencies.setZero();
-        efficiencies.resize(nRxn, nSpc);
-        efficiencies.reserve(m_efficiencyList.size());
-        efficiencies.setFromTriplets(
+        // Sparse efficiency matrix; rows correspond to entries of m_reaction_index
+        m_efficiencies.resize(m_reaction_index.size(), nSpc);
+        m_efficiencies.setFromTriplets(
             m_efficiencyList.begin(), m_efficiencyList.end());
+        m_efficiencies.makeCompressed();
 
-        // derivative matrix multipliers
+        // derivative matrix multipliers, where rows correspond to reactions
         vector<Eigen::Triplet<double>> triplets;
-        triplets.reserve(m_reaction_index.size() * nSpc);
+        triplets.reserve(m_reaction_index.size() * nSpc + m_efficiencyList.size());
         for (size_t i = 0; i < m_default.size(); i++) {
+            int rxn = static_cast<int>(m_reaction_index[i]);
             if (m_default[i] != 0) {
                 for (size_t j = 0; j < nSpc; j++) {
-                    triplets.emplace_back(
-                        static_cast<int>(m_reaction_index[i]),
-                        static_cast<int>(j), m_default[i]);
+                    triplets.emplace_back(rxn, static_cast<int>(j), m_default[i]);
                 }
             }
+            for (RowMajorSparse::InnerIterator it(m_efficiencies, i); it; ++it) {
+                triplets.emplace_back(rxn, static_cast<int>(it.col()), it.value());
+            }
+        }
+        m_multipliers.resize(nRxn, nSpc);
+        m_multipliers.setFromTriplets(triplets.begin(), triplets.end());
+        m_ready = true;
+    }
+
+    //! Restrict updates, multiplication and scaling to a subset of reactions.
+    //! Installing a reaction removes the restriction.
+    //! @param active  flags indicating active reactions, indexed by reaction number;
+    //!     an empty vector marks all reactions as active
+    //! @since New in %Cantera 3.1.
+    void setActive(const vector<bool>& active) {
+        m_active_index.clear();
+        m_active_mass_action_index.clear();
+        m_active_no_mass_action_index.clear();
+        m_masked = !active.empty();
+        if (!m_masked) {
+            return;
+        }
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            if (active[m_reaction_index[i]]) {
+                m_active_index.push_back(i);
+            }
+        }
+        for (size_t i : m_mass_action_index) {
+            if (active[m_reaction_index[i]]) {
+                m_active_mass_action_index.push_back(i);
+            }
+        }
+        for (size_t i : m_no_mass_action_index) {
+            if (active[m_reaction_index[i]]) {
+                m_active_no_mass_action_index.push_back(i);
+            }
         }
-        Eigen::SparseMatrix<double> defaults(nRxn, nSpc);
-        defaults.reserve(triplets.size());
-        defaults.setFromTriplets(triplets.begin(), triplets.end());
-        m_multipliers = efficiencies + defaults;
     }
 
     //! Update third-body concentrations in full vector
     void update(const vector<double>& conc, double ctot, double* concm) const {
-        for (size_t i = 0; i < m_reaction_index.size(); i++) {
-            double sum = 0.0;
-            for (size_t j = 0; j < m_species[i].size(); j++) {
-                sum += m_eff[i][j] * conc[m_species[i][j]];
+        if (!m_ready) {
+            // This can happen if Kinetics::resizeReactions is not called after
+            // adding reactions via Kinetics::addReaction with 'resize' set to 'false'
+            throw CanteraError("ThirdBodyCalc::update", "The object is not fully "
+                "configured; make sure to call resizeCoeffs().");
+        }
+        if (m_masked) {
+            for (size_t i : m_active_index) {
+                updateSingle(i, conc, ctot, concm);
             }
-            concm[m_reaction_index[i]] = m_default[i] * ctot + sum;
+            return;
+        }
+        for (size_t i = 0; i < m_reaction_index.size(); i++) {
+            updateSingle(i, conc, ctot, concm);
         }
     }
 
     //! Multiply output with effective third-body concentration
     void multiply(double* output, const double* concm) {
-        for (size_t i = 0; i < m_mass_action_index.size(); i++) {
-            size_t ix = m_reaction_index[m_mass_action_index[i]];
+        const auto& index = m_masked ? m_active_mass_action_index
+                                     : m_mass_action_index;
+        for (size_t i = 0; i < index.size(); i++) {
+            size_t ix = m_reaction_index[index[i]];
             output[ix] *= concm[ix];
         }
     }
@@ -101,8 +146,10 @@ public:
 
     //! Scale entries involving third-body collider in law of mass action by factor
     void scale(const double* in, double* out, double factor) const {
-        for (size_t i = 0; i < m_mass_action_index.size(); i++) {
-            size_t ix = m_reaction_index[m_mass_action_index[i]];
+        const auto& index = m_masked ? m_active_mass_action_index
+                                     : m_mass_action_index;
+        for (size_t i = 0; i < index.size(); i++) {
+            size_t ix = m_reaction_index[index[i]];
             out[ix] = factor * in[ix];
         }
     }
@@ -112,8 +159,10 @@ public:
     void scaleM(const double* in, double* out,
                 const double* concm, double factor) const
     {
-        for (size_t i = 0; i < m_no_mass_action_index.size(); i++) {
-            size_t ix = m_reaction_index[m_no_mass_action_index[i]];
+        const auto& index = m_masked ? m_active_no_mass_action_index
+                                     : m_no_mass_action_index;
+        for (size_t i = 0; i < index.size(); i++) {
+            size_t ix = m_reaction_index[index[i]];
             out[ix] = factor * concm[ix] * in[ix];
         }
     }
@@ -124,6 +173,23 @@ public:
     }
 
 protected:
+    //! Update third-body concentration for entry *i* of #m_reaction_index
+    void updateSingle(size_t i, const vector<double>& conc, double ctot,
+                      double* concm) const
+    {
+        const int* outer = m_efficiencies.outerIndexPtr();
+        const int* inner = m_efficiencies.innerIndexPtr();
+        const double* values = m_efficiencies.valuePtr();
+        double sum = m_default[i] * ctot;
+        for (int n = outer[i]; n < outer[i + 1]; n++) {
+            sum += values[n] * conc[inner[n]];
+        }
+        concm[m_reaction_index[i]] = sum;
+    }
+
+    //! Sparse matrix type using compressed row storage
+    typedef Eigen::SparseMatrix<double, Eigen::RowMajor> RowMajorSparse;
+
     //! Indices of reactions that use third-bodies within vector of concentrations
     vector<size_t> m_reaction_index;
 
@@ -135,21 +201,36 @@ protected:
     //! in the rate expression
     vector<size_t> m_no_mass_action_index;
 
-    //! m_species[i][j] is the index of the j-th species in reaction i.
-    vector<vector<size_t>> m_species;
-
-    //! m_eff[i][j] is the efficiency of the j-th species in reaction i.
-    vector<vector<double>> m_eff;
-
     //! The default efficiency for each reaction
     vector<double> m_default;
 
-    //! Sparse efficiency matrix (compensated for defaults)
-    //! Each triplet corresponds to (reaction index, species index, efficiency)
+    //! Efficiencies compensated for defaults, where each triplet corresponds to
+    //! (index within m_reaction_index, species index, efficiency)
     vector<Eigen::Triplet<double>> m_efficiencyList;
 
+    //! Sparse efficiency matrix (compensated for defaults) in compressed row
+    //! storage, where rows correspond to entries of #m_reaction_index
+    RowMajorSparse m_efficiencies;
+
+    //! Boolean flag indicating whether #m_efficiencies is up to date
+    bool m_ready = true;
+
     //! Sparse derivative multiplier matrix
     Eigen::SparseMatrix<double> m_multipliers;
+
+    //! Indices within #m_reaction_index of active reactions, if updates are
+    //! restricted to a subset of reactions (see setActive())
+    vector<size_t> m_active_index;
+
+    //! Indices within #m_reaction_index of active reactions that consider
+    //! third-body effects in the law of mass action
+    vector<size_t> m_active_mass_action_index;
+
+    //! Indices within #m_reaction_index of active reactions that consider
+    //! third-body effects in the rate expression
+    vector<size_t> m_active_no_mass_action_index;
+
+    bool m_masked = false; //!< Indicates whether updates are restricted
 };
 
 }
@@ -11,6 +11,7 @@
 
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 //! @defgroup solvesp_methods Surface Problem Solver Methods
 //! @ingroup surfSolverGroup
@@ -135,10 +136,16 @@ namespace Cantera
  *  in this Newton iteration compared to that in the nonlinear solver. A value
  *  of 0.1 is used so surface species are safely overconverged.
  *
- *  Functions called:
- *  - `ct_dgetrf` -- First half of LAPACK direct solve of a full Matrix
- *  - `ct_dgetrs` -- Second half of LAPACK direct solve of a full matrix.
- *    Returns solution vector in the right-hand-side vector, resid.
+ *  ### Jacobian evaluation:
+ *  Where the InterfaceKinetics objects provide analytic derivatives of the net
+ *  production rates with respect to the species concentrations (see
+ *  InterfaceKinetics::netRatesOfProgress_ddCi), the Jacobian is assembled as a
+ *  sparse matrix and factorized using a sparse LU decomposition. The Jacobian is
+ *  reused across Newton iterations while the residual continues to decrease, for at
+ *  most #m_maxJacAge iterations. Otherwise, for example for coverage-dependent or
+ *  electrochemical reactions, for BULK_DEPOSITION problems, or if the derivative
+ *  settings of the kinetics objects allow approximate derivatives, the Jacobian is
+ *  evaluated by finite differences and factorized as a dense matrix using LAPACK.
  */
 class solveSP
 {
@@ -186,6 +193,16 @@ public:
     int solveSurfProb(int ifunc, double time_scale, double TKelvin,
                       double PGas, double reltol, double abstol);
 
+    //! Number of Jacobian evaluations during the last call to solveSurfProb()
+    /*!
+     * @param analytic  If `true`, count evaluations using analytic derivatives;
+     *     otherwise, count finite difference evaluations.
+     * @since New in %Cantera 3.1.
+     */
+    int nJacEvals(bool analytic) const {
+        return analytic ? m_nJacEvalsAnalytic : m_nJacEvalsFD;
+    }
+
 private:
     //! Printing routine that optionally gets called at the start of every
     //! invocation
@@ -231,16 +248,17 @@ private:
 
     //! Calculate the solution and residual weights
     /*!
+     *  Row sum scaling of the current Jacobian (either #m_sparseJac or #m_Jac) is
+     *  used for the residual weights.
+     *
      *  @param wtSpecies Weights to use for the soln unknowns. These are in
      *      concentration units
      *  @param wtResid    Weights to sue for the residual unknowns.
-     *  @param Jac        Jacobian. Row sum scaling is used for the Jacobian
      *  @param CSolnSP    Solution vector for the surface problem
      *  @param abstol     Absolute error tolerance
      *  @param reltol     Relative error tolerance
      */
-    void calcWeights(double wtSpecies[], double wtResid[],
-                     const Array2D& Jac, const double CSolnSP[],
+    void calcWeights(double wtSpecies[], double wtResid[], const double CSolnSP[],
                      const double abstol, const double reltol);
 
     /**
@@ -304,6 +322,21 @@ private:
                      const double* CSolnSPOld, const bool do_time,
                      const double deltaT);
 
+    //! Evaluate the Jacobian from the analytic derivatives of the net production
+    //! rates of the surface species and factorize it.
+    /*!
+     *  The residual is not evaluated, but the state of the InterfaceKinetics
+     *  objects must correspond to *CSolnSP*, for example from a preceding call to
+     *  fun_eval().
+     *
+     *  @param do_time Calculate a time dependent residual
+     *  @param deltaT  Delta time for time dependent problem.
+     *  @returns `false` if analytic derivatives are not available for one of the
+     *      InterfaceKinetics objects, in which case the finite difference Jacobian
+     *      should be used instead.
+     */
+    bool sparse_jac_eval(const bool do_time, const double deltaT);
+
     //! Vector of interface kinetics objects
     /*!
      * Each of these is associated with one and only one surface phase.
@@ -479,6 +512,42 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Start of the species of each surface phase within the species of each
+    //! InterfaceKinetics object. Element `[isp][jsp]` is the kinetics species index
+    //! of the first species of surface phase `jsp` in kinetics object `isp`, or
+    //! @ref npos if that phase does not participate in the kinetics object.
+    vector<vector<size_t>> m_surfStartKSI;
+
+    //! Sparse Jacobian, used if analytic derivatives are available
+    Eigen::SparseMatrix<double> m_sparseJac;
+
+    //! Sparse LU decomposition of #m_sparseJac
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_sparseSolver;
+
+    //! Triplets used to assemble #m_sparseJac
+    SparseTriplets m_jacTrips;
+
+    //! Flag indicating whether analytic derivatives are available
+    bool m_analyticJac = true;
+
+    //! Number of Newton iterations for which the current sparse Jacobian has been
+    //! used; 0 if no valid Jacobian is available.
+    int m_jacAge = 0;
+
+    //! Maximum number of Newton iterations for which the sparse Jacobian is reused
+    int m_maxJacAge = 5;
+
+    //! Time step used to evaluate the current sparse Jacobian
+    double m_jacDeltaT = 0.0;
+
+    //! Number of finite difference Jacobian evaluations during the last call to
+    //! solveSurfProb()
+    int m_nJacEvalsFD = 0;
+
+    //! Number of analytic Jacobian evaluations during the last call to
+    //! solveSurfProb()
+    int m_nJacEvalsAnalytic = 0;
+
 public:
     int m_ioflag = 0;
 };
@@ -71,6 +71,10 @@ public:
         return static_cast<int>(m_np);
     }
     double sensitivity(size_t k, size_t p) override;
+    void setAdjointCheckpointInterval(int nsteps) override {
+        m_adjointInterval = nsteps;
+    }
+    void integrateAdjoint(const double* lambda, double* sens) override;
 
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
@@ -89,6 +93,13 @@ protected:
 private:
     void sensInit(double t0, FuncEval& func);
 
+    //! Take a single step towards *tout*, storing checkpoints if the adjoint
+    //! module is enabled. Returns the CVODES return flag.
+    int stepForward(double tout);
+
+    //! Set up the backward problem used by integrateAdjoint()
+    void adjointInit();
+
     //! Check whether a CVODES method indicated an error. If so, throw an exception
     //! containing the method name and the error code stashed by the cvodes_err() function.
     void checkError(long flag, const string& ctMethod, const string& cvodesMethod) const;
@@ -132,6 +143,21 @@ private:
     //! Indicates whether the sensitivities stored in m_yS have been updated
     //! for at the current integrator time.
     bool m_sens_ok = false;
+
+    //! @name Adjoint sensitivity analysis
+    //! @{
+
+    //! Number of integrator steps between checkpoints; zero if checkpointing is
+    //! disabled
+    int m_adjointInterval = 0;
+    bool m_adjoint = false; //!< Indicates whether checkpoints are stored
+    int m_nCheckpoints = 0; //!< Number of checkpoints stored by the forward problem
+    int m_whichB = -1; //!< Identifier of the backward problem; -1 if not created
+    N_Vector m_yB = nullptr; //!< Adjoint variables
+    N_Vector m_qB = nullptr; //!< Adjoint sensitivity quadratures
+    void* m_linsolB = nullptr; //!< Linear solver of the backward problem
+    void* m_linsol_matrixB = nullptr; //!< Matrix used by #m_linsolB
+    //! @}
 };
 
 } // namespace
@@ -58,6 +58,38 @@ public:
         throw NotImplementedError("FuncEval::evalDae");
     }
 
+    /**
+     * Evaluate the right-hand side of the adjoint equations,
+     * @f$ \dot{\lambda} = -(\partial F / \partial y)^T \lambda @f$. Called by
+     * the integrator when integrating the adjoint equations backward in time.
+     * @param[in] t time.
+     * @param[in] y solution vector of the forward problem, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] lambdaDot rate of change of the adjoint variables, length neq()
+     * @param[in] p sensitivity parameter vector
+     * @since New in %Cantera 3.1.
+     */
+    virtual void evalAdjoint(double t, double* y, double* lambda, double* lambdaDot,
+                             double* p) {
+        throw NotImplementedError("FuncEval::evalAdjoint");
+    }
+
+    /**
+     * Evaluate the integrand of the adjoint sensitivities,
+     * @f$ -(\partial F / \partial p)^T \lambda @f$, which is integrated backward
+     * in time along with the adjoint equations.
+     * @param[in] t time.
+     * @param[in] y solution vector of the forward problem, length neq()
+     * @param[in] lambda adjoint variables, length neq()
+     * @param[out] qdot integrand for each sensitivity parameter
+     * @param[in] p sensitivity parameter vector
+     * @since New in %Cantera 3.1.
+     */
+    virtual void evalAdjointQuadrature(double t, double* y, double* lambda,
+                                       double* qdot, double* p) {
+        throw NotImplementedError("FuncEval::evalAdjointQuadrature");
+    }
+
     //! Given a vector of length neq(), mark which variables should be
     //! considered algebraic constraints
     virtual void getConstraints(double* constraints) {
@@ -86,6 +118,23 @@ public:
      */
     int evalDaeNoThrow(double t, double* y, double* ydot, double* residual);
 
+    //! Evaluate the right-hand side of the adjoint equations using return code to
+    //! indicate status.
+    /*!
+     * @see evalAdjoint(), evalNoThrow()
+     * @since New in %Cantera 3.1.
+     */
+    int evalAdjointNoThrow(double t, double* y, double* lambda, double* lambdaDot);
+
+    //! Evaluate the integrand of the adjoint sensitivities using return code to
+    //! indicate status.
+    /*!
+     * @see evalAdjointQuadrature(), evalNoThrow()
+     * @since New in %Cantera 3.1.
+     */
+    int evalAdjointQuadratureNoThrow(double t, double* y, double* lambda,
+                                     double* qdot);
+
     /**
      * Evaluate the setup processes for the Jacobian preconditioner.
      * @param[in] t time.
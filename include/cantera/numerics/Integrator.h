@@ -261,6 +261,38 @@ public:
         return 0.0;
     }
 
+    //! Enable storage of checkpoints for a subsequent solution of the adjoint
+    //! equations (see integrateAdjoint()).
+    /*!
+     * @param nsteps  Number of integrator steps between checkpoints; zero disables
+     *     checkpointing. Takes effect at the next call to initialize().
+     * @since New in %Cantera 3.1.
+     */
+    virtual void setAdjointCheckpointInterval(int nsteps) {
+        if (nsteps > 0) {
+            throw NotImplementedError("Integrator::setAdjointCheckpointInterval");
+        }
+    }
+
+    //! Integrate the adjoint equations backward in time.
+    /*!
+     * The adjoint variables @f$ \lambda @f$ satisfy
+     * @f$ d\lambda/dt = -(\partial f / \partial y)^T \lambda @f$ (see
+     * FuncEval::evalAdjoint), and are integrated from the current time of the
+     * integrator back to the initial time, using the forward solution
+     * reconstructed from the checkpoints stored during the forward integration.
+     *
+     * @param[in] lambda  Adjoint variables at the current time; length
+     *     nEquations()
+     * @param[out] sens  Integral of @f$ \lambda^T \partial f / \partial p_i @f$
+     *     from the initial to the current time (see
+     *     FuncEval::evalAdjointQuadrature) for each sensitivity parameter
+     * @since New in %Cantera 3.1.
+     */
+    virtual void integrateAdjoint(const double* lambda, double* sens) {
+        throw NotImplementedError("Integrator::integrateAdjoint");
+    }
+
     //! Get solver stats from integrator
     virtual AnyMap solverStats() const {
         AnyMap stats;
@@ -64,6 +64,20 @@ double trapezoidal(const Eigen::ArrayXd& f, const Eigen::ArrayXd& x);
  */
 double simpson(const Eigen::ArrayXd& f, const Eigen::ArrayXd& x);
 
+//! Quadrature weights corresponding to the composite Simpson's rule implemented by
+//! simpson().
+/*!
+ * The weights @f$ w_i @f$ only depend on the grid, such that the integral of
+ * any function given at the grid points is obtained as @f$ \sum_i w_i f_i @f$.
+ * This allows integrals of many functions on the same grid to be evaluated as a
+ * single matrix-vector product.
+ *
+ * @param  x vector of function coordinate
+ * @ingroup mathUtils
+ * @since New in %Cantera 3.1.
+ */
+Eigen::ArrayXd simpsonWeights(const Eigen::ArrayXd& x);
+
 //! Numerical integration of a function.
 /*!
  * Vector x contains a monotonic sequence of grid points, and
@@ -78,5 +92,16 @@ double simpson(const Eigen::ArrayXd& f, const Eigen::ArrayXd& x);
 double numericalQuadrature(const string& method,
                            const Eigen::ArrayXd& f,
                            const Eigen::ArrayXd& x);
+
+//! Matrix exponential
+/*!
+ * Evaluates @f$ \exp(A) @f$ using a (6,6) Padé approximant with scaling and
+ * squaring.
+ *
+ * @param A  square matrix
+ * @ingroup mathUtils
+ * @since New in %Cantera 3.1.
+ */
+Eigen::MatrixXd expm(const Eigen::MatrixXd& A);
 }
 #endif
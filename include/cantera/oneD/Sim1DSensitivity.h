@@ -0,0 +1,71 @@
+//! @file Sim1DSensitivity.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_SIM1DSENSITIVITY_H
+#define CT_SIM1DSENSITIVITY_H
+
+#include "cantera/kinetics/BruteForceSensitivity.h"
+
+namespace Cantera
+{
+
+class Sim1D;
+
+//! Brute-force sensitivity analysis for one-dimensional flames.
+/*!
+ * Each model copy is created by a user-supplied function, which sets up a Sim1D
+ * object (including its domains and initial guess) using a copy of the Solution
+ * object passed to the constructor. Each perturbed run is started from the
+ * converged solution of the unperturbed model, including its grid, such that a
+ * perturbed solution typically requires only a few Newton iterations.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup onedGroup
+ */
+class Sim1DSensitivity : public BruteForceSensitivity
+{
+public:
+    //! Create a sensitivity analysis for one-dimensional flames.
+    /*!
+     * @param sol  Solution object defining the reaction mechanism and state
+     * @param factory  Function creating a Sim1D object from a copy of *sol*. All
+     *     domains of the Sim1D object should use the Solution object passed to
+     *     this function.
+     */
+    Sim1DSensitivity(shared_ptr<Solution> sol,
+                     function<shared_ptr<Sim1D>(shared_ptr<Solution>)> factory);
+
+    //! Set whether the grid is refined when solving. The default is `true`.
+    void setRefineGrid(bool refine) {
+        m_refine = refine;
+    }
+
+    //! Get whether the grid is refined when solving
+    bool refineGrid() const {
+        return m_refine;
+    }
+
+    //! Add an objective named *name*, which is evaluated from the converged
+    //! solution by the function *objective*
+    void addObjective(const string& name, function<double(Sim1D&)> objective);
+
+    //! Add the flame speed as an objective, defined as the velocity at the first
+    //! grid point of the flow domain named *domain*
+    void addFlameSpeed(const string& domain="flow", const string& name="flame-speed");
+
+protected:
+    class FlameWorker;
+    unique_ptr<Worker> newWorker(shared_ptr<Solution> sol) override;
+
+    //! Function creating model copies
+    function<shared_ptr<Sim1D>(shared_ptr<Solution>)> m_factory;
+
+    bool m_refine = true; //!< Refine the grid when solving
+    vector<function<double(Sim1D&)>> m_objectives; //!< Objective functions
+};
+
+}
+
+#endif
@@ -19,5 +19,6 @@
 #include "oneD/Boundary1D.h"
 #include "oneD/Flow1D.h"
 #include "oneD/refine.h"
+#include "oneD/Sim1DSensitivity.h"
 
 #endif
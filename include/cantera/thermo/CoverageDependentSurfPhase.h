@@ -15,6 +15,7 @@
 
 #include "SurfPhase.h"
 #include "cantera/base/Array.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -419,6 +420,28 @@ protected:
     //! Array of heat capacity coverage dependency parameters.
     vector<HeatCapacityDependency> m_HeatCapacityDependency;
 
+    //! Sparse matrix of the enthalpy coefficients of all linear and polynomial
+    //! dependencies, with one row per target species and columns corresponding
+    //! to the entries of #m_covPowers
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_polyEnthalpy;
+
+    //! Sparse matrix of the entropy coefficients of all linear and polynomial
+    //! dependencies, with the same layout as #m_polyEnthalpy
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_polyEntropy;
+
+    //! Sparse matrices of the heat capacity coefficients @f$ c^{(a)}_{k,j} @f$ and
+    //! @f$ c^{(b)}_{k,j} @f$, with one row per target species and one column per
+    //! interacting species
+    Eigen::SparseMatrix<double, Eigen::RowMajor> m_cpCoeffsA, m_cpCoeffsB;
+
+    //! Temporary storage for the first to fourth powers of the coverages of all
+    //! species
+    mutable vector<double> m_covPowers;
+
+    //! Temporary storage for the products of the heat capacity coefficient
+    //! matrices and the squared coverages
+    mutable vector<double> m_cpCovA, m_cpCovB;
+
 private:
     //! Storage for the user-defined reference state coverage which has to be
     //! greater than 0.0 and less than or equal to 1.0. default = 1.0.
@@ -427,6 +450,11 @@ private:
     //! Last value of the state number processed.
     mutable int m_stateNumlast;
 
+    //! Collect the parameters of linear, polynomial and heat capacity dependencies
+    //! in sparse matrices, such that the corresponding coverage-dependent
+    //! properties of all species are obtained from sparse matrix-vector products.
+    void _buildCovDepMatrices();
+
     //! Update the species coverage-dependent thermodynamic functions.
     /*!
      * The coverage-dependent enthalpy and entropy are only re-evaluated
@@ -0,0 +1,236 @@
+/**
+ * @file EEDFTwoTermApproximation.h
+ * Header for the two-term Boltzmann equation solver used by PlasmaPhase
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_EEDFTWOTERMAPPROXIMATION_H
+#define CT_EEDFTWOTERMAPPROXIMATION_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+//! Solver for the electron energy distribution function (EEDF) based on the
+//! two-term approximation of the Boltzmann equation.
+/*!
+ * The steady-state, spatially homogeneous Boltzmann equation for electrons in a
+ * constant reduced electric field @f$ E/N @f$ is solved using the two-term
+ * approximation described by Hagelaar and Pitchford @cite hagelaar2005. Neglecting
+ * electron-electron collisions and the growth of the electron density, the
+ * isotropic part of the distribution @f$ F_0 @f$ satisfies (Eqns. 45-48 in
+ * @cite hagelaar2005)
+ *   @f[
+ *      \frac{d}{d\epsilon} \left( \tilde{W} F_0 - \tilde{D} \frac{dF_0}{d\epsilon}
+ *      \right) = \tilde{S},
+ *   @f]
+ * with
+ *   @f[
+ *      \tilde{W} = -\epsilon^2 \sigma_\epsilon, \qquad
+ *      \tilde{D} = \frac{1}{3} \left( \frac{E}{N} \right)^2 \frac{\epsilon}{\sigma_m}
+ *          + \frac{k_B T}{e} \epsilon^2 \sigma_\epsilon, \qquad
+ *      \sigma_\epsilon = \sum_k x_k \frac{2 m_e}{M_k} \sigma_{k}^{el}, \qquad
+ *      \sigma_m = \sum_k x_k \sum_j \sigma_{k,j},
+ *   @f]
+ * where the common factor @f$ \sqrt{2 e / m_e} @f$ is omitted, @f$ x_k @f$ is the
+ * mole fraction of target species @f$ k @f$, @f$ \sigma_k^{el} @f$ is its elastic
+ * momentum transfer cross section and @f$ \sigma_m @f$ is the total momentum
+ * transfer cross section including all collision processes.
+ *
+ * Inelastic collisions with threshold energy @f$ u @f$ contribute the source term
+ * @f$ \tilde{S}_j = x_k \left[ (\epsilon + u) \sigma_j(\epsilon + u) F_0(\epsilon + u)
+ * - \epsilon \sigma_j(\epsilon) F_0(\epsilon) \right] @f$. Ionization is treated in
+ * the same way as excitation, neglecting the secondary electron ("conservative"
+ * ionization), while attachment only removes electrons.
+ *
+ * The equation is discretized with a finite volume method on cells centered around
+ * the energy levels, using the exponential scheme of Scharfetter and Gummel for the
+ * fluxes between cells and exact integrals of the piecewise linear cross sections
+ * for the collision terms. Since the equation is linear in @f$ F_0 @f$, the
+ * distribution is obtained from a single sparse linear solve, where the balance of
+ * the last cell is replaced by the normalization condition
+ * @f$ \int_0^\infty \epsilon^{1/2} F_0 d\epsilon = 1 @f$. Contributions that only
+ * depend on the energy grid and the cross sections are evaluated once for each
+ * target species, such that changes of the reduced electric field, temperature or
+ * composition only require assembling and solving the linear system.
+ *
+ * By default, the Boltzmann equation is solved exactly whenever the reduced
+ * electric field, temperature or composition differ from the previous call; only
+ * the most recent distribution is retained. For repeated evaluations during
+ * integrations, distributions can be tabulated on a logarithmic grid of reduced
+ * field strengths and interpolated using setTabulation(). The tabulated values
+ * are then reused until the temperature or composition change by more than a
+ * specified tolerance.
+ *
+ * @since New in %Cantera 3.1.
+ * @warning  This class is an experimental part of %Cantera and may be
+ *           changed or removed without notice.
+ * @ingroup thermoprops
+ */
+class EEDFTwoTermApproximation
+{
+public:
+    EEDFTwoTermApproximation() = default;
+
+    //! Add a collision process
+    /*!
+     * @param target  Index of the target species in the mole fraction vector
+     *     passed to solve()
+     * @param kind  Type of the collision process; one of `elastic`, `excitation`,
+     *     `ionization` or `attachment`
+     * @param massRatio  Ratio of electron mass and mass of the target species
+     * @param threshold  Threshold energy [eV] of inelastic processes
+     * @param energyLevels  Energy levels [eV] of the cross section data
+     * @param crossSections  Cross sections [m^2] at the energy levels
+     */
+    void addCollision(size_t target, const string& kind, double massRatio,
+                      double threshold, const vector<double>& energyLevels,
+                      const vector<double>& crossSections);
+
+    //! Remove all collision processes
+    void clearCollisions();
+
+    //! Number of collision processes
+    size_t nCollisions() const {
+        return m_collisions.size();
+    }
+
+    //! Parameters of a collision process
+    struct Collision
+    {
+        size_t target; //!< Index of target species
+        string kind; //!< Type of collision process
+        double massRatio; //!< Ratio of electron and target mass
+        double threshold; //!< Threshold energy [eV]
+        vector<double> energyLevels; //!< Energy levels of cross section data [eV]
+        vector<double> crossSections; //!< Cross sections [m^2]
+
+        bool operator==(const Collision& other) const {
+            return target == other.target && kind == other.kind
+                && massRatio == other.massRatio && threshold == other.threshold
+                && energyLevels == other.energyLevels
+                && crossSections == other.crossSections;
+        }
+    };
+
+    //! Collision processes added using addCollision()
+    const vector<Collision>& collisions() const {
+        return m_collisions;
+    }
+
+    //! Calculate the electron energy distribution
+    /*!
+     * @param levels  Electron energy levels [eV], which need to be positive and
+     *     monotonically increasing
+     * @param EN  Reduced electric field [V m^2]
+     * @param T  Gas temperature [K]
+     * @param x  Mole fractions of all species, indexed by the target species
+     *     indices specified in addCollision()
+     * @param[out] distribution  Normalized electron energy distribution [eV^-3/2]
+     *     at the energy levels
+     * @returns `false` if the distribution is unchanged since the previous call
+     *     and `true` otherwise.
+     */
+    bool solve(const Eigen::ArrayXd& levels, double EN, double T, const double* x,
+               Eigen::ArrayXd& distribution);
+
+    //! Enable tabulation of distributions by reduced electric field
+    /*!
+     * Distributions are calculated at the grid points @f$ 10^{k/n} @f$ V m^2 that
+     * bracket the requested reduced field, where @f$ n @f$ is the number of points
+     * per decade, and the logarithm of the distribution is interpolated linearly
+     * in the logarithm of the reduced field. Tabulated distributions are discarded
+     * once the temperature changes by more than the relative tolerance @f$ r @f$,
+     * or the mole fraction of a target species by more than @f$ r @f$, compared to
+     * the state used to calculate them.
+     *
+     * @param pointsPerDecade  Number of grid points per decade of the reduced
+     *     field. Tabulation is disabled if the value is zero, which is the default.
+     * @param rtol  Tolerance @f$ r @f$ for changes of temperature and composition
+     */
+    void setTabulation(size_t pointsPerDecade, double rtol=1e-3);
+
+    //! Number of grid points per decade of the reduced field used for tabulation,
+    //! or zero if tabulation is disabled
+    size_t tabulationPointsPerDecade() const {
+        return m_pointsPerDecade;
+    }
+
+protected:
+    //! Evaluate contributions depending only on the energy grid and the cross
+    //! sections
+    void setupGrid(const Eigen::ArrayXd& levels);
+
+    //! Discard grid contributions and tabulated distributions after the collision
+    //! processes have changed
+    void resetGrid();
+
+    //! Assemble and solve the discretized Boltzmann equation
+    /*!
+     * @param EN  Reduced electric field [V m^2]
+     * @param state  Temperature [K] followed by the mole fractions of the species
+     *     in #m_targets
+     */
+    Eigen::VectorXd computeDistribution(double EN, const vector<double>& state);
+
+    //! Tabulated distribution at grid point *k* of the reduced field, which is
+    //! calculated for #m_tableState if it is not available yet
+    const Eigen::VectorXd& tabulated(long k);
+
+    vector<Collision> m_collisions; //!< Collision processes
+
+    //! Energy levels [eV] used for the current grid contributions
+    Eigen::ArrayXd m_levels;
+
+    //! Cell boundaries [eV]. Length: number of energy levels + 1
+    Eigen::ArrayXd m_bounds;
+
+    //! Target species with at least one collision process
+    vector<size_t> m_targets;
+
+    //! Elastic energy loss cross sections @f$ 2 m_e \sigma^{el}_k / M_k @f$ at the
+    //! cell boundaries for each target species in #m_targets
+    vector<Eigen::ArrayXd> m_sigmaEps;
+
+    //! Total momentum transfer cross sections at the cell boundaries for each
+    //! target species in #m_targets
+    vector<Eigen::ArrayXd> m_sigmaM;
+
+    //! Collision source terms of inelastic processes for each target species in
+    //! #m_targets, per unit mole fraction
+    vector<Eigen::SparseMatrix<double>> m_inelastic;
+
+    //! Integrals of @f$ \epsilon^{1/2} @f$ over each cell, used for normalization
+    Eigen::VectorXd m_normWeights;
+
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> m_solver; //!< Linear solver
+
+    //! Number of grid points per decade of the reduced field; zero if tabulation
+    //! is disabled
+    size_t m_pointsPerDecade = 0;
+
+    //! Tolerance for changes of temperature and composition of tabulated
+    //! distributions
+    double m_tableRtol = 1e-3;
+
+    //! Temperature and target species mole fractions of tabulated distributions
+    vector<double> m_tableState;
+
+    //! Tabulated distributions for #m_tableState by index of the grid point of the
+    //! reduced field
+    map<long, Eigen::VectorXd> m_table;
+
+    Eigen::VectorXd m_current; //!< Distribution returned by the previous call
+    double m_currentField = 0.0; //!< Reduced field [V m^2] of #m_current
+
+    //! Temperature and target species mole fractions used for #m_current
+    vector<double> m_currentState;
+};
+
+}
+
+#endif
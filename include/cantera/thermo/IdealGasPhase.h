@@ -12,6 +12,7 @@
 #define CT_IDEALGASPHASE_H
 
 #include "ThermoPhase.h"
+#include "cantera/base/Array.h"
 
 namespace Cantera
 {
@@ -375,6 +376,37 @@ public:
         setTemperature(p * meanMolecularWeight() / (GasConstant * rho));
     }
 
+    //! Set the specific enthalpy (J/kg) and pressure (Pa) at constant
+    //! composition.
+    /*!
+     * If all species use the 7-coefficient NASA polynomial parameterization,
+     * the temperature is found by Newton iteration on a single polynomial for
+     * the mixture enthalpy, formed by weighting the species coefficients with
+     * the mass fractions. The cost of each iteration is then independent of
+     * the number of species. Otherwise, or if this iteration does not
+     * converge to a temperature within the valid range, the general
+     * ThermoPhase::setState_HP() method is used.
+     *
+     * @param h   Specific enthalpy (J/kg)
+     * @param p   Pressure (Pa)
+     * @param tol Relative tolerance on the temperature
+     * @since New in %Cantera 3.1.
+     */
+    void setState_HP(double h, double p, double tol=1e-9) override;
+
+    //! Set the specific internal energy (J/kg) and specific volume (m^3/kg) at
+    //! constant composition.
+    /*!
+     * Uses the mixture polynomial method described for setState_HP() when
+     * possible.
+     *
+     * @param u   Specific internal energy (J/kg)
+     * @param v   Specific volume (m^3/kg)
+     * @param tol Relative tolerance on the temperature
+     * @since New in %Cantera 3.1.
+     */
+    void setState_UV(double u, double v, double tol=1e-9) override;
+
     //! Returns the isothermal compressibility. Units: 1/Pa.
     /**
      * The isothermal compressibility is defined as
@@ -551,6 +583,7 @@ public:
 
     bool addSpecies(shared_ptr<Species> spec) override;
     void setToEquilState(const double* mu_RT) override;
+    void invalidateCache() override;
 
 protected:
     //! Reference state pressure
@@ -590,6 +623,34 @@ protected:
      *  (or equivalent) call is made.
      */
     virtual void updateThermo() const;
+
+    //! Find the temperature at which the specific enthalpy (or internal energy)
+    //! of the current mixture is equal to *h*, using the mixture NASA
+    //! polynomial. Returns `false` if not all species use 7-coefficient NASA
+    //! polynomials or if the iteration does not converge to a temperature
+    //! within the valid range.
+    bool solveMixturePoly(double h, double tol, bool doUV, double& T) const;
+
+    //! Collect the NASA polynomial coefficients of all species for use by
+    //! solveMixturePoly().
+    void updateNasaTable() const;
+
+    //! True if #m_nasaMidT and #m_nasaCoeffs are up to date with the species
+    //! thermo data
+    mutable bool m_nasaTableValid = false;
+
+    //! True if all species use 7-coefficient NASA polynomials
+    mutable bool m_nasaTableUsable = false;
+
+    //! Sorted, distinct midpoint temperatures of the species NASA polynomials.
+    //! These divide the temperature range into intervals where each species is
+    //! described by a single polynomial.
+    mutable vector<double> m_nasaMidT;
+
+    //! NASA polynomial coefficients of each species in each temperature
+    //! interval. `m_nasaCoeffs(7*i + j, k)` is coefficient `j` of species `k`
+    //! in interval `i`.
+    mutable Array2D m_nasaCoeffs;
 };
 
 }
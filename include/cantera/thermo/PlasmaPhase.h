@@ -10,6 +10,7 @@
 #define CT_PLASMAPHASE_H
 
 #include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/EEDFTwoTermApproximation.h"
 #include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
@@ -18,7 +19,7 @@ namespace Cantera
 /**
  * Base class for a phase with plasma properties. This class manages the
  * plasma properties such as electron energy distribution function (EEDF).
- * There are two ways to define the electron distribution and electron
+ * There are three ways to define the electron distribution and electron
  * temperature. The first method uses setElectronTemperature() to set
  * the electron temperature which is used to calculate the electron energy
  * distribution with isotropic-velocity model. The generalized electron
@@ -44,14 +45,24 @@ namespace Cantera
  *   @f]
  * where @f$ i @f$ is the index of energy levels.
  *
+ * The third method calculates the electron energy distribution from the
+ * two-term approximation of the Boltzmann equation at the reduced electric field
+ * set using setReducedElectricField(), using the cross sections of the
+ * electron-collision-plasma reactions of the kinetics manager of the Solution
+ * that holds this phase (see EEDFTwoTermApproximation). After changes of the reduced
+ * electric field, temperature, composition or energy levels, the distribution is
+ * recalculated when it is next used, and the electron temperature is calculated
+ * from the mean electron energy of the distribution. For repeated evaluations, for
+ * example during reactor integrations, the distribution can instead be interpolated
+ * between tabulated reduced field strengths; see
+ * setElectronEnergyDistributionTabulation().
+ *
  * For references, see Gudmundsson @cite gudmundsson2001; Khalilpour and Foroutan
  * @cite khalilpour2020; Hagelaar and Pitchford @cite hagelaar2005, and BOLOS
  * @cite BOLOS.
  *
  * @warning  This class is an experimental part of %Cantera and may be
  *           changed or removed without notice.
- * @todo Implement electron Boltzmann equation solver to solve EEDF.
- *       https://github.com/Cantera/enhancements/issues/127
  * @ingroup thermoprops
  */
 class PlasmaPhase: public IdealGasPhase
@@ -71,6 +82,8 @@ public:
      */
     explicit PlasmaPhase(const string& inputFile="", const string& id="");
 
+    ~PlasmaPhase();
+
     string type() const override {
         return "plasma";
     }
@@ -110,6 +123,9 @@ public:
     //! @param  distrb The vector of electron energy distribution.
     //!                Length: #m_nPoints.
     void getElectronEnergyDistribution(double* distrb) const {
+        if (m_eedfStale) {
+            updateStaleElectronEnergyDistribution();
+        }
         Eigen::Map<Eigen::ArrayXd>(distrb, m_nPoints) = m_electronEnergyDist;
     }
 
@@ -140,6 +156,46 @@ public:
     //! Set electron energy distribution type
     void setElectronEnergyDistributionType(const string& type);
 
+    //! Set the reduced electric field [V m^2] used to calculate the electron energy
+    //! distribution of type `Boltzmann-two-term`. Note that 1 Td = 1e-21 V m^2.
+    //! @since New in %Cantera 3.1.
+    void setReducedElectricField(double EN);
+
+    //! Reduced electric field [V m^2]
+    //! @since New in %Cantera 3.1.
+    double reducedElectricField() const {
+        return m_reducedElectricField;
+    }
+
+    //! Enable tabulation of the electron energy distribution of type
+    //! `Boltzmann-two-term` by reduced electric field.
+    //! @param pointsPerDecade  Number of tabulated reduced field strengths per
+    //!     decade; tabulation is disabled if the value is zero
+    //! @param rtol  Tolerance for changes of temperature and composition before
+    //!     tabulated distributions are recalculated
+    //! @see EEDFTwoTermApproximation::setTabulation
+    //! @since New in %Cantera 3.1.
+    void setElectronEnergyDistributionTabulation(size_t pointsPerDecade,
+                                                 double rtol=1e-3);
+
+    //! Update the collision processes used by the Boltzmann equation solver from
+    //! the electron-collision-plasma reactions of the associated kinetics manager.
+    /*!
+     * Each reaction is classified by the number of electrons among its products:
+     * reactions without electrons are treated as attachment, reactions with
+     * identical reactants and products as elastic collisions, other reactions with
+     * one electron as excitation and reactions producing more than one electron as
+     * ionization. The threshold energy of inelastic processes is the first energy
+     * level of the cross section data.
+     *
+     * This method is called automatically when the kinetics manager of the
+     * associated Solution object is replaced and before the distribution is
+     * recalculated. The cross section data of the reactions are compared to the
+     * current collision processes, which are only replaced if the data changed.
+     * @since New in %Cantera 3.1.
+     */
+    void setCollisions();
+
     //! Numerical quadrature method. Method: #m_quadratureMethod
     string quadratureMethod() const {
         return m_quadratureMethod;
@@ -170,9 +226,16 @@ public:
 
     bool addSpecies(shared_ptr<Species> spec) override;
 
+    void setTemperature(double temp) override;
+
+    void setSolution(std::weak_ptr<Solution> soln) override;
+
     //! Electron Temperature (K)
     //!     @return The electron temperature of the phase
     double electronTemperature() const override {
+        if (m_eedfStale) {
+            updateStaleElectronEnergyDistribution();
+        }
         return m_electronTemp;
     }
 
@@ -263,6 +326,9 @@ public:
 
     //! Return the distribution Number #m_distNum
     int distributionNumber() const {
+        if (m_eedfStale) {
+            updateStaleElectronEnergyDistribution();
+        }
         return m_distNum;
     }
 
@@ -274,6 +340,8 @@ public:
 protected:
     void updateThermo() const override;
 
+    void compositionChanged() override;
+
     //! When electron energy distribution changed, plasma properties such as
     //! electron-collision reaction rates need to be re-evaluated.
     void electronEnergyDistributionChanged();
@@ -310,6 +378,16 @@ protected:
     //! Set isotropic electron energy distribution
     void setIsotropicElectronEnergyDistribution();
 
+    //! Calculate the electron energy distribution from the two-term approximation
+    //! of the Boltzmann equation.
+    //! @returns `false` if the distribution is unchanged and `true` otherwise
+    bool setTwoTermElectronEnergyDistribution();
+
+    //! Recalculate the electron energy distribution of type `Boltzmann-two-term`
+    //! if it is outdated. Called by accessors of the distribution and the
+    //! electron temperature.
+    void updateStaleElectronEnergyDistribution() const;
+
     //! Update electron temperature (K) From energy distribution.
     //! #m_electronTemp
     void updateElectronTemperatureFromEnergyDist();
@@ -345,6 +423,16 @@ protected:
     //! Flag of normalizing electron energy distribution
     bool m_do_normalizeElectronEnergyDist = true;
 
+    //! Reduced electric field [V m^2]
+    double m_reducedElectricField = 0.0;
+
+    //! Solver for the two-term approximation of the Boltzmann equation
+    EEDFTwoTermApproximation m_eedfSolver;
+
+    //! Flag indicating that the state has changed since the `Boltzmann-two-term`
+    //! electron energy distribution was last calculated
+    bool m_eedfStale = false;
+
 private:
     //! Electron energy distribution change variable. Whenever
     //! #m_electronEnergyDist changes, this int is incremented.
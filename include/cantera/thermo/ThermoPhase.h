@@ -19,6 +19,8 @@
 namespace Cantera
 {
 
+class ChemEquil;
+
 /**
  * @defgroup thermoprops Thermodynamic Properties
  *
@@ -1649,6 +1651,24 @@ public:
                      double rtol=1e-9, int max_steps=50000, int max_iter=100,
                      int estimate_equil=0, int log_level=0);
 
+    //! Set the tolerance for reusing the element potentials from the previous
+    //! call to equilibrate().
+    /*!
+     * The element potential solver used by equilibrate() is retained between
+     * calls, along with its component basis and the element potentials of the
+     * last solution. These element potentials are used as the starting estimate
+     * if the element mole fractions and the logarithm of the pressure each differ
+     * by less than *tol* from the initial state of the previous call, which
+     * typically reduces the solution to a few Newton iterations. If the solver
+     * fails to converge from this estimate, the default starting estimate is
+     * used. The default is zero, which disables reuse. A tolerance of 0.05 is
+     * suitable for sequences of closely spaced states, such as parameter sweeps.
+     *
+     * @see ChemEquil::setReuseTolerance
+     * @since New in %Cantera 3.1.
+     */
+    void setEquilibriumReuseTolerance(double tol);
+
     //!This method is used by the ChemEquil equilibrium solver.
     /*!
      * It sets the state such that the chemical potentials satisfy
@@ -1846,6 +1866,15 @@ public:
 
     void invalidateCache() override;
 
+    //! Set the link to the Solution object that owns this ThermoPhase. Phase models
+    //! that depend on other objects held by the Solution, such as the kinetics
+    //! manager, can override this method to register for changes.
+    //! @param soln  Weak pointer to the parent Solution object
+    //! @since New in %Cantera 3.1.
+    virtual void setSolution(std::weak_ptr<Solution> soln) {
+        m_soln = soln;
+    }
+
     //! @}
     //! @name  Derivatives of Thermodynamic Variables needed for Applications
     //!
@@ -1993,6 +2022,15 @@ protected:
 
     //! last value of the temperature processed by reference state
     mutable double m_tlast = 0.0;
+
+    //! Element potential solver retained between calls to equilibrate()
+    shared_ptr<ChemEquil> m_chemEquil;
+
+    //! Tolerance for reusing the last solution of #m_chemEquil
+    double m_equilReuseTol = 0.0;
+
+    //! reference to Solution
+    std::weak_ptr<Solution> m_soln;
 };
 
 }
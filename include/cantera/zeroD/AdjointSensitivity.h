@@ -0,0 +1,140 @@
+//! @file AdjointSensitivity.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ADJOINTSENSITIVITY_H
+#define CT_ADJOINTSENSITIVITY_H
+
+#include "cantera/base/AnyMap.h"
+
+namespace Cantera
+{
+
+class ReactorNet;
+
+//! Adjoint sensitivity analysis for a ReactorNet.
+/*!
+ * Evaluates the sensitivities of a scalar objective @f$ G = g(y(t_f)) @f$ with
+ * respect to all sensitivity parameters registered with the reactor network (for
+ * example using Reactor::addSensitivityReaction) with a single forward and a
+ * single backward pass. The adjoint variables @f$ \lambda @f$ satisfy
+ *
+ * @f[
+ *     \frac{d\lambda}{dt} = -J^T \lambda, \qquad
+ *     \lambda(t_f) = \frac{\partial g}{\partial y}(t_f)
+ * @f]
+ *
+ * and the sensitivities are obtained from the quadrature
+ *
+ * @f[
+ *     \frac{dG}{dp} = \int_{t_0}^{t_f} \lambda^T \frac{\partial f}{\partial p} dt
+ * @f]
+ *
+ * where @f$ J = \partial f / \partial y @f$ is the Jacobian of the reactor network.
+ *
+ * The adjoint problem is solved using the adjoint module of CVODES. During the
+ * forward pass, CVODES stores checkpoints separated by a fixed number of integrator
+ * steps. During the backward pass, the forward solution between consecutive
+ * checkpoints is recomputed and interpolated, while the adjoint equations and the
+ * quadrature are integrated with the same implicit method used for the forward
+ * problem (see ReactorNet::solveAdjoint).
+ *
+ * The Jacobian is evaluated by finite differences, costing neq() evaluations of
+ * the right hand side for each forward state visited by the backward integrator,
+ * and is factorized only when the backward integrator updates its Newton matrix.
+ * The integrand @f$ \lambda^T \partial f / \partial p @f$ is evaluated using
+ * ReactorNet::evalSensitivityAdjoint, which handles all reaction rate multipliers
+ * of the homogeneous phase in a single pass, so the cost for these parameters does
+ * not grow with their number. Other parameters, such as species enthalpies, are
+ * handled by finite differences and require one additional evaluation of the right
+ * hand side per parameter at each quadrature point.
+ *
+ * Integrating the forward sensitivity equations (see
+ * ReactorNet::setForwardSensitivities) is disabled during the forward pass, and
+ * the previous setting is restored afterwards. Networks solved using a DAE
+ * integrator are not supported.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup zerodGroup
+ */
+class AdjointSensitivity
+{
+public:
+    //! Create an adjoint sensitivity solver for the reactor network *net*. The
+    //! network must not be destroyed before this object.
+    AdjointSensitivity(ReactorNet& net);
+
+    //! Set the number of integrator steps between checkpoints of the forward pass.
+    //! Larger values reduce the memory required for checkpoints, while smaller
+    //! values reduce the memory required to store the recomputed solution within
+    //! each interval during the backward pass. Takes effect at the next call to
+    //! integrate().
+    void setCheckpointInterval(size_t nsteps);
+
+    //! Get the number of integrator steps between checkpoints.
+    size_t checkpointInterval() const {
+        return m_interval;
+    }
+
+    //! Integrate the reactor network from its current state to time *tf*, storing
+    //! checkpoints for the backward pass. After this call, the state of the
+    //! network corresponds to time *tf*. The checkpoints are discarded once the
+    //! network is advanced further or reinitialized.
+    void integrate(double tf);
+
+    //! Evaluate sensitivities of the objective @f$ G = g(y(t_f)) @f$ with respect
+    //! to each sensitivity parameter of the network.
+    /*!
+     * @param dgdy  Gradient of the objective with respect to the global state
+     *     vector at the final time of the forward pass; length ReactorNet::neq()
+     * @returns  @f$ dG/dp_i @f$ for each sensitivity parameter
+     */
+    vector<double> solve(const vector<double>& dgdy);
+
+    //! Sensitivities of the component named *component* in reactor *reactor* at
+    //! the final time of the forward pass, normalized in the same way as
+    //! ReactorNet::sensitivity.
+    vector<double> sensitivities(const string& component, int reactor=0);
+
+    //! Sensitivities of the final time of the forward pass, considered as the
+    //! time at which the component named *component* in reactor *reactor* reaches
+    //! its final value, normalized by the duration of the forward pass.
+    /*!
+     * This can be used to evaluate ignition delay sensitivities by integrating
+     * up to the time where the temperature reaches a threshold value. The
+     * sensitivity is evaluated as
+     * @f[
+     *     \frac{1}{t_f - t_0} \frac{d t_f}{d p_i} = -\frac{1}{t_f - t_0}
+     *     \frac{\partial y_k / \partial p_i}{dy_k / dt}
+     * @f]
+     */
+    vector<double> eventTimeSensitivities(const string& component, int reactor=0);
+
+    //! Statistics for the last forward and backward passes.
+    /*!
+     * The returned map contains the number of `checkpoints` stored during the
+     * forward pass, the number of integrator steps in the forward pass
+     * (`forward_steps`), and the number of steps of the last backward pass
+     * (`backward_steps`).
+     */
+    AnyMap stats() const;
+
+protected:
+    //! Restore the state of the network at the final time of the forward pass
+    void restoreFinalState();
+
+    ReactorNet& m_net;
+    size_t m_interval = 50; //!< Number of integrator steps between checkpoints
+
+    double m_t0 = NAN; //!< Initial time of the forward pass
+    double m_tf = NAN; //!< Final time of the forward pass
+    vector<double> m_yFinal; //!< State at the final time of the forward pass
+    AnyMap m_forwardStats; //!< Integrator statistics after the forward pass
+    AnyMap m_backwardStats; //!< Integrator statistics after the backward pass
+    vector<double> m_work; //!< Work array for state vectors
+};
+
+}
+
+#endif
@@ -39,6 +39,8 @@ public:
     void updateState(double* y) override;
 
 protected:
+    bool getProductionRateAdjoint(const double* lambda, double* mu) override;
+
     const size_t m_sidx = 1;
 };
 
@@ -42,6 +42,9 @@ public:
     //! species.
     size_t componentIndex(const string& nm) const override;
     string componentName(size_t k) override;
+
+protected:
+    bool getProductionRateAdjoint(const double* lambda, double* mu) override;
 };
 
 }
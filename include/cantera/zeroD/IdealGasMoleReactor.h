@@ -49,6 +49,7 @@ public:
 
 protected:
     void setThermo(ThermoPhase& thermo) override;
+    bool getProductionRateAdjoint(const double* lambda, double* mu) override;
 
     vector<double> m_uk; //!< Species molar internal energies
 };
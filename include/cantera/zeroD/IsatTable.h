@@ -0,0 +1,144 @@
+//! @file IsatTable.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_ISATTABLE_H
+#define CT_ISATTABLE_H
+
+#include "cantera/base/AnyMap.h"
+#include "cantera/numerics/eigen_dense.h"
+
+namespace Cantera
+{
+
+class ReactorNet;
+
+//! In situ adaptive tabulation (ISAT) of the reaction mapping of a ReactorNet.
+/*!
+ * The reaction mapping @f$ R(x) @f$ is the state of the reactor network (as
+ * returned by ReactorNet::getState) obtained by integrating the network from an
+ * initial state @f$ x @f$ over a fixed interval @f$ \Delta t @f$. Each table
+ * record stores an initial state @f$ x_0 @f$, the mapping @f$ R(x_0) @f$, the
+ * mapping gradient @f$ A = \partial R / \partial x @f$ and an ellipsoid of
+ * accuracy (EOA). Queries falling inside the EOA of a record are retrieved using
+ * the linear approximation @f$ R(x) \approx R(x_0) + A (x - x_0) @f$; all other
+ * queries are integrated directly, after which the EOA of the nearest record is
+ * grown or a new record is added. Records are located using a binary tree of
+ * cutting planes, and the least recently used record is removed once the
+ * maximum table size is reached.
+ *
+ * The mapping gradient is approximated by the matrix exponential
+ * @f$ A = \exp(J \Delta t) @f$ of the Jacobian @f$ J @f$ evaluated at
+ * @f$ x_0 @f$ by ReactorNet::evalJacobian.
+ *
+ * Errors are measured in the 2-norm of the state vector after dividing each
+ * component by the corresponding scale factor (see setScales()).
+ *
+ * Reference: S. B. Pope. Computationally efficient implementation of combustion
+ * chemistry using in situ adaptive tabulation. *Combustion Theory and
+ * Modelling* 1:41-63, 1997.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup zerodGroup
+ */
+class IsatTable
+{
+public:
+    //! Create a table for the reactor network *net*. The network must not be
+    //! destroyed before the table.
+    IsatTable(ReactorNet& net);
+    ~IsatTable();
+    IsatTable(const IsatTable&) = delete;
+    IsatTable& operator=(const IsatTable&) = delete;
+
+    //! Advance the reactor network by *dt* from its current state, using a
+    //! tabulated result if possible. Changing *dt* between calls clears the
+    //! table. Returns the time at the end of the interval.
+    double advance(double dt);
+
+    //! Set the error tolerance used for retrieving and growing records.
+    void setTolerance(double tol);
+
+    //! Get the error tolerance.
+    double tolerance() const {
+        return m_tol;
+    }
+
+    //! Set the maximum number of records held by the table.
+    void setMaxSize(size_t nmax);
+
+    //! Get the maximum number of records held by the table.
+    size_t maxSize() const {
+        return m_maxSize;
+    }
+
+    //! Set the scale factors used for each component of the state vector.
+    /*!
+     * If not set, the scale factors are taken as `max(|x_i|, 1)` for the state
+     * of the first query after the table was created or cleared, so that errors
+     * in mass fractions are absolute and errors in extensive quantities are
+     * relative.
+     */
+    void setScales(const vector<double>& scales);
+
+    //! Number of records currently held by the table.
+    size_t size() const {
+        return m_records.size();
+    }
+
+    //! Remove all records and reset retrieval statistics.
+    void clear();
+
+    //! Retrieval statistics.
+    /*!
+     * The returned map contains the number of `queries`, `retrieves` (linear
+     * approximations), `grows` (EOA updates), `adds` (new records), `direct_evals`
+     * (direct integrations), `evictions` (records removed because the table was
+     * full) and the current table `size`.
+     */
+    AnyMap stats() const;
+
+protected:
+    struct Record;
+    struct Node;
+
+    //! Find the leaf of the binary tree closest to the scaled state *z*
+    Node* findLeaf(const Eigen::VectorXd& z) const;
+
+    //! Integrate the network directly from its current state over the tabulated
+    //! interval, storing the result in *r*
+    void integrate(Eigen::VectorXd& r);
+
+    //! Add a record for state *x* with mapping *r*, splitting the leaf *leaf*
+    void addRecord(const Eigen::VectorXd& x, const Eigen::VectorXd& r, Node* leaf);
+
+    //! Remove the least recently used record
+    void evict();
+
+    ReactorNet& m_net;
+
+    double m_tol = 1e-4; //!< Error tolerance
+    size_t m_maxSize = 50000; //!< Maximum number of records
+    double m_dt = -1.0; //!< Integration interval of the tabulated mapping
+
+    //! Inverse scale factors for each component of the state vector
+    Eigen::VectorXd m_wt;
+    bool m_userScales = false; //!< Indicates whether scales were set by the user
+
+    vector<unique_ptr<Record>> m_records;
+    unique_ptr<Node> m_root;
+    size_t m_clock = 0; //!< Counter used to identify the least recently used record
+
+    //! Retrieval statistics
+    size_t m_nQuery = 0;
+    size_t m_nRetrieve = 0;
+    size_t m_nGrow = 0;
+    size_t m_nAdd = 0;
+    size_t m_nDirect = 0;
+    size_t m_nEvict = 0;
+};
+
+}
+
+#endif
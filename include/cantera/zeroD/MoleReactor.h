@@ -58,6 +58,8 @@ protected:
 
     void getSurfaceInitialConditions(double* y) override;
 
+    bool getProductionRateAdjoint(const double* lambda, double* mu) override;
+
     //! const value for the species start index
     const size_t m_sidx = 2;
 };
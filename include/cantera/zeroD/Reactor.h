@@ -90,6 +90,13 @@ public:
         return m_chem;
     }
 
+    //! Return a pointer to the Kinetics object for homogeneous reactions, or
+    //! `nullptr` if reactions are disabled.
+    //! @since New in %Cantera 3.1.
+    Kinetics* kinetics() {
+        return m_chem ? m_kin : nullptr;
+    }
+
     void setEnergy(int eflag=1) override {
         if (eflag > 0) {
             m_energy = true;
@@ -232,6 +239,28 @@ public:
     //! Reset the reaction rate multipliers
     virtual void resetSensitivity(double* params);
 
+    //! Evaluate the derivatives of the governing equations with respect to the
+    //! reaction rate multipliers of this reactor, premultiplied by adjoint variables.
+    /*!
+     * Since each multiplier scales the net rate of progress of a single reaction,
+     * all derivatives are obtained in a single pass from the net rates of progress
+     * and the stoichiometric coefficients. Must be called after eval() at the
+     * current state.
+     *
+     * @param[in] lambda  Adjoint variables for the components of this reactor,
+     *     divided by the coefficients on the left hand side of the corresponding
+     *     governing equations
+     * @param[out] dfdp  Derivatives with respect to all sensitivity parameters of
+     *     the reactor network. Only entries flagged in *handled* are set.
+     * @param[out] handled  Flags for the entries of *dfdp* evaluated by this method.
+     *     Entries for parameters that are not reaction rate multipliers of this
+     *     reactor, or for reactor types where this is not implemented, are left
+     *     unchanged.
+     * @since New in %Cantera 3.1.
+     */
+    void getSensitivityAdjoint(const double* lambda, double* dfdp,
+                               vector<bool>& handled);
+
     //! Return a false if preconditioning is not supported or true otherwise.
     //!
     //! @warning  This method is an experimental part of the %Cantera
@@ -279,6 +308,15 @@ protected:
     //! Get initial conditions for SurfPhase objects attached to this reactor
     virtual void getSurfaceInitialConditions(double* y);
 
+    //! Get the derivatives of the right hand side of the governing equations with
+    //! respect to the net production rates of the homogeneous phase species,
+    //! premultiplied by *lambda*.
+    //! @param[in] lambda  Adjoint variables; see getSensitivityAdjoint()
+    //! @param[out] mu  Length #m_nsp
+    //! @returns  `false` if this is not implemented for the reactor type
+    //! @since New in %Cantera 3.1.
+    virtual bool getProductionRateAdjoint(const double* lambda, double* mu);
+
     //! Pointer to the homogeneous Kinetics object that handles the reactions
     Kinetics* m_kin = nullptr;
 
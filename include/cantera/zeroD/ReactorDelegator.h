@@ -160,6 +160,11 @@ public:
         return m_speciesIndex(nm);
     }
 
+    bool getProductionRateAdjoint(const double* lambda, double* mu) override {
+        // The governing equations may be modified by the delegates
+        return false;
+    }
+
     // Public access to protected Reactor variables needed by derived classes
 
     void setNEq(size_t n) override {
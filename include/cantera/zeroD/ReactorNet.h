@@ -8,14 +8,16 @@
 
 #include "Reactor.h"
 #include "cantera/numerics/FuncEval.h"
+#include "cantera/base/AnyMap.h"
+#include "cantera/base/Array.h"
 
 
 namespace Cantera
 {
 
-class Array2D;
 class Integrator;
 class PreconditionerBase;
+class MechanismReducer;
 
 //! A class representing a network of connected reactors.
 /*!
@@ -78,6 +80,19 @@ public:
     //! sensitivity equations.
     void setSensitivityTolerances(double rtol, double atol);
 
+    //! Enable or disable the integration of forward sensitivities for the
+    //! registered sensitivity parameters. Forward sensitivities are enabled by
+    //! default, and are not needed if sensitivities are evaluated using
+    //! AdjointSensitivity.
+    //! @since New in %Cantera 3.1.
+    void setForwardSensitivities(bool enabled);
+
+    //! Indicates whether forward sensitivities are integrated
+    //! @since New in %Cantera 3.1.
+    bool forwardSensitivities() const {
+        return m_forwardSens;
+    }
+
     //! Current value of the simulation time [s], for reactor networks that are solved
     //! in the time domain.
     double time();
@@ -204,6 +219,54 @@ public:
     void evalJacobian(double t, double* y,
                       double* ydot, double* p, Array2D* j);
 
+    //! Evaluate the derivatives of the right hand side with respect to each
+    //! sensitivity parameter, premultiplied by the adjoint variables *lambda*.
+    /*!
+     * Derivatives with respect to reaction rate multipliers of the homogeneous
+     * phase are evaluated in a single pass (see Reactor::getSensitivityAdjoint).
+     * Finite differences, requiring one evaluation of the right hand side each, are
+     * used for other parameters, such as species enthalpies and surface reaction
+     * rate multipliers.
+     *
+     *  @param[in] t Time/distance at which to evaluate the derivatives
+     *  @param[in] y Global state vector at *t*
+     *  @param[in] p Sensitivity parameter vector
+     *  @param[in] lambda Adjoint variables; length neq()
+     *  @param[out] dfdp @f$ \lambda^T \partial f / \partial p_i @f$ for each
+     *      sensitivity parameter
+     *  @since New in %Cantera 3.1.
+     */
+    void evalSensitivityAdjoint(double t, double* y, double* p, const double* lambda,
+                                double* dfdp);
+
+    //! Set the number of integrator steps between checkpoints stored for a
+    //! subsequent call to solveAdjoint(). A value of zero (the default) disables
+    //! checkpointing. Takes effect when the integrator is next initialized.
+    //! @since New in %Cantera 3.1.
+    void setAdjointCheckpointInterval(int nsteps);
+
+    //! Integrate the adjoint equations backward from the current time to the time
+    //! at which the integrator was last initialized, using the checkpoints stored
+    //! during the forward integration (see setAdjointCheckpointInterval).
+    /*!
+     *  @param[in] lambda Adjoint variables at the current time, corresponding to the
+     *      gradient of an objective with respect to the global state vector; length
+     *      neq()
+     *  @param[out] sens Integral of @f$ \lambda^T \partial f / \partial p_i @f$
+     *      for each sensitivity parameter
+     *  @since New in %Cantera 3.1.
+     */
+    void solveAdjoint(const double* lambda, double* sens);
+
+    //! Evaluate the right hand side of the adjoint equations. The Jacobian is
+    //! evaluated by finite differences and reused as long as *t* and *y* do not
+    //! change, which is the case for most evaluations by the integrator.
+    void evalAdjoint(double t, double* y, double* lambda, double* lambdaDot,
+                     double* p) override;
+
+    void evalAdjointQuadrature(double t, double* y, double* lambda, double* qdot,
+                               double* p) override;
+
     // overloaded methods of class FuncEval
     size_t neq() const override {
         return m_nv;
@@ -228,7 +291,7 @@ public:
     void getConstraints(double* constraints) override;
 
     size_t nparams() const override {
-        return m_sens_params.size();
+        return m_forwardSens ? m_sens_params.size() : 0;
     }
 
     //! Return the index corresponding to the component named *component* in the
@@ -299,6 +362,39 @@ public:
     //! @param settings the settings map propagated to all reactors and kinetics objects
     virtual void setDerivativeSettings(AnyMap& settings);
 
+    //! Enable dynamic adaptive chemistry.
+    /*!
+     * The homogeneous reaction mechanism of each reactor is reduced using a
+     * MechanismReducer, based on the state at the start of each call to advance()
+     * or step(), and again whenever the independent variable has increased by the
+     * specified interval. The reduced mechanism is used for integration until the
+     * next update, and the complete mechanism is restored before advance() or
+     * step() return. Supported settings are:
+     *
+     * - `targets`: list of target species names (required)
+     * - `threshold`: species importance threshold; default 1e-3
+     * - `method`: reduction method; either `DRGEP` (default) or `DRG`
+     * - `interval`: interval of the independent variable between updates of the
+     *   reduced mechanism during advance(); default 0, which updates the reduced
+     *   mechanism only at the start of each call.
+     *
+     * An empty map disables adaptive chemistry.
+     *
+     * @since New in %Cantera 3.1.
+     */
+    void setAdaptiveChemistry(const AnyMap& settings);
+
+    //! Statistics for dynamic adaptive chemistry.
+    /*!
+     * The returned map contains the number of `updates` of the reduced mechanisms,
+     * the number of integrator `reinitializations` caused by changes of the
+     * reduced mechanisms, and lists of the numbers of `active_species` and
+     * `active_reactions` in each reactor after the last update.
+     *
+     * @since New in %Cantera 3.1.
+     */
+    AnyMap adaptiveChemistryStats() const;
+
 protected:
     //! Check that preconditioning is supported by all reactors in the network
     virtual void checkPreconditionerSupported() const;
@@ -308,6 +404,14 @@ protected:
     //! Create reproducible names for reactors and walls/connectors.
     void updateNames(Reactor& r);
 
+    //! Apply the reduced mechanisms for adaptive chemistry. If *update* is `true`,
+    //! the reduced mechanisms are first updated for the current state. Returns
+    //! `true` if the reduced mechanism of any reactor changed.
+    bool applyReduction(bool update);
+
+    //! Restore the complete mechanisms after applyReduction()
+    void restoreReduction();
+
     //! Estimate a future state based on current derivatives.
     //! The function is intended for internal use by ReactorNet::advance
     //! and deliberately not exposed in external interfaces.
@@ -341,6 +445,15 @@ protected:
     double m_rtolsens = 1.0e-4;
     double m_atols = 1.0e-15;
     double m_atolsens = 1.0e-6;
+    bool m_forwardSens = true; //!< Integrate forward sensitivities
+    int m_adjointInterval = 0; //!< Integrator steps between adjoint checkpoints
+
+    //! Jacobian used by evalAdjoint, evaluated at #m_adjointTime and
+    //! #m_adjointState
+    Array2D m_adjointJac;
+    double m_adjointTime = NAN; //!< Time at which #m_adjointJac was evaluated
+    vector<double> m_adjointState; //!< State at which #m_adjointJac was evaluated
+    vector<double> m_adjointWork; //!< Work array for evaluating #m_adjointJac
     shared_ptr<PreconditionerBase> m_precon;
     string m_linearSolverType;
 
@@ -362,6 +475,21 @@ protected:
     //! "left hand side" of each governing equation
     vector<double> m_LHS;
     vector<double> m_RHS;
+
+    //! Settings for dynamic adaptive chemistry
+    AnyMap m_reductionSettings;
+
+    //! Mechanism reduction for each reactor; `nullptr` for non-reacting reactors
+    vector<unique_ptr<MechanismReducer>> m_reducers;
+
+    //! Interval between updates of the reduced mechanisms
+    double m_reductionInterval = 0.0;
+
+    //! Value of the independent variable at the last update of the reduced mechanisms
+    double m_lastReduction = -BigNumber;
+
+    size_t m_nReductionUpdates = 0; //!< Number of reduced mechanism updates
+    size_t m_nReductionReinits = 0; //!< Integrator reinitializations due to reduction
 };
 }
 
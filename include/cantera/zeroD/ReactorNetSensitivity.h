@@ -0,0 +1,67 @@
+//! @file ReactorNetSensitivity.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORNETSENSITIVITY_H
+#define CT_REACTORNETSENSITIVITY_H
+
+#include "cantera/kinetics/BruteForceSensitivity.h"
+
+namespace Cantera
+{
+
+//! Brute-force sensitivity analysis for a single reactor integrated in time.
+/*!
+ * Each model copy consists of a reactor of the specified type containing a copy
+ * of the Solution object, which is integrated from the initial state of the
+ * Solution to the end time set with setEndTime(). Available objectives are the
+ * ignition delay (see addIgnitionDelay()) and the values of reactor components
+ * at the end time (see addComponent()).
+ *
+ * Since the reactor is integrated from the same initial state for each perturbed
+ * reaction, no warm start is used.
+ *
+ * @since New in %Cantera 3.1.
+ * @ingroup zerodGroup
+ */
+class ReactorNetSensitivity : public BruteForceSensitivity
+{
+public:
+    //! Create a sensitivity analysis for a reactor of type *reactorType* (see
+    //! newReactor()) containing the Solution *sol*.
+    ReactorNetSensitivity(shared_ptr<Solution> sol,
+                          const string& reactorType="IdealGasReactor");
+
+    //! Set the end time of the integration
+    void setEndTime(double tEnd);
+
+    //! Set the relative and absolute tolerances of the integrator. Negative values
+    //! leave the default tolerances of ReactorNet unchanged.
+    void setTolerances(double rtol, double atol);
+
+    //! Add the ignition delay as an objective, defined as the time of the maximum
+    //! rate of temperature rise
+    void addIgnitionDelay(const string& name="ignition-delay");
+
+    //! Add the value of the reactor component *component* (see
+    //! Reactor::componentIndex) at the end time as an objective
+    void addComponent(const string& component);
+
+protected:
+    class ReactorWorker;
+    unique_ptr<Worker> newWorker(shared_ptr<Solution> sol) override;
+
+    string m_reactorType; //!< Reactor type
+    double m_tEnd = -1.0; //!< End time
+    double m_rtol = -1.0; //!< Relative integrator tolerance
+    double m_atol = -1.0; //!< Absolute integrator tolerance
+
+    //! Reactor components used as objectives; an empty string indicates the
+    //! ignition delay
+    vector<string> m_components;
+};
+
+}
+
+#endif
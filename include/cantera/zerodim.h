@@ -11,6 +11,9 @@
 
 // reactor network
 #include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/IsatTable.h"
+#include "cantera/zeroD/AdjointSensitivity.h"
+#include "cantera/zeroD/ReactorNetSensitivity.h"
 
 // reactors
 #include "cantera/zeroD/Reservoir.h"
@@ -825,7 +825,11 @@ class SolutionArray(SolutionArrayBase):
                 setattr(self._phase, attr, list(kwargs.values()))
 
         self._append(self._phase.state, extra_temp)
-        self._indices.append(len(self._indices))
+        if self._api_shape()[0] == len(self._indices) + 1:
+            self._indices.append(len(self._indices))
+        else:
+            # buffered entries were written to an HDF stream
+            self.shape = self._api_shape()
 
     def sort(self, col, reverse=False):
         """
@@ -1177,13 +1181,26 @@ class SolutionArray(SolutionArrayBase):
 
     def read_csv(self, filename, normalize=True):
         """
-        Read a CSV file named ``filename`` and restore data to the `SolutionArray`
-        using `restore_data`. This method allows for recreation of data
-        previously exported by `write_csv`.
+        Read a CSV file named ``filename`` and restore data to the `SolutionArray`.
+        This method allows for recreation of data previously exported by `write_csv`.
 
-        The ``normalize`` argument is passed on to `restore_data` to normalize
-        mole or mass fractions. By default, ``normalize`` is ``True``.
+        Files holding temperature, density or pressure, and mole or mass fractions
+        are read by the C++ core; other files are restored using `restore_data`.
+        The ``normalize`` argument determines whether mole or mass fractions are
+        normalized. By default, ``normalize`` is ``True``.
+
+        .. versionchanged:: 3.1
+
+            CSV files are read by the C++ core where possible.
         """
+        try:
+            self.restore(filename)
+            if normalize:
+                self._normalize()
+            return
+        except NotImplementedError:
+            pass
+
         try:
             # pandas handles escaped entries correctly
             _import_pandas()
@@ -1297,10 +1314,11 @@ class SolutionArray(SolutionArrayBase):
         Restore `SolutionArray` data and header information from a container file.
 
         This method retrieves data from a YAML or HDF files that were previously saved
-        using the `save` method.
+        using the `save` method. CSV files are supported as well; as they do not hold
+        header information, an empty dictionary is returned.
 
         :param fname:
-            Name of container file (YAML or HDF)
+            Name of container file (YAML, HDF or CSV)
         :param name:
             Identifier of location within the container file; this node/group contains
             header information and a subgroup holding actual `SolutionArray` data
@@ -1318,6 +1336,100 @@ class SolutionArray(SolutionArrayBase):
         self.shape = self._api_shape()
         return meta
 
+    def read_components(self, fname, name, components, sub=None, *,
+                        start=0, count=None):
+        """
+        Read selected components from an HDF container file without restoring the
+        `SolutionArray`.
+
+        Only the requested datasets are read from file, which allows for efficient
+        extraction of a few properties from large files. Species are read from the
+        corresponding columns of stored mole or mass fractions.
+
+        :param fname:
+            Name of container file (HDF only)
+        :param name:
+            Identifier of location within the container file
+        :param components:
+            List of component names, for example ``["T", "H2O"]``
+        :param sub:
+            Name identifier for the subgroup holding the `SolutionArray` data. If
+            `None`, the subgroup name defaults to ``data``
+        :param start:
+            First entry to be read
+        :param count:
+            Maximum number of entries to be read; if `None`, all entries following
+            ``start`` are read
+        :return:
+            Dictionary holding data for each requested component.
+
+        .. versionadded:: 3.1
+        """
+        data = self._cxx_read_components(fname, name, sub, components, start, count)
+        return {key: np.array(value) for key, value in data.items()}
+
+    def stream(self, fname, name=None, sub=None, description=None, *,
+               buffer=1000, overwrite=False, compression=0):
+        """
+        Stream `SolutionArray` contents to an HDF container file.
+
+        Once streaming is enabled, states added by `append` are buffered in memory and
+        written to extendable HDF datasets whenever ``buffer`` entries have been
+        accumulated; the `SolutionArray` is emptied after each write. This allows for
+        recording long simulations without holding all states in memory. Remaining
+        entries are written by `flush` or `close_stream`. Streamed data are read
+        using `restore`.
+
+        :param fname:
+            Name of output file (HDF only)
+        :param name:
+            Identifier of storage location within the container file.
+        :param sub:
+            Name identifier for the subgroup holding the `SolutionArray` data and
+            metadata objects. If `None`, the subgroup name defaults to ``data``.
+        :param description:
+            Custom comment describing the dataset to be stored.
+        :param buffer:
+            Number of entries held in memory before data are written to file; also
+            used as HDF chunk size (default=1000).
+        :param overwrite:
+            Force overwrite if file/name exists; optional (default=`False`)
+        :param compression:
+            Compression level (0-9); optional (default=0)
+
+        .. versionadded:: 3.1
+        """
+        self._cxx_stream(fname, name, sub, description, buffer, overwrite, compression)
+        self.shape = self._api_shape()
+
+    def flush(self):
+        """
+        Write buffered entries to the HDF stream set up by `stream` and empty the
+        `SolutionArray`.
+
+        .. versionadded:: 3.1
+        """
+        self._cxx_flush()
+        self.shape = self._api_shape()
+
+    def close_stream(self):
+        """
+        Write buffered entries and stop streaming to the HDF container file.
+
+        .. versionadded:: 3.1
+        """
+        self._cxx_close_stream()
+        self.shape = self._api_shape()
+
+    @property
+    def streamed_size(self):
+        """
+        Number of entries written to the HDF stream set up by `stream`.
+
+        .. versionadded:: 3.1
+        """
+        return self._streamed_size()
+
     def __reduce__(self):
         raise NotImplementedError('SolutionArray object is not picklable')
 
@@ -37,6 +37,7 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         cbool addReaction(shared_ptr[CxxReaction]) except +translate_exception
         cbool addReaction(shared_ptr[CxxReaction], cbool) except +translate_exception
         void modifyReaction(int, shared_ptr[CxxReaction]) except +translate_exception
+        void clearReactionInput()
         void invalidateCache() except +translate_exception
         void resizeReactions()
 
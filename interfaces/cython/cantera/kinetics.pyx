@@ -194,6 +194,18 @@ cdef class Kinetics(_SolutionBase):
         """
         self.kinetics.modifyReaction(irxn, rxn._reaction)
 
+    def clear_reaction_input(self):
+        """
+        Release the input data retained by the reactions of this object. Fields which
+        are not needed to reconstruct the reactions, such as user-defined fields, are
+        discarded and will no longer be included in `Reaction.input_data` or in output
+        written by `Solution.write_yaml`. This reduces the memory used by large
+        mechanisms once setup is complete.
+
+        .. versionadded:: 3.1
+        """
+        self.kinetics.clearReactionInput()
+
     def add_reaction(self, Reaction rxn):
         """ Add a new reaction to this phase. """
         self.kinetics.addReaction(rxn._reaction)
@@ -64,6 +64,11 @@ cdef extern from "cantera/base/Solution.h" namespace "Cantera":
 
 
 cdef extern from "cantera/base/SolutionArray.h" namespace "Cantera":
+    cdef cppclass CxxSolutionArrayView "Cantera::SolutionArray::ComponentView":
+        CxxSolutionArrayView()
+        size_t size()
+        double operator[](size_t)
+
     cdef cppclass CxxSolutionArray "Cantera::SolutionArray":
         shared_ptr[CxxSolutionArray] share(vector[int]&) except +translate_exception
         void reset() except +translate_exception
@@ -78,6 +83,7 @@ cdef extern from "cantera/base/SolutionArray.h" namespace "Cantera":
         vector[string] componentNames() except +translate_exception
         cbool hasComponent(string&)
         CxxAnyValue getComponent(string&) except +translate_exception
+        CxxSolutionArrayView getComponentView(string&) except +translate_exception
         void setComponent(string&, CxxAnyValue&) except +translate_exception
         void setLoc(int) except +translate_exception
         void updateState(int) except +translate_exception
@@ -89,8 +95,14 @@ cdef extern from "cantera/base/SolutionArray.h" namespace "Cantera":
         CxxAnyMap getAuxiliary(int) except +translate_exception
         void setAuxiliary(int, CxxAnyMap&) except +translate_exception
         void append(vector[double]&, CxxAnyMap&) except +translate_exception
+        void normalize() except +translate_exception
         void save(string&, string&, string&, string&, cbool, int, string&) except +translate_exception
         CxxAnyMap restore(string&, string&, string&) except +translate_exception
+        CxxAnyMap readComponents(string&, string&, string&, vector[string]&, size_t, size_t) except +translate_exception
+        void stream(string&, string&, string&, string&, int, cbool, int) except +translate_exception
+        void flush() except +translate_exception
+        void closeStream() except +translate_exception
+        size_t streamedSize()
 
     cdef shared_ptr[CxxSolutionArray] CxxNewSolutionArray "Cantera::SolutionArray::create" (
         shared_ptr[CxxSolution], int, CxxAnyMap&) except +translate_exception
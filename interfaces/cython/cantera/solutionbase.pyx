@@ -607,7 +607,18 @@ cdef class SolutionArrayBase:
 
     def _get_component(self, name):
         """ Retrieve `SolutionArrayBase` component by name """
-        out = anyvalue_to_python(stringify(""), self.base.getComponent(stringify(name)))
+        cdef string cxx_name = stringify(name)
+        cdef CxxSolutionArrayView view
+        cdef np.ndarray[np.double_t, ndim=1] data
+        cdef size_t k
+        if self.base.hasComponent(cxx_name) and not self.base.hasExtra(cxx_name):
+            # state information is copied directly from the C++ data buffer
+            view = self.base.getComponentView(cxx_name)
+            data = np.empty(view.size())
+            for k in range(view.size()):
+                data[k] = view[k]
+            return data
+        out = anyvalue_to_python(stringify(""), self.base.getComponent(cxx_name))
         if out is None:
             return np.empty((0,))
         return np.array(out)
@@ -672,6 +683,40 @@ cdef class SolutionArrayBase:
             stringify(str(filename)), stringify(name), stringify(sub),
             stringify(description), overwrite, compression, stringify(basis))
 
+    def _cxx_read_components(self, filename, name, sub, components, start, count):
+        """ Interface `SolutionArray.read_components` with C++ core """
+        cdef vector[string] cxx_components
+        for item in components:
+            cxx_components.push_back(stringify(item))
+        cdef size_t cxx_count = <size_t>-1 if count is None else count
+        cdef CxxAnyMap data = self.base.readComponents(
+            stringify(str(filename)), stringify(name), stringify(sub),
+            cxx_components, start, cxx_count)
+        return anymap_to_py(data)
+
+    def _cxx_stream(self, filename, name, sub, description,
+                    buffer, overwrite, compression):
+        """ Interface `SolutionArray.stream` with C++ core """
+        self.base.stream(
+            stringify(str(filename)), stringify(name), stringify(sub),
+            stringify(description), buffer, overwrite, compression)
+
+    def _cxx_flush(self):
+        """ Interface `SolutionArray.flush` with C++ core """
+        self.base.flush()
+
+    def _cxx_close_stream(self):
+        """ Interface `SolutionArray.close_stream` with C++ core """
+        self.base.closeStream()
+
+    def _streamed_size(self):
+        """ Number of entries written to HDF stream """
+        return self.base.streamedSize()
+
+    def _normalize(self):
+        """ Normalize mole or mass fractions of all entries """
+        self.base.normalize()
+
     def _cxx_restore(self, filename, name, sub):
         """ Interface `SolutionArray.restore` with C++ core """
         cdef CxxAnyMap header
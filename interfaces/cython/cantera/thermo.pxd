@@ -207,6 +207,8 @@ cdef extern from "cantera/thermo/PlasmaPhase.h":
         void setMeanElectronEnergy(double) except +translate_exception
         double isotropicShapeFactor()
         double meanElectronEnergy()
+        void setReducedElectricField(double) except +translate_exception
+        double reducedElectricField()
         size_t nElectronEnergyLevels()
         double electronPressure()
         string electronSpeciesName()
@@ -1875,6 +1875,22 @@ cdef class ThermoPhase(_SolutionBase):
                 raise ThermoModelMethodError(self.thermo_model)
             self.plasma.setMeanElectronEnergy(energy)
 
+    property reduced_electric_field:
+        """
+        Reduced electric field [V m^2] used to calculate the electron energy
+        distribution of type ``Boltzmann-two-term``. Note that 1 Td = 1e-21 V m^2.
+
+        .. versionadded:: 3.1
+        """
+        def __get__(self):
+            if not self._enable_plasma:
+                raise ThermoModelMethodError(self.thermo_model)
+            return self.plasma.reducedElectricField()
+        def __set__(self, double EN):
+            if not self._enable_plasma:
+                raise ThermoModelMethodError(self.thermo_model)
+            self.plasma.setReducedElectricField(EN)
+
     property quadrature_method:
         """ Quadrature method """
         def __get__(self):
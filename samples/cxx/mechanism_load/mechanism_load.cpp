@@ -0,0 +1,84 @@
+/*
+ * Benchmark mechanism loading
+ * ===========================
+ *
+ * Time the loading of a reaction mechanism from a YAML input file, separating the
+ * time spent parsing the YAML file from the time spent constructing the species
+ * and reaction objects. Species and reactions are constructed concurrently on
+ * multi-core machines.
+ *
+ * Usage: ``mechanism_load [mechanism] [phase] [runs]``, where ``mechanism`` is the
+ * input file (default: ``nDodecane_Reitz.yaml``) and ``phase`` is the name of the
+ * phase to load (default: the first phase in the file).
+ *
+ * .. tags:: C++, kinetics, parallel computing, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include "cantera/core.h"
+
+using namespace Cantera;
+
+//! Print the mean and standard deviation of the times (in microseconds)
+void report(const string& label, const vector<double>& times)
+{
+    double average = accumulate(times.begin(), times.end(), 0.0) / times.size();
+    double var = 0.0;
+    for (double t : times) {
+        var += (t - average) * (t - average);
+    }
+    double std = sqrt(var / times.size());
+    std::cout << std::setw(14) << label << ": " << std::setprecision(5)
+        << average / 1000. << " ms ± " << std::setprecision(3) << std / 1000.
+        << " ms (" << times.size() << " runs)\n";
+}
+
+int main(int argc, char** argv)
+{
+    string mech = "nDodecane_Reitz.yaml";
+    string phase = "";
+    size_t runs = 5;
+    if (argc > 1) {
+        mech = argv[1];
+    }
+    if (argc > 2) {
+        phase = argv[2];
+    }
+    if (argc > 3) {
+        runs = std::stoul(argv[3]);
+    }
+
+    try {
+        vector<double> parse, construct, total;
+        shared_ptr<Solution> sol;
+        for (size_t run = 0; run < runs; run++) {
+            AnyMap::clearCachedFile(mech);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            AnyMap::fromYamlFile(mech);
+            auto t2 = std::chrono::high_resolution_clock::now();
+            // the parsed file is cached, so only objects are constructed here
+            sol = newSolution(mech, phase);
+            auto t3 = std::chrono::high_resolution_clock::now();
+            parse.push_back(
+                std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+            construct.push_back(
+                std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2).count());
+            total.push_back(parse.back() + construct.back());
+        }
+        std::cout << mech << ": " << sol->thermo()->nSpecies() << " species, "
+                  << sol->kinetics()->nReactions() << " reactions\n";
+        report("YAML parsing", parse);
+        report("construction", construct);
+        report("total", total);
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
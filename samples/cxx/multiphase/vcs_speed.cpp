@@ -0,0 +1,165 @@
+/*
+ * Benchmark multiphase equilibrium
+ * ================================
+ *
+ * Time equilibrium calculations using the VCS multiphase equilibrium solver for
+ * a gas phase in contact with an increasing number of condensed phases. The
+ * condensed phases are created from the species in ``nasa_condensed.yaml``, where
+ * each condensed species forms a separate stoichiometric phase.
+ *
+ * Usage: ``vcs_speed [elements] [T] [runs]``, where:
+ *
+ * - ``elements`` is a comma-separated list of element symbols (default:
+ *   ``Al,B,C,Ca,Cl,Fe,H,K,Mg,N,Na,O,S,Si,Ti``)
+ * - ``T`` is the temperature in K (default: 500)
+ * - ``runs`` is the number of equilibrium calculations timed for each number of
+ *   condensed phases, where run ``i`` is at a pressure of ``(1 + 0.1 i)`` atm. The
+ *   reported time is the mean and standard deviation over these runs (default: 10).
+ *
+ * .. tags:: C++, equilibrium, multiphase, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include "cantera/core.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/equil/MultiPhase.h"
+
+using namespace Cantera;
+
+//! Create a gas phase containing all species from nasa_gas.yaml that consist of
+//! the specified elements
+shared_ptr<ThermoPhase> newGas(const vector<string>& elements)
+{
+    AnyMap phase;
+    phase["name"] = "gas";
+    phase["thermo"] = "ideal-gas";
+    phase["elements"] = elements;
+    phase["species"] = vector<AnyMap>{AnyMap::fromYamlString(
+        "nasa_gas.yaml/species: all")};
+    phase["skip-undeclared-elements"] = true;
+    return newThermo(phase);
+}
+
+//! Create one stoichiometric phase for each species from nasa_condensed.yaml that
+//! consists of the specified elements and whose temperature range includes *T*
+vector<shared_ptr<ThermoPhase>> newCondensed(const vector<string>& elements,
+                                             double T)
+{
+    AnyMap db = AnyMap::fromYamlFile("nasa_condensed.yaml");
+    vector<shared_ptr<ThermoPhase>> phases;
+    for (auto& species : db["species"].asVector<AnyMap>()) {
+        bool found = true;
+        for (auto& [element, count] : species["composition"]) {
+            if (std::find(elements.begin(), elements.end(), element) ==
+                elements.end())
+            {
+                found = false;
+            }
+        }
+        auto& Trange = species["thermo"]["temperature-ranges"].asVector<double>();
+        if (!found || T < Trange.front() || T > Trange.back()) {
+            continue;
+        }
+        AnyMap phase;
+        phase["name"] = species["name"].asString();
+        phase["thermo"] = "fixed-stoichiometry";
+        phase["species"] = vector<AnyMap>{AnyMap::fromYamlString(
+            "nasa_condensed.yaml/species: [" + species["name"].asString() + "]")};
+        phase["density"] = 1000.0;
+        phases.push_back(newThermo(phase));
+    }
+    return phases;
+}
+
+//! Time the equilibrium calculation at several pressures and report the mean
+//! and standard deviation of the time per calculation
+void timeit(MultiPhase& mix, const string& moles, double T, size_t runs)
+{
+    vector<double> times;
+    size_t failures = 0;
+    for (size_t run = 0; run < runs; run++) {
+        mix.setState_TP(T, OneAtm * (1.0 + 0.1 * run));
+        mix.setMolesByName(moles);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        try {
+            mix.equilibrate("TP", "vcs");
+        } catch (CanteraError& err) {
+            failures++;
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        times.push_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+    }
+    double average = accumulate(times.begin(), times.end(), 0.0) / times.size();
+    double var = 0.0;
+    for (double t : times) {
+        var += (t - average) * (t - average);
+    }
+    double std = sqrt(var / times.size());
+    std::cout << std::setprecision(5) << average / 1000. << " ms ± "
+        << std::setprecision(3) << std / 1000. << " ms per equilibrium ("
+        << runs << " runs, " << failures << " failures)\n";
+}
+
+int main(int argc, char** argv)
+{
+    string elementList = "Al,B,C,Ca,Cl,Fe,H,K,Mg,N,Na,O,S,Si,Ti";
+    double T = 500.0;
+    size_t runs = 10;
+    if (argc > 1) {
+        elementList = argv[1];
+    }
+    if (argc > 2) {
+        T = std::stod(argv[2]);
+    }
+    if (argc > 3) {
+        runs = std::stoul(argv[3]);
+    }
+    std::replace(elementList.begin(), elementList.end(), ',', ' ');
+    vector<string> elements;
+    tokenizeString(elementList, elements);
+
+    try {
+        auto gas = newGas(elements);
+        // Mixture composition: one mole of each element as the monatomic gas
+        // species, plus excess oxygen
+        string moles = "O2:" + std::to_string(elements.size());
+        for (size_t k = 0; k < gas->nSpecies(); k++) {
+            double atoms = 0.0;
+            for (size_t m = 0; m < gas->nElements(); m++) {
+                atoms += std::abs(gas->nAtoms(k, m));
+            }
+            if (atoms == 1.0 && gas->charge(k) == 0.0) {
+                moles += ", " + gas->speciesName(k) + ":1.0";
+            }
+        }
+        auto condensed = newCondensed(elements, T);
+        std::cout << "Gas phase with " << gas->nSpecies() << " species; "
+                  << condensed.size() << " condensed phases available\n";
+        for (size_t n : {0, 10, 30, 100, 300}) {
+            n = std::min(n, condensed.size());
+            MultiPhase mix;
+            mix.addPhase(gas.get(), 1.0);
+            for (size_t i = 0; i < n; i++) {
+                mix.addPhase(condensed[i].get(), 0.0);
+            }
+            mix.init();
+            std::cout << std::setw(4) << n << " condensed phases: ";
+            timeit(mix, moles, T, runs);
+            if (n == condensed.size()) {
+                break;
+            }
+        }
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
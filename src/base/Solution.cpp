@@ -9,6 +9,7 @@
 #include "cantera/base/Solution.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/ExtensionManager.h"
+#include "cantera/base/YamlWriter.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/kinetics/Kinetics.h"
@@ -42,6 +43,9 @@ void Solution::setName(const string& name) {
 
 void Solution::setThermo(shared_ptr<ThermoPhase> thermo) {
     m_thermo = thermo;
+    if (m_thermo) {
+        m_thermo->setSolution(weak_from_this());
+    }
     for (const auto& [id, callback] : m_changeCallbacks) {
         callback();
     }
@@ -97,6 +101,24 @@ void Solution::addAdjacent(shared_ptr<Solution> adjacent) {
     m_adjacentByName[adjacent->name()] = adjacent;
 }
 
+shared_ptr<Solution> Solution::clone()
+{
+    if (!m_thermo) {
+        throw CanteraError("Solution::clone", "Requires associated 'ThermoPhase'");
+    }
+    YamlWriter writer;
+    writer.setPrecision(17);
+    writer.addPhase(shared_from_this());
+    AnyMap root = AnyMap::fromYamlString(writer.toYamlString());
+    string transport = m_transport ? m_transport->transportModel() : "none";
+    auto copy = newSolution(root["phases"].asVector<AnyMap>()[0], root, transport);
+    vector<double> state;
+    m_thermo->saveState(state);
+    copy->thermo()->restoreState(state);
+    copy->setSource(source());
+    return copy;
+}
+
 AnyMap Solution::parameters(bool withInput) const
 {
     AnyMap out = m_thermo->parameters(false);
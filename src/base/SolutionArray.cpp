@@ -13,10 +13,13 @@
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/utilities.h"
+#include "cantera/base/global.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <charconv>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 
 namespace ba = boost::algorithm;
@@ -98,6 +101,14 @@ SolutionArray::SolutionArray(const SolutionArray& other,
 
 SolutionArray::~SolutionArray()
 {
+    if (m_streamFile != "") {
+        try {
+            flush();
+        } catch (std::exception& err) {
+            warn_user("SolutionArray::~SolutionArray",
+                "Unable to write buffered entries to HDF stream:\n{}", err.what());
+        }
+    }
     m_sol->thermo()->removeSpeciesLock();
 }
 
@@ -719,6 +730,55 @@ AnyValue SolutionArray::getComponent(const string& name) const
     return out;
 }
 
+SolutionArray::ComponentView SolutionArray::getComponentView(const string& name) const
+{
+    if (!hasComponent(name)) {
+        throw CanteraError("SolutionArray::getComponentView",
+            "Unknown component '{}'.", name);
+    }
+
+    const double* data;
+    size_t stride;
+    if (m_extra->count(name)) {
+        // extra component
+        const auto& extra = m_extra->at(name);
+        if (!extra.isVector<double>()) {
+            throw CanteraError("SolutionArray::getComponentView",
+                "Views are not available for component '{}' with type '{}'.",
+                name, extra.type_str());
+        }
+        data = extra.asVector<double>().data();
+        stride = 1;
+    } else {
+        // component is part of state information
+        size_t ix = m_sol->thermo()->speciesIndex(name);
+        if (ix == npos) {
+            // state other than species
+            ix = m_sol->thermo()->nativeState()[name];
+        } else {
+            // species information
+            ix += m_stride - m_sol->thermo()->nSpecies();
+        }
+        data = m_data->data() + ix;
+        stride = m_stride;
+    }
+    if (m_size == 0) {
+        return ComponentView(data, stride, 0);
+    }
+
+    // Use a constant stride if active entries are equally spaced, which is the
+    // case for unsliced data and regular slices
+    int step = (m_size > 1) ? m_active[1] - m_active[0] : 1;
+    bool regular = step > 0;
+    for (size_t k = 2; k < m_size && regular; k++) {
+        regular = (m_active[k] - m_active[k - 1] == step);
+    }
+    if (regular) {
+        return ComponentView(data + m_active[0] * stride, stride * step, m_size);
+    }
+    return ComponentView(data, stride, m_size, m_active.data());
+}
+
 bool isSimpleVector(const AnyValue& any) {
     return any.isVector<double>() || any.isVector<long int>() ||
         any.isVector<string>() || any.isVector<bool>() ||
@@ -989,6 +1049,105 @@ void SolutionArray::writeHeader(AnyMap& root, const string& name,
     data.update(preamble(desc));
 }
 
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Minimum number of CSV rows handled by a single thread
+const size_t csvRowsPerThread = 10000;
+
+//! Number of CSV rows per thread that are formatted before writing to file
+const size_t csvBlockRows = 65536;
+
+//! Number of bytes read from CSV files at a time
+const size_t csvBlockBytes = 1 << 26;
+
+//! Column of CSV output, which references either component data or a species
+struct CsvColumn
+{
+    const vector<double>* dbl = nullptr;
+    const vector<long int>* lng = nullptr;
+    const vector<string>* str = nullptr;
+    size_t species = npos;
+};
+
+//! Number of threads used for processing *rows* CSV rows
+size_t csvThreads(size_t rows)
+{
+    size_t nThreads = std::thread::hardware_concurrency();
+    return std::max<size_t>(std::min<size_t>(nThreads, rows / csvRowsPerThread), 1);
+}
+
+//! Split a CSV line into fields. Fields containing commas are enclosed in double
+//! quotes (see SolutionArray::writeEntry); escaped quotes are not supported.
+//! @returns  `false` if the line is malformed
+bool splitCsvLine(const char* begin, const char* end, vector<std::string_view>& fields)
+{
+    fields.clear();
+    const char* pos = begin;
+    while (true) {
+        if (pos < end && *pos == '"') {
+            const char* close = std::find(pos + 1, end, '"');
+            if (close == end) {
+                return false;
+            }
+            fields.emplace_back(pos + 1, close - pos - 1);
+            pos = close + 1;
+        } else {
+            const char* sep = std::find(pos, end, ',');
+            fields.emplace_back(pos, sep - pos);
+            pos = sep;
+        }
+        if (pos == end) {
+            return true;
+        }
+        if (*pos != ',') {
+            return false;
+        }
+        pos++;
+    }
+}
+
+//! Parse a numeric CSV field; empty fields are interpreted as NaN. Parsing does not
+//! depend on the active C locale.
+//! @returns  `false` if the field is not numeric
+bool parseCsvNumber(std::string_view field, double& value, bool& integer)
+{
+    integer = false;
+    size_t first = field.find_first_not_of(' ');
+    if (first == npos) {
+        value = NAN;
+        return field.empty();
+    }
+    field = field.substr(first, field.find_last_not_of(' ') + 1 - first);
+    integer = field.find_first_not_of("+-0123456789") == npos;
+    if (field[0] == '+' && field.size() > 1 && field[1] != '-') {
+        field.remove_prefix(1);
+    }
+#ifdef __cpp_lib_to_chars
+    auto [end, err] = std::from_chars(field.data(), field.data() + field.size(), value);
+    return err == std::errc() && end == field.data() + field.size();
+#else
+    string str(field);
+    std::istringstream ss(str);
+    ss.imbue(std::locale::classic());
+    ss >> value;
+    if (!ss.fail() && ss.peek() == std::char_traits<char>::eof()) {
+        return true;
+    }
+    // non-finite values as written by fmt
+    ba::to_lower(str);
+    if (str == "nan" || str == "-nan") {
+        value = NAN;
+    } else if (str == "inf" || str == "-inf") {
+        value = (str[0] == '-') ? -INFINITY : INFINITY;
+    } else {
+        return false;
+    }
+    return true;
+#endif
+}
+
+} // end unnamed namespace
+
 void SolutionArray::writeEntry(const string& fname, bool overwrite, const string& basis)
 {
     if (apiNdim() != 1) {
@@ -1014,30 +1173,40 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
 
     auto names = componentNames();
     size_t last = names.size() - 1;
-    vector<AnyValue> components;
-    vector<bool> isSpecies;
+    vector<CsvColumn> columns;
+    vector<AnyValue> components; // keeps pre-read component data alive
+    components.reserve(names.size());
     fmt::memory_buffer header;
     for (const auto& key : names) {
         string label = key;
-        size_t col;
+        size_t col = columns.size();
+        auto& column = columns.emplace_back();
         if (speciesNames.find(key) == speciesNames.end()) {
             // Pre-read component vectors
-            isSpecies.push_back(false);
-            components.emplace_back(getComponent(key));
-            col = components.size() - 1;
-            if (!components[col].isVector<double>() &&
-                !components[col].isVector<long int>() &&
-                !components[col].isVector<string>())
-            {
+            const auto& data = components.emplace_back(getComponent(key));
+            if (data.isVector<double>()) {
+                column.dbl = &data.asVector<double>();
+            } else if (data.isVector<long int>()) {
+                column.lng = &data.asVector<long int>();
+            } else if (data.isVector<string>()) {
+                column.str = &data.asVector<string>();
+                for (const auto& value : *column.str) {
+                    if (value.find("\"") != string::npos ||
+                        value.find("\n") != string::npos)
+                    {
+                        throw NotImplementedError("SolutionArray::writeEntry",
+                            "Detected value containing double quotes or line feeds: "
+                            "'{}'", value);
+                    }
+                }
+            } else {
                 throw CanteraError("SolutionArray::writeEntry",
                     "Multi-dimensional column '{}' is not supported for CSV output.",
                     key);
             }
         } else {
-            // Delay reading species data as base can be either mole or mass
-            isSpecies.push_back(true);
-            components.emplace_back(AnyValue());
-            col = components.size() - 1;
+            // Species data are read from state data as base can be either mole or mass
+            column.species = m_sol->thermo()->speciesIndex(key);
             if (mole) {
                 label = "X_" + label;
             } else {
@@ -1057,6 +1226,33 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
         }
     }
 
+    // Species fractions are taken directly from the state data if the native state
+    // holds mole or mass fractions; otherwise, they are evaluated beforehand.
+    auto phase = m_sol->thermo();
+    const auto& nativeState = phase->nativeState();
+    size_t nSpecies = phase->nSpecies();
+    size_t offset = npos;
+    bool convert = false;
+    vector<double> fractions;
+    if (nativeState.count(mole ? "X" : "Y")) {
+        offset = nativeState.at(mole ? "X" : "Y");
+    } else if (nativeState.count(mole ? "Y" : "X")) {
+        offset = nativeState.at(mole ? "Y" : "X");
+        convert = true;
+    } else {
+        fractions.resize(m_size * nSpecies);
+        for (size_t row = 0; row < m_size; row++) {
+            setLoc(static_cast<int>(row));
+            if (mole) {
+                phase->getMoleFractions(fractions.data() + row * nSpecies);
+            } else {
+                phase->getMassFractions(fractions.data() + row * nSpecies);
+            }
+        }
+    }
+    const auto& molwts = phase->molecularWeights();
+    const auto& rmolwts = phase->inverseMolecularWeights();
+
     // (Most) potential exceptions have been thrown; start writing data to file
     if (std::ifstream(fname).good()) {
         if (!overwrite) {
@@ -1067,55 +1263,67 @@ void SolutionArray::writeEntry(const string& fname, bool overwrite, const string
         std::remove(fname.c_str());
     }
     std::ofstream output(fname);
-    output << to_string(header) << std::endl;
-
-    size_t maxLen = npos;
-    vector<double> buf(speciesNames.size(), 0.);
-    for (int row = 0; row < static_cast<int>(m_size); row++) {
-        fmt::memory_buffer line;
-        if (maxLen != npos) {
-            line.reserve(maxLen);
-        }
-        setLoc(row);
-        if (mole) {
-            m_sol->thermo()->getMoleFractions(buf.data());
-        } else {
-            m_sol->thermo()->getMassFractions(buf.data());
-        }
-
-        size_t idx = 0;
-        for (size_t col = 0; col < components.size(); col++) {
-            string sep = (col == last) ? "" : ",";
-            if (isSpecies[col]) {
-                fmt_append(line, "{:.9g}{}", buf[idx++], sep);
+    output << to_string(header) << "\n";
+
+    // Rows are formatted in parallel and written in blocks to limit memory usage
+    auto formatRows = [&](fmt::memory_buffer& out, size_t begin, size_t end) {
+        vector<double> buf(nSpecies);
+        for (size_t row = begin; row < end; row++) {
+            const double* frac;
+            if (offset == npos) {
+                frac = fractions.data() + row * nSpecies;
             } else {
-                auto& data = components[col];
-                if (data.isVector<double>()) {
-                    fmt_append(line, "{:.9g}{}", data.asVector<double>()[row], sep);
-                } else if (data.isVector<long int>()) {
-                    fmt_append(line, "{}{}", data.asVector<long int>()[row], sep);
-                } else if (data.isVector<bool>()) {
-                    fmt_append(line, "{}{}",
-                               static_cast<bool>(data.asVector<bool>()[row]), sep);
+                frac = m_data->data() + m_active[row] * m_stride + offset;
+            }
+            if (convert) {
+                // conversion consistent with Phase::setMassFractions_NoNorm and
+                // Phase::setMoleFractions_NoNorm
+                double sum = 0.;
+                for (size_t k = 0; k < nSpecies; k++) {
+                    buf[k] = mole ? frac[k] * rmolwts[k] : frac[k] * molwts[k];
+                    sum += buf[k];
+                }
+                double scale = 1. / sum;
+                for (size_t k = 0; k < nSpecies; k++) {
+                    buf[k] *= scale;
+                }
+                frac = buf.data();
+            }
+            for (size_t col = 0; col <= last; col++) {
+                const auto& column = columns[col];
+                if (column.species != npos) {
+                    fmt::format_to(std::back_inserter(out), "{}", frac[column.species]);
+                } else if (column.dbl) {
+                    fmt::format_to(std::back_inserter(out), "{}", (*column.dbl)[row]);
+                } else if (column.lng) {
+                    fmt::format_int value((*column.lng)[row]);
+                    out.append(value.data(), value.data() + value.size());
                 } else {
-                    auto value = data.asVector<string>()[row];
-                    if (value.find("\"") != string::npos ||
-                        value.find("\n") != string::npos)
-                    {
-                        throw NotImplementedError("SolutionArray::writeEntry",
-                            "Detected value containing double quotes or line feeds: "
-                            "'{}'", value);
-                    }
+                    const string& value = (*column.str)[row];
                     if (value.find(",") != string::npos) {
-                        fmt_append(line, "\"{}\"{}", value, sep);
+                        out.push_back('"');
+                        out.append(value.data(), value.data() + value.size());
+                        out.push_back('"');
                     } else {
-                        fmt_append(line, "{}{}", value, sep);
+                        out.append(value.data(), value.data() + value.size());
                     }
                 }
+                out.push_back(col == last ? '\n' : ',');
             }
         }
-        output << to_string(line) << std::endl;
-        maxLen = std::max(maxLen, line.size());
+    };
+    size_t nChunks = csvThreads(m_size);
+    vector<fmt::memory_buffer> chunks(nChunks);
+    for (size_t begin = 0; begin < m_size; begin += nChunks * csvBlockRows) {
+        size_t end = std::min(begin + nChunks * csvBlockRows, m_size);
+        parallelFor(nChunks, [&](size_t w) {
+            chunks[w].clear();
+            formatRows(chunks[w], begin + w * (end - begin) / nChunks,
+                       begin + (w + 1) * (end - begin) / nChunks);
+        });
+        for (const auto& chunk : chunks) {
+            output.write(chunk.data(), chunk.size());
+        }
     }
 }
 
@@ -1298,6 +1506,9 @@ void SolutionArray::append(const vector<double>& state, const AnyMap& extra)
         resize(pos);
         throw CanteraError("SolutionArray::append", err.getMessage());
     }
+    if (m_streamBuffer && m_size >= m_streamBuffer) {
+        flush();
+    }
 }
 
 void SolutionArray::save(const string& fname, const string& name, const string& sub,
@@ -1346,6 +1557,142 @@ void SolutionArray::save(const string& fname, const string& name, const string&
                        "Unknown file extension '{}'.", extension);
 }
 
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Check that all extra components can be appended by Storage::appendData
+void checkStreamable(const map<string, AnyValue>& extra, const string& method)
+{
+    for (const auto& [key, value] : extra) {
+        if (value.is<void>() || value.isVector<double>() || value.isVector<long int>()
+            || value.isVector<vector<double>>() || value.isVector<vector<long int>>())
+        {
+            continue;
+        }
+        throw NotImplementedError(method,
+            "Unable to stream component '{}' with data type {}.",
+            key, value.type_str());
+    }
+}
+
+} // end unnamed namespace
+
+void SolutionArray::stream(const string& fname, const string& name,
+                           const string& sub, const string& desc, int buffer,
+                           bool overwrite, int compression)
+{
+    size_t dot = fname.find_last_of(".");
+    string extension = (dot != npos) ? toLowerCopy(fname.substr(dot + 1)) : "";
+    if (extension != "h5" && extension != "hdf" && extension != "hdf5") {
+        throw CanteraError("SolutionArray::stream",
+            "Streaming requires HDF output; unsupported file extension '{}'.",
+            extension);
+    }
+    if (name == "") {
+        throw CanteraError("SolutionArray::stream",
+            "Group name specifying root location must not be empty.");
+    }
+    if (m_shared || m_size < m_dataSize) {
+        throw NotImplementedError("SolutionArray::stream",
+            "Unable to stream shared or sliced data.");
+    }
+    if (apiNdim() > 1) {
+        throw NotImplementedError("SolutionArray::stream",
+            "Unable to stream multi-dimensional arrays.");
+    }
+    if (buffer < 1) {
+        throw CanteraError("SolutionArray::stream",
+            "Buffer size must be positive; received {}.", buffer);
+    }
+    checkStreamable(*m_extra, "SolutionArray::stream");
+    closeStream();
+
+    writeHeader(fname, name, desc, overwrite);
+    string path = name + "/" + (sub != "" ? sub : "data");
+    Storage file(fname, true);
+    file.checkGroup(path, true);
+    AnyMap size;
+    size["size"] = 0;
+    file.writeAttributes(path, size);
+
+    m_streamFile = fname;
+    m_streamPath = path;
+    m_streamBuffer = static_cast<size_t>(buffer);
+    m_streamCompression = compression;
+    m_streamSize = 0;
+    m_streamComponents.clear();
+    if (m_size >= m_streamBuffer) {
+        flush();
+    }
+}
+
+void SolutionArray::flush()
+{
+    if (m_streamFile == "" || !m_size) {
+        return;
+    }
+    auto names = componentNames();
+    if (m_streamSize && names != m_streamComponents) {
+        throw CanteraError("SolutionArray::flush",
+            "Components of SolutionArray changed after streaming started.");
+    }
+    // Check before writing anything to avoid leaving incomplete entries
+    checkStreamable(*m_extra, "SolutionArray::flush");
+    Storage file(m_streamFile, true);
+    if (m_streamCompression) {
+        file.setCompressionLevel(m_streamCompression);
+    }
+    if (!m_streamSize) {
+        file.writeAttributes(m_streamPath, m_meta);
+        AnyMap more;
+        more["components"] = names;
+        file.writeAttributes(m_streamPath, more);
+        m_streamComponents = names;
+    }
+
+    const auto& nativeState = m_sol->thermo()->nativeState();
+    size_t nSpecies = m_sol->thermo()->nSpecies();
+    for (auto& [key, offset] : nativeState) {
+        AnyValue data;
+        if (key == "X" || key == "Y") {
+            vector<vector<double>> prop;
+            prop.reserve(m_size);
+            for (size_t i = 0; i < m_size; i++) {
+                size_t first = offset + i * m_stride;
+                prop.emplace_back(m_data->begin() + first,
+                                  m_data->begin() + first + nSpecies);
+            }
+            data = prop;
+        } else {
+            data = getComponent(key);
+        }
+        file.appendData(m_streamPath, key, data, m_streamBuffer);
+    }
+
+    for (const auto& [key, value] : *m_extra) {
+        if (!value.is<void>()) { // skip uninitialized component
+            file.appendData(m_streamPath, key, value, m_streamBuffer);
+        }
+    }
+
+    m_streamSize += m_size;
+    file.deleteAttribute(m_streamPath, "size");
+    AnyMap size;
+    size["size"] = int(m_streamSize);
+    file.writeAttributes(m_streamPath, size);
+    resize(0);
+}
+
+void SolutionArray::closeStream()
+{
+    flush();
+    m_streamFile = "";
+    m_streamPath = "";
+    m_streamBuffer = 0;
+    m_streamCompression = 0;
+    m_streamSize = 0;
+    m_streamComponents.clear();
+}
+
 AnyMap SolutionArray::readHeader(const string& fname, const string& name)
 {
     Storage file(fname, false);
@@ -1395,9 +1742,12 @@ AnyMap SolutionArray::restore(const string& fname,
     string extension = (dot != npos) ? toLowerCopy(fname.substr(dot + 1)) : "";
     AnyMap header;
     if (extension == "csv") {
-        throw NotImplementedError("SolutionArray::restore",
-            "CSV import not implemented; if using Python, data can be imported via "
-            "'read_csv' instead.");
+        if (name != "") {
+            warn_user("SolutionArray::restore",
+                      "Parameter 'name' not used for CSV input.");
+        }
+        readEntry(fname);
+        return header;
     }
     if (extension == "h5" || extension == "hdf"  || extension == "hdf5") {
         readEntry(fname, name, sub);
@@ -1633,6 +1983,8 @@ set<string> SolutionArray::_stateProperties(
     return states;
 }
 
+namespace { // restrict scope of helper functions to local translation unit
+
 string getName(const set<string>& names, const string& name)
 {
     if (names.count(name)) {
@@ -1645,14 +1997,8 @@ string getName(const set<string>& names, const string& name)
     return name; // let exception be thrown elsewhere
 }
 
-void SolutionArray::readEntry(const string& fname, const string& name,
-                              const string& sub)
+string locateGroup(Storage& file, const string& name, const string& sub)
 {
-    Storage file(fname, false);
-    if (name == "") {
-        throw CanteraError("SolutionArray::readEntry",
-            "Group name specifying root location must not be empty.");
-    }
     string path = name;
     if (sub != "" && file.checkGroup(name + "/" + sub, true)) {
         path += "/" + sub;
@@ -1660,6 +2006,313 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         // default data location
         path += "/data";
     }
+    return path;
+}
+
+} // end unnamed namespace
+
+void SolutionArray::readEntry(const string& fname)
+{
+    std::ifstream input(fname, std::ios::binary);
+    if (!input.good()) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Unable to open CSV file '{}'.", fname);
+    }
+    string line;
+    std::getline(input, line);
+    if (line.size() && line.back() == '\r') {
+        line.pop_back();
+    }
+    vector<std::string_view> fields;
+    if (line.empty() || !splitCsvLine(line.data(), line.data() + line.size(), fields)) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Invalid header in CSV file '{}'.", fname);
+    }
+    vector<string> labels(fields.begin(), fields.end());
+    size_t nCols = labels.size();
+
+    // Columns are numeric unless a field in any row cannot be parsed as a number.
+    // Column types are guessed from the first row; if a later field of a numeric
+    // column is not numeric, the column is changed to text and the data are read
+    // again.
+    vector<char> isText(nCols, 0);
+    vector<char> isInteger(nCols);
+    vector<vector<double>> numeric(nCols);
+    vector<vector<string>> text(nCols);
+    size_t nRows = 0;
+    auto dataStart = input.tellg();
+
+    // The file is processed in blocks of complete lines, which are parsed in parallel
+    string buffer;
+    string carry;
+    vector<pair<size_t, size_t>> rows;
+    bool retry = true;
+    while (retry) {
+        retry = false;
+        std::fill(isInteger.begin(), isInteger.end(), 1);
+        for (size_t col = 0; col < nCols; col++) {
+            numeric[col].clear();
+            text[col].clear();
+        }
+        nRows = 0;
+        carry.clear();
+        input.clear();
+        input.seekg(dataStart);
+        bool eof = false;
+        while (!eof && !retry) {
+            buffer.swap(carry);
+            carry.clear();
+            size_t size0 = buffer.size();
+            buffer.resize(size0 + csvBlockBytes);
+            input.read(&buffer[size0], csvBlockBytes);
+            buffer.resize(size0 + input.gcount());
+            eof = !input.good();
+            if (!eof) {
+                size_t pos = buffer.rfind('\n');
+                if (pos == npos) {
+                    carry.swap(buffer);
+                    continue;
+                }
+                carry.assign(buffer, pos + 1, npos);
+                buffer.resize(pos + 1);
+            }
+
+            rows.clear();
+            size_t start = 0;
+            while (start < buffer.size()) {
+                size_t stop = std::min(buffer.find('\n', start), buffer.size());
+                size_t end = stop;
+                if (end > start && buffer[end - 1] == '\r') {
+                    end--;
+                }
+                if (end > start) {
+                    rows.emplace_back(start, end);
+                }
+                start = stop + 1;
+            }
+            if (rows.empty()) {
+                continue;
+            }
+            if (nRows == 0) {
+                splitCsvLine(buffer.data() + rows[0].first,
+                             buffer.data() + rows[0].second, fields);
+                for (size_t col = 0; col < std::min(nCols, fields.size()); col++) {
+                    double value;
+                    bool integer;
+                    if (!parseCsvNumber(fields[col], value, integer)) {
+                        isText[col] = 1;
+                    }
+                }
+            }
+            for (size_t col = 0; col < nCols; col++) {
+                if (isText[col]) {
+                    text[col].resize(nRows + rows.size());
+                } else {
+                    numeric[col].resize(nRows + rows.size());
+                }
+            }
+
+            size_t nChunks = csvThreads(rows.size());
+            vector<vector<char>> integers(nChunks, vector<char>(nCols, 1));
+            vector<vector<char>> invalid(nChunks, vector<char>(nCols, 0));
+            parallelFor(nChunks, [&](size_t w) {
+                vector<std::string_view> row;
+                size_t first = w * rows.size() / nChunks;
+                size_t stop = (w + 1) * rows.size() / nChunks;
+                for (size_t i = first; i < stop; i++) {
+                    size_t loc = nRows + i;
+                    if (!splitCsvLine(buffer.data() + rows[i].first,
+                                      buffer.data() + rows[i].second, row)
+                        || row.size() != nCols)
+                    {
+                        throw CanteraError("SolutionArray::readEntry",
+                            "Malformed data in row {} of CSV file '{}'.", loc + 1,
+                            fname);
+                    }
+                    for (size_t col = 0; col < nCols; col++) {
+                        if (isText[col]) {
+                            text[col][loc] = string(row[col]);
+                            continue;
+                        }
+                        bool integer;
+                        if (!parseCsvNumber(row[col], numeric[col][loc], integer)) {
+                            invalid[w][col] = 1;
+                        } else if (!integer) {
+                            integers[w][col] = 0;
+                        }
+                    }
+                }
+            });
+            for (size_t w = 0; w < nChunks; w++) {
+                for (size_t col = 0; col < nCols; col++) {
+                    isInteger[col] = isInteger[col] && integers[w][col];
+                    if (invalid[w][col]) {
+                        isText[col] = 1;
+                        retry = true;
+                    }
+                }
+            }
+            nRows += rows.size();
+        }
+    }
+
+    m_extra->clear();
+    m_meta.clear();
+    resize(static_cast<int>(nRows));
+
+    // Identify columns holding species fractions and remaining state information
+    auto phase = m_sol->thermo();
+    size_t nSpecies = phase->nSpecies();
+    vector<size_t> speciesColumns(nSpecies, npos);
+    vector<char> used(nCols, 0);
+    map<string, size_t> index;
+    string basis;
+    for (size_t col = 0; col < nCols; col++) {
+        const auto& label = labels[col];
+        if (!isText[col] && label.size() > 2 && label[1] == '_' &&
+            (label[0] == 'X' || label[0] == 'Y'))
+        {
+            size_t k = phase->speciesIndex(label.substr(2));
+            if (k != npos) {
+                string key = label.substr(0, 1);
+                if (basis != "" && basis != key) {
+                    throw CanteraError("SolutionArray::readEntry",
+                        "CSV file '{}' contains both mole and mass fractions.", fname);
+                }
+                basis = key;
+                speciesColumns[k] = col;
+                used[col] = 1;
+                continue;
+            }
+        }
+        if (!isText[col]) {
+            index[label] = col;
+        }
+    }
+    auto findColumn = [&](const string& name) {
+        if (index.count(name)) {
+            return index[name];
+        }
+        if (aliasMap.count(name) && index.count(aliasMap.at(name))) {
+            return index[aliasMap.at(name)];
+        }
+        return npos;
+    };
+
+    const auto& nativeState = phase->nativeState();
+    string native = nativeState.count("X") ? "X" : (nativeState.count("Y") ? "Y" : "");
+    bool direct = (native == "" || basis != "");
+    for (const auto& [name, offset] : nativeState) {
+        if (name != "X" && name != "Y" && findColumn(name) == npos) {
+            direct = false;
+        }
+    }
+    if (nRows == 0) {
+        // no state data
+    } else if (direct) {
+        // native state can be written directly into data storage
+        for (const auto& [name, offset] : nativeState) {
+            if (name == "X" || name == "Y") {
+                continue;
+            }
+            size_t col = findColumn(name);
+            used[col] = 1;
+            for (size_t i = 0; i < nRows; i++) {
+                (*m_data)[offset + i * m_stride] = numeric[col][i];
+            }
+        }
+        if (native != "") {
+            // conversion consistent with Phase::setMassFractions_NoNorm and
+            // Phase::setMoleFractions_NoNorm
+            size_t offset = nativeState.at(native);
+            bool convert = (basis != native);
+            const auto& factor = (native == "X") ? phase->inverseMolecularWeights()
+                                                 : phase->molecularWeights();
+            parallelFor(nRows, [&](size_t i) {
+                double* frac = m_data->data() + offset + i * m_stride;
+                double sum = 0.;
+                for (size_t k = 0; k < nSpecies; k++) {
+                    size_t col = speciesColumns[k];
+                    frac[k] = (col == npos) ? 0. : numeric[col][i];
+                    if (convert) {
+                        frac[k] *= factor[k];
+                        sum += frac[k];
+                    }
+                }
+                if (convert) {
+                    double scale = 1. / sum;
+                    for (size_t k = 0; k < nSpecies; k++) {
+                        frac[k] *= scale;
+                    }
+                }
+            }, csvRowsPerThread);
+        }
+    } else if (basis != "" && findColumn("T") != npos &&
+               (findColumn("D") != npos || findColumn("P") != npos))
+    {
+        // state needs to be evaluated using the ThermoPhase object
+        size_t colT = findColumn("T");
+        size_t colD = findColumn("D");
+        size_t colP = findColumn("P");
+        used[colT] = 1;
+        used[(colD != npos) ? colD : colP] = 1;
+        size_t nState = phase->stateSize();
+        vector<double> frac(nSpecies);
+        for (size_t i = 0; i < nRows; i++) {
+            for (size_t k = 0; k < nSpecies; k++) {
+                size_t col = speciesColumns[k];
+                frac[k] = (col == npos) ? 0. : numeric[col][i];
+            }
+            if (basis == "X") {
+                phase->setMoleFractions_NoNorm(frac.data());
+            } else {
+                phase->setMassFractions_NoNorm(frac.data());
+            }
+            if (colD != npos) {
+                phase->setState_TD(numeric[colT][i], numeric[colD][i]);
+            } else {
+                phase->setState_TP(numeric[colT][i], numeric[colP][i]);
+            }
+            phase->saveState(nState, m_data->data() + i * m_stride);
+        }
+    } else {
+        throw NotImplementedError("SolutionArray::readEntry",
+            "Unable to restore state information from CSV columns '{}'.",
+            ba::join(labels, "', '"));
+    }
+
+    // restore remaining data
+    bool back = false;
+    for (size_t col = 0; col < nCols; col++) {
+        if (used[col]) {
+            back = true;
+            continue;
+        }
+        const auto& name = labels[col];
+        AnyValue data;
+        if (isText[col]) {
+            data = std::move(text[col]);
+        } else if (isInteger[col] && nRows) {
+            data = vector<long int>(numeric[col].begin(), numeric[col].end());
+        } else {
+            data = std::move(numeric[col]);
+        }
+        if (!hasComponent(name)) {
+            addExtra(name, back);
+        }
+        setComponent(name, data);
+    }
+}
+
+void SolutionArray::readEntry(const string& fname, const string& name,
+                              const string& sub, size_t start, size_t count)
+{
+    Storage file(fname, false);
+    if (name == "") {
+        throw CanteraError("SolutionArray::readEntry",
+            "Group name specifying root location must not be empty.");
+    }
+    string path = locateGroup(file, name, sub);
     if (!file.checkGroup(path)) {
         throw CanteraError("SolutionArray::readEntry",
             "Group name specifying data entry is empty.");
@@ -1667,16 +2320,30 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     m_extra->clear();
     auto [size, names] = file.contents(path);
     m_meta = file.readAttributes(path, true);
-    if (m_meta.hasKey("size")) {
-        // one-dimensional array
-        resize(m_meta["size"].as<long int>());
-        m_meta.erase("size");
-    } else if (m_meta.hasKey("api-shape")) {
+    // offset of hyperslab within stored data; npos reads complete datasets
+    size_t offset = npos;
+    if (m_meta.hasKey("api-shape")) {
         // API uses multiple dimensions to interpret C++ SolutionArray
+        if (start != 0 || count != npos) {
+            throw NotImplementedError("SolutionArray::readEntry",
+                "Unable to read partial data of multi-dimensional arrays.");
+        }
         setApiShape(m_meta["api-shape"].asVector<long int>());
         m_meta.erase("api-shape");
     } else {
-        // legacy format; size needs to be detected
+        if (m_meta.hasKey("size")) {
+            // one-dimensional array
+            size = m_meta["size"].as<long int>();
+            m_meta.erase("size");
+        } // else: legacy format; size is detected from contents
+        if (start != 0 || count != npos) {
+            if (start > size) {
+                throw IndexError("SolutionArray::readEntry", "rows", start, size);
+            }
+            count = std::min(count, size - start);
+            offset = start;
+            size = count;
+        }
         resize(static_cast<int>(size));
     }
 
@@ -1705,28 +2372,28 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     const auto& nativeStates = m_sol->thermo()->nativeState();
     if (mode == "native") {
         // native state can be written directly into data storage
-        for (const auto& [name, offset] : nativeStates) {
-            if (name == "X" || name == "Y") {
+        for (const auto& [key, loc] : nativeStates) {
+            if (key == "X" || key == "Y") {
                 AnyValue data;
-                data = file.readData(path, name, m_size, nSpecies);
+                data = file.readData(path, key, m_dataSize, nSpecies, offset);
                 auto prop = data.asVector<vector<double>>();
                 for (size_t i = 0; i < m_dataSize; i++) {
                     std::copy(prop[i].begin(), prop[i].end(),
-                              m_data->data() + offset + i * m_stride);
+                              m_data->data() + loc + i * m_stride);
                 }
             } else {
                 AnyValue data;
-                data = file.readData(path, getName(names, name), m_dataSize, 0);
-                setComponent(name, data);
+                data = file.readData(path, getName(names, key), m_dataSize, 0, offset);
+                setComponent(key, data);
             }
         }
     } else if (mode == "TPX") {
         AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "T"), m_dataSize, 0, offset);
         vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "P"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "P"), m_dataSize, 0, offset);
         vector<double> P = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
+        data = file.readData(path, "X", m_dataSize, nSpecies, offset);
         vector<vector<double>> X = std::move(data.asVector<vector<double>>());
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
@@ -1735,11 +2402,11 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         }
     } else if (mode == "TDX") {
         AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "T"), m_dataSize, 0, offset);
         vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "D"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "D"), m_dataSize, 0, offset);
         vector<double> D = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
+        data = file.readData(path, "X", m_dataSize, nSpecies, offset);
         vector<vector<double>> X = std::move(data.asVector<vector<double>>());
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
@@ -1748,11 +2415,11 @@ void SolutionArray::readEntry(const string& fname, const string& name,
         }
     } else if (mode == "TPY") {
         AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "T"), m_dataSize, 0, offset);
         vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "P"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "P"), m_dataSize, 0, offset);
         vector<double> P = std::move(data.asVector<double>());
-        data = file.readData(path, "Y", m_dataSize, nSpecies);
+        data = file.readData(path, "Y", m_dataSize, nSpecies, offset);
         vector<vector<double>> Y = std::move(data.asVector<vector<double>>());
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMassFractions_NoNorm(Y[i].data());
@@ -1762,9 +2429,9 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     } else if (mode == "legacySurf") {
         // erroneous TDX mode (should be TPX or TPY) - Sim1D (Cantera 2.5)
         AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
+        data = file.readData(path, getName(names, "T"), m_dataSize, 0, offset);
         vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
+        data = file.readData(path, "X", m_dataSize, nSpecies, offset);
         vector<vector<double>> X = std::move(data.asVector<vector<double>>());
         for (size_t i = 0; i < m_dataSize; i++) {
             m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
@@ -1792,7 +2459,7 @@ void SolutionArray::readEntry(const string& fname, const string& name,
             } else {
                 addExtra(name, back);
                 AnyValue data;
-                data = file.readData(path, name, m_dataSize);
+                data = file.readData(path, name, m_dataSize, npos, offset);
                 setComponent(name, data);
             }
         }
@@ -1804,13 +2471,74 @@ void SolutionArray::readEntry(const string& fname, const string& name,
             if (!hasComponent(name) && name != "X" && name != "Y") {
                 addExtra(name);
                 AnyValue data;
-                data = file.readData(path, name, m_dataSize);
+                data = file.readData(path, name, m_dataSize, npos, offset);
                 setComponent(name, data);
             }
         }
     }
 }
 
+AnyMap SolutionArray::readComponents(const string& fname, const string& name,
+                                     const string& sub,
+                                     const vector<string>& components,
+                                     size_t start, size_t count) const
+{
+    if (name == "") {
+        throw CanteraError("SolutionArray::readComponents",
+            "Group name specifying root location must not be empty.");
+    }
+    Storage file(fname, false);
+    string path = locateGroup(file, name, sub);
+    if (!file.checkGroup(path)) {
+        throw CanteraError("SolutionArray::readComponents",
+            "Group name specifying data entry is empty.");
+    }
+    auto [size, names] = file.contents(path);
+    AnyMap attributes = file.readAttributes(path, false);
+    if (attributes.hasKey("size")) {
+        size = attributes["size"].as<long int>();
+    } else if (attributes.hasKey("api-shape")) {
+        // entries are read from flattened data
+        size = 1;
+        for (auto dim : attributes["api-shape"].asVector<long int>()) {
+            size *= dim;
+        }
+    }
+    if (start > size) {
+        throw IndexError("SolutionArray::readComponents", "rows", start, size);
+    }
+    count = std::min(count, size - start);
+
+    // species are retrieved as columns of stored mole or mass fractions
+    string fractions = names.count("X") ? "X" : (names.count("Y") ? "Y" : "");
+    vector<string> species;
+    vector<size_t> columns;
+    AnyMap out;
+    for (const auto& component : components) {
+        if (names.count(component) ||
+            (aliasMap.count(component) && names.count(aliasMap.at(component))))
+        {
+            out[component] = file.readData(
+                path, getName(names, component), count, npos, start);
+        } else if (fractions != "" &&
+                   m_sol->thermo()->speciesIndex(component) != npos)
+        {
+            species.push_back(component);
+            columns.push_back(m_sol->thermo()->speciesIndex(component));
+        } else {
+            throw CanteraError("SolutionArray::readComponents",
+                "Component '{}' not found in group '{}'.", component, path);
+        }
+    }
+    if (columns.size()) {
+        auto data = file.readColumns(path, fractions, columns, start, count);
+        for (size_t i = 0; i < species.size(); i++) {
+            out[species[i]] = data[i];
+        }
+    }
+    return out;
+}
+
 void SolutionArray::readEntry(const AnyMap& root, const string& name, const string& sub)
 {
     if (name == "") {
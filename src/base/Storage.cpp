@@ -383,8 +383,8 @@ void Storage::writeAttributes(const string& id, const AnyMap& meta)
     }
 }
 
-AnyValue Storage::readData(const string& id,
-                           const string& name, size_t rows, size_t cols) const
+AnyValue Storage::readData(const string& id, const string& name, size_t rows,
+                           size_t cols, size_t offset) const
 {
     try {
         checkGroupRead(id);
@@ -414,27 +414,40 @@ AnyValue Storage::readData(const string& id,
             "Cannot process DataSet '{}' as data has {} dimensions.", name, ndim);
     }
     const auto& shape = space.getDimensions();
-    if (shape[0] != rows) {
+    if (offset == npos && shape[0] != rows) {
         throw CanteraError("Storage::readData",
             "Shape of DataSet '{}' is inconsistent; expected {} rows "
             "but received {}.", name, rows, shape[0]);
+    } else if (offset != npos && offset + rows > shape[0]) {
+        throw CanteraError("Storage::readData",
+            "Unable to read rows {} to {} of DataSet '{}' with {} rows.",
+            offset, offset + rows, name, shape[0]);
     }
     if (cols != 0 && cols != npos && shape[1] != cols) {
         throw CanteraError("Storage::readData",
             "Shape of DataSet '{}' is inconsistent; expected {} columns "
             "but received {}.", name, cols, shape[1]);
     }
+    auto read = [&](auto& data) {
+        if (offset == npos) {
+            dataset.read(data);
+        } else if (ndim == 1) {
+            dataset.select({offset}, {rows}).read(data);
+        } else {
+            dataset.select({offset, 0}, {rows, shape[1]}).read(data);
+        }
+    };
     AnyValue out;
     const auto datatype = dataset.getDataType().getClass();
     if (datatype == h5::DataTypeClass::Float) {
         try {
             if (ndim == 1) {
                 vector<double> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<double>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -446,11 +459,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<long int> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<long int>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -462,11 +475,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<string> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<string>> data;
-                dataset.read(data);
+                read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -481,6 +494,77 @@ AnyValue Storage::readData(const string& id,
     return out;
 }
 
+vector<vector<double>> Storage::readColumns(const string& id, const string& name,
+                                            const vector<size_t>& columns,
+                                            size_t offset, size_t rows) const
+{
+    try {
+        checkGroupRead(id);
+    } catch (const CanteraError& err) {
+        throw CanteraError("Storage::readColumns",
+            "Caught exception for group '{}':\n{}", id, err.getMessage());
+    }
+    h5::Group sub = m_file->getGroup(id);
+    if (!sub.exist(name)) {
+        throw CanteraError("Storage::readColumns",
+            "DataSet '{}' not found in group '{}'.", name, id);
+    }
+    h5::DataSet dataset = sub.getDataSet(name);
+    const auto shape = dataset.getSpace().getDimensions();
+    if (shape.size() != 2) {
+        throw CanteraError("Storage::readColumns",
+            "Shape of DataSet '{}' is inconsistent; expected two dimensions but "
+            "received {}.", name, shape.size());
+    }
+    if (dataset.getDataType().getClass() != h5::DataTypeClass::Float) {
+        throw CanteraError("Storage::readColumns",
+            "DataSet '{}' does not hold floating point data.", name);
+    }
+    if (offset + rows > shape[0]) {
+        throw CanteraError("Storage::readColumns",
+            "Unable to read rows {} to {} of DataSet '{}' with {} rows.",
+            offset, offset + rows, name, shape[0]);
+    }
+    vector<vector<double>> out;
+    out.reserve(columns.size());
+    vector<vector<double>> buffer;
+    for (size_t col : columns) {
+        if (col >= shape[1]) {
+            throw IndexError("Storage::readColumns", name, col, shape[1]);
+        }
+        try {
+            dataset.select({offset, col}, {rows, 1}).read(buffer);
+        } catch (const std::exception& err) {
+            throw CanteraError("Storage::readColumns",
+                "Encountered HighFive exception for DataSet '{}' in group '{}':\n{}",
+                name, id, err.what());
+        }
+        auto& column = out.emplace_back(rows);
+        for (size_t i = 0; i < rows; i++) {
+            column[i] = buffer[i][0];
+        }
+    }
+    return out;
+}
+
+void Storage::deleteAttribute(const string& id, const string& attr)
+{
+    try {
+        checkGroupWrite(id, false);
+        h5::Group sub = m_file->getGroup(id);
+        if (sub.hasAttribute(attr)) {
+            sub.deleteAttribute(attr);
+        }
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::deleteAttribute", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::deleteAttribute",
+            "Encountered exception for group '{}':\n{}", id, err.what());
+    }
+}
+
 void Storage::writeData(const string& id, const string& name, const AnyValue& data)
 {
     try {
@@ -570,6 +654,101 @@ void Storage::writeData(const string& id, const string& name, const AnyValue& da
     }
 }
 
+size_t Storage::appendData(const string& id, const string& name,
+                           const AnyValue& data, size_t chunk)
+{
+    try {
+        checkGroupWrite(id, false);
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::appendData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for group '{}':\n{}", id, err.what());
+    }
+    h5::Group sub = m_file->getGroup(id);
+    size_t rows;
+    size_t cols = 0;
+    if (data.isVector<double>() || data.isVector<long int>()) {
+        rows = data.vectorSize();
+    } else if (data.isVector<vector<double>>() || data.isVector<vector<long int>>()) {
+        std::tie(rows, cols) = data.matrixShape();
+        if (cols == npos) {
+            throw CanteraError("Storage::appendData",
+                "Cannot append DataSet '{}' in group '{}' as input data is not a "
+                "regular matrix.", name, id);
+        }
+    } else {
+        throw NotImplementedError("Storage::appendData",
+            "Cannot append DataSet '{}' in group '{}' as input data with type\n"
+            "'{}'\nis not supported.", name, id, data.type_str());
+    }
+
+    try {
+        h5::DataSet dataset = [&]() {
+            if (sub.exist(name)) {
+                return sub.getDataSet(name);
+            }
+            // create extendable dataset; unlimited dimensions require chunking
+            vector<size_t> dims{0};
+            vector<size_t> maxDims{h5::DataSpace::UNLIMITED};
+            vector<hsize_t> chunkDims{std::max(chunk, size_t(1))};
+            if (cols) {
+                dims.push_back(cols);
+                maxDims.push_back(cols);
+                chunkDims.push_back(cols);
+            }
+            h5::DataSetCreateProps props;
+            props.add(h5::Chunking(chunkDims));
+            if (m_compressionLevel) {
+                props.add(h5::Deflate(m_compressionLevel));
+            }
+            h5::DataSpace space(dims, maxDims);
+            if (data.isVector<double>() || data.isVector<vector<double>>()) {
+                return sub.createDataSet<double>(name, space, props);
+            }
+            return sub.createDataSet<long int>(name, space, props);
+        }();
+
+        auto shape = dataset.getSpace().getDimensions();
+        if (shape.size() != (cols ? 2 : 1) || (cols && shape[1] != cols)) {
+            throw CanteraError("Storage::appendData",
+                "Shape of existing DataSet '{}' in group '{}' is inconsistent with "
+                "appended data.", name, id);
+        }
+        size_t offset = shape[0];
+        if (!rows) {
+            return offset;
+        }
+        shape[0] = offset + rows;
+        dataset.resize(shape);
+        if (cols) {
+            auto selection = dataset.select({offset, 0}, {rows, cols});
+            if (data.isVector<vector<double>>()) {
+                selection.write(data.asVector<vector<double>>());
+            } else {
+                selection.write(data.asVector<vector<long int>>());
+            }
+        } else {
+            auto selection = dataset.select({offset}, {rows});
+            if (data.isVector<double>()) {
+                selection.write(data.asVector<double>());
+            } else {
+                selection.write(data.asVector<long int>());
+            }
+        }
+        return offset + rows;
+    } catch (const CanteraError&) {
+        throw;
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
+    }
+}
+
 #else
 
 Storage::Storage(string fname, bool write)
@@ -630,13 +809,27 @@ void Storage::writeAttributes(const string& id, const AnyMap& meta)
                        "Saving to HDF requires HighFive installation.");
 }
 
-AnyValue Storage::readData(const string& id,
-                           const string& name, size_t rows, size_t cols) const
+void Storage::deleteAttribute(const string& id, const string& attr)
+{
+    throw CanteraError("Storage::deleteAttribute",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+AnyValue Storage::readData(const string& id, const string& name, size_t rows,
+                           size_t cols, size_t offset) const
 {
     throw CanteraError("Storage::readData",
                        "Saving to HDF requires HighFive installation.");
 }
 
+vector<vector<double>> Storage::readColumns(const string& id, const string& name,
+                                            const vector<size_t>& columns,
+                                            size_t offset, size_t rows) const
+{
+    throw CanteraError("Storage::readColumns",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 void Storage::writeData(const string& id,
                         const string& name, const AnyValue& data)
 {
@@ -644,6 +837,13 @@ void Storage::writeData(const string& id,
                        "Saving to HDF requires HighFive installation.");
 }
 
+size_t Storage::appendData(const string& id, const string& name,
+                           const AnyValue& data, size_t chunk)
+{
+    throw CanteraError("Storage::appendData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 #endif
 
 }
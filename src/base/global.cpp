@@ -12,6 +12,7 @@
 #include <boost/core/demangle.hpp>
 
 #include <signal.h>
+#include <thread>
 
 namespace Cantera
 {
@@ -142,6 +143,89 @@ void thread_complete()
     app()->thread_complete();
 }
 
+namespace {
+
+//! Logger buffering messages issued by worker threads of parallelFor(); an entry
+//! with an empty warning type and message represents an end of line
+class BufferedLogger : public Logger
+{
+public:
+    explicit BufferedLogger(vector<pair<string, string>>& buffer)
+        : m_buffer(buffer) {}
+
+    void write(const string& msg) override {
+        if (msg.size()) {
+            m_buffer.emplace_back("", msg);
+        }
+    }
+
+    void writeendl() override {
+        m_buffer.emplace_back("", "");
+    }
+
+    void warn(const string& warning, const string& msg) override {
+        m_buffer.emplace_back(warning, msg);
+    }
+
+private:
+    vector<pair<string, string>>& m_buffer;
+};
+
+}
+
+void parallelFor(size_t n, const function<void(size_t)>& task, size_t minChunk)
+{
+    size_t nThreads = std::thread::hardware_concurrency();
+    nThreads = std::max<size_t>(std::min(nThreads, n / std::max<size_t>(minChunk, 1)),
+                                1);
+    if (nThreads == 1) {
+        for (size_t i = 0; i < n; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    vector<vector<pair<string, string>>> buffers(nThreads);
+    vector<std::exception_ptr> errors(nThreads);
+    auto run = [&](size_t w) {
+        try {
+            for (size_t i = w * n / nThreads; i < (w + 1) * n / nThreads; i++) {
+                task(i);
+            }
+        } catch (...) {
+            errors[w] = std::current_exception();
+        }
+    };
+    vector<std::thread> threads;
+    for (size_t w = 1; w < nThreads; w++) {
+        threads.emplace_back([&run, &buffers, w]() {
+            setLogger(new BufferedLogger(buffers[w]));
+            run(w);
+            thread_complete();
+        });
+    }
+    run(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& buffer : buffers) {
+        for (const auto& [warning, msg] : buffer) {
+            if (warning.size()) {
+                app()->warnlog(warning, msg);
+            } else if (msg.size()) {
+                app()->writelog(msg);
+            } else {
+                app()->writelogendl();
+            }
+        }
+    }
+    for (auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
 string version()
 {
     return CANTERA_VERSION;
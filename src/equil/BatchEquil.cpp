@@ -0,0 +1,156 @@
+//! @file BatchEquil.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/equil/BatchEquil.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/base/global.h"
+#include <deque>
+#include <thread>
+
+namespace Cantera
+{
+
+void BatchEquil::setSolver(const string& solver)
+{
+    if (solver != "auto" && solver != "element_potential" && solver != "vcs"
+        && solver != "gibbs")
+    {
+        throw CanteraError("BatchEquil::setSolver",
+                           "Invalid solver specified: '{}'", solver);
+    }
+    m_solver = solver;
+}
+
+shared_ptr<SolutionArray> BatchEquil::equilibrate(SolutionArray& states,
+                                                  const string& XY)
+{
+    size_t nStates = states.size();
+    shared_ptr<Solution> sol = states.solution();
+    // Retrieving states changes the state of the shared Solution object, so all
+    // input states are read before starting the worker threads
+    vector<vector<double>> data(nStates);
+    for (size_t i = 0; i < nStates; i++) {
+        data[i] = states.getState(static_cast<int>(i));
+    }
+
+    size_t nThreads = m_maxThreads;
+    if (nThreads == 0) {
+        nThreads = std::thread::hardware_concurrency();
+    }
+    nThreads = std::max<size_t>(std::min(nThreads, nStates), 1);
+
+    // Solution::clone() uses the global factories, so the copies used by the
+    // threads are created before the parallel section
+    vector<shared_ptr<Solution>> copies;
+    for (size_t w = 0; w < nThreads; w++) {
+        copies.push_back(sol->clone());
+    }
+
+    // States are split into contiguous ranges, each of which is processed using one
+    // of the copies
+    bool useChemEquil = (m_solver == "auto" || m_solver == "element_potential");
+    vector<size_t> nWarm(nThreads, 0), nFallback(nThreads, 0), nIter(nThreads, 0);
+    parallelFor(nThreads, [&](size_t w) {
+        ThermoPhase& phase = *copies[w]->thermo();
+        size_t nElem = phase.nElements();
+        ChemEquil equil;
+        equil.options.maxIterations = m_maxSteps;
+        equil.options.relTolerance = m_rtol;
+        // Features of the initial states and converged solutions of recently
+        // solved states, used to find warm starts
+        std::deque<pair<vector<double>, vector<double>>> recent;
+        vector<double> features(nElem + 2);
+        size_t iEnd = (w + 1) * nStates / nThreads;
+        for (size_t i = w * nStates / nThreads; i < iEnd; i++) {
+            try {
+                phase.restoreState(data[i]);
+                if (!useChemEquil) {
+                    phase.equilibrate(XY, m_solver, m_rtol, m_maxSteps, m_maxIter);
+                    phase.saveState(data[i]);
+                    continue;
+                }
+                features[0] = phase.temperature();
+                features[1] = std::log(phase.pressure());
+                for (size_t m = 0; m < nElem; m++) {
+                    features[m + 2] = phase.elementalMassFraction(m);
+                }
+                const vector<double>* nearest = nullptr;
+                double dmin = 0.0;
+                for (const auto& [f, x] : recent) {
+                    double dT = (features[0] - f[0]) / features[0];
+                    double d = dT * dT;
+                    for (size_t n = 1; n < features.size(); n++) {
+                        d += (features[n] - f[n]) * (features[n] - f[n]);
+                    }
+                    if (!nearest || d < dmin) {
+                        nearest = &x;
+                        dmin = d;
+                    }
+                }
+                if (nearest) {
+                    equil.setInitialEstimate(*nearest);
+                }
+                try {
+                    equil.equilibrate(phase, XY.c_str());
+                    nIter[w] += equil.options.iterations;
+                    if (equil.warmStarted()) {
+                        nWarm[w]++;
+                    }
+                    if (m_window) {
+                        recent.emplace_front(features, equil.lastSolution());
+                        if (recent.size() > m_window) {
+                            recent.pop_back();
+                        }
+                    }
+                } catch (CanteraError&) {
+                    if (m_solver != "auto") {
+                        throw;
+                    }
+                    phase.restoreState(data[i]);
+                    phase.equilibrate(XY, "vcs", m_rtol, m_maxSteps, m_maxIter);
+                    nFallback[w]++;
+                }
+                phase.saveState(data[i]);
+            } catch (CanteraError& err) {
+                throw CanteraError("BatchEquil::equilibrate", "Equilibrium "
+                    "calculation failed for state {}:\n{}", i, err.getMessage());
+            }
+        }
+    });
+
+    m_nStates = nStates;
+    m_nWarm = m_nFallback = m_nIter = 0;
+    for (size_t w = 0; w < nThreads; w++) {
+        m_nWarm += nWarm[w];
+        m_nFallback += nFallback[w];
+        m_nIter += nIter[w];
+    }
+
+    auto out = SolutionArray::create(sol, static_cast<int>(nStates), states.meta());
+    for (size_t i = 0; i < nStates; i++) {
+        out->setState(static_cast<int>(i), data[i]);
+    }
+    for (const auto& name : states.listExtra()) {
+        out->addExtra(name);
+        out->setComponent(name, states.getComponent(name));
+    }
+    out->setApiShape(states.apiShape());
+    return out;
+}
+
+AnyMap BatchEquil::stats() const
+{
+    AnyMap stats;
+    stats["states"] = static_cast<long int>(m_nStates);
+    stats["warm_starts"] = static_cast<long int>(m_nWarm);
+    stats["fallbacks"] = static_cast<long int>(m_nFallback);
+    stats["iterations"] = static_cast<long int>(m_nIter);
+    return stats;
+}
+
+}
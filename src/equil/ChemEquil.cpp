@@ -47,6 +47,25 @@ ChemEquil::ChemEquil(ThermoPhase& s)
 
 void ChemEquil::initialize(ThermoPhase& s)
 {
+    if (m_phase == &s && m_kk == s.nSpecies() && m_mm == s.nElements()) {
+        // Keep the work arrays and last solution if the elemental composition
+        // matrix is unchanged
+        bool same = true;
+        for (size_t k = 0; k < m_kk && same; k++) {
+            for (size_t m = 0; m < m_mm; m++) {
+                if (m_comp[k*m_mm + m] != s.nAtoms(k,m)) {
+                    same = false;
+                    break;
+                }
+            }
+        }
+        if (same) {
+            return;
+        }
+    }
+    m_lastSolution.clear();
+    m_lastInput.clear();
+
     // store a pointer to s and some of its properties locally.
     m_phase = &s;
     m_p0 = s.refPressure();
@@ -198,6 +217,23 @@ int ChemEquil::setInitialMoles(ThermoPhase& s, vector<double>& elMoleGoal, int l
     return 0;
 }
 
+void ChemEquil::updateComponents(ThermoPhase& s, vector<double>& elMolesGoal)
+{
+    MultiPhase mp;
+    mp.addPhase(&s, 1.0);
+    mp.init();
+    int usedZeroedSpecies = 0;
+    vector<double> formRxnMatrix;
+    m_nComponents = BasisOptimize(&usedZeroedSpecies, false,
+                                  &mp, m_orderVectorSpecies,
+                                  m_orderVectorElements, formRxnMatrix);
+    for (size_t m = 0; m < m_nComponents; m++) {
+        m_component[m] = m_orderVectorSpecies[m];
+    }
+    ElemRearrange(m_nComponents, elMolesGoal, &mp,
+                  m_orderVectorSpecies, m_orderVectorElements);
+}
+
 int ChemEquil::estimateElementPotentials(ThermoPhase& s, vector<double>& lambda_RT,
         vector<double>& elMolesGoal, int loglevel)
 {
@@ -212,26 +248,14 @@ int ChemEquil::estimateElementPotentials(ThermoPhase& s, vector<double>& lambda_
     s.setMoleFractions(xMF_est.data());
     s.getMoleFractions(xMF_est.data());
 
-    MultiPhase mp;
-    mp.addPhase(&s, 1.0);
-    mp.init();
-    int usedZeroedSpecies = 0;
-    vector<double> formRxnMatrix;
-    m_nComponents = BasisOptimize(&usedZeroedSpecies, false,
-                                  &mp, m_orderVectorSpecies,
-                                  m_orderVectorElements, formRxnMatrix);
-
+    updateComponents(s, elMolesGoal);
     for (size_t m = 0; m < m_nComponents; m++) {
-        size_t k = m_orderVectorSpecies[m];
-        m_component[m] = k;
+        size_t k = m_component[m];
         xMF_est[k] = std::max(xMF_est[k], 1e-8);
     }
     s.setMoleFractions(xMF_est.data());
     s.getMoleFractions(xMF_est.data());
 
-    ElemRearrange(m_nComponents, elMolesGoal, &mp,
-                  m_orderVectorSpecies, m_orderVectorElements);
-
     s.getChemPotentials(mu_RT.data());
     scale(mu_RT.begin(), mu_RT.end(), mu_RT.begin(),
           1.0/(GasConstant* s.temperature()));
@@ -295,11 +319,59 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
     initialize(s);
     update(s);
     vector<double> elMolesGoal = m_elementmolefracs;
-    return equilibrate(s, XY, elMolesGoal, loglevel-1);
+    vector<double> input = elMolesGoal;
+    input.push_back(log(s.pressure()));
+    if (m_reuseTol > 0 && m_initialEstimate.empty() && !m_lastInput.empty()) {
+        // Start from the last solution if the element abundances and pressure are
+        // close to those of the last problem
+        double dmax = 0.0;
+        for (size_t m = 0; m <= m_mm; m++) {
+            dmax = std::max(dmax, fabs(input[m] - m_lastInput[m]));
+        }
+        if (dmax < m_reuseTol) {
+            setInitialEstimate(m_lastSolution);
+        }
+    }
+    int ret = equilibrate(s, XY, elMolesGoal, loglevel-1);
+    if (ret >= 0) {
+        m_lastInput = input;
+    }
+    return ret;
 }
 
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector<double>& elMolesGoal, int loglevel)
+{
+    m_warmStarted = false;
+    if (m_initialEstimate.empty()) {
+        return solveEquil(s, XYstr, elMolesGoal, false, loglevel);
+    }
+    vector<double> state;
+    s.saveState(state);
+    try {
+        int ret = solveEquil(s, XYstr, elMolesGoal, true, loglevel);
+        m_initialEstimate.clear();
+        m_warmStarted = true;
+        return ret;
+    } catch (CanteraError& err) {
+        // Retry using the default starting estimate
+        m_initialEstimate.clear();
+        if (loglevel > 0) {
+            writelog("ChemEquil::equilibrate: Starting from the initial estimate "
+                     "failed:\n{}\n", err.getMessage());
+        }
+        s.restoreState(state);
+        return solveEquil(s, XYstr, elMolesGoal, false, loglevel);
+    }
+}
+
+void ChemEquil::setInitialEstimate(const vector<double>& x)
+{
+    m_initialEstimate = x;
+}
+
+int ChemEquil::solveEquil(ThermoPhase& s, const char* XYstr,
+                          vector<double>& elMolesGoal, bool warmStart, int loglevel)
 {
     int fail = 0;
     bool tempFixed = true;
@@ -381,18 +453,26 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     // specified property calculation.
     //
     // We choose the equation of the element with the highest element abundance.
-    double tmp = -1.0;
-    for (size_t im = 0; im < m_nComponents; im++) {
-        size_t m = m_orderVectorElements[im];
-        if (elMolesGoal[m] > tmp) {
-            m_skip = m;
-            tmp = elMolesGoal[m];
+    // Initially, elements are considered in their original order. The component
+    // basis retained from a previous call is not used, since it may not apply to
+    // the new element abundances; for a warm start, the choice is repeated among
+    // the component elements once the basis has been updated.
+    auto chooseSkip = [&](bool useBasis) {
+        double tmp = -1.0;
+        size_t nCandidates = useBasis ? m_nComponents : std::min(m_mm, m_kk);
+        for (size_t im = 0; im < nCandidates; im++) {
+            size_t m = useBasis ? m_orderVectorElements[im] : im;
+            if (elMolesGoal[m] > tmp) {
+                m_skip = m;
+                tmp = elMolesGoal[m];
+            }
         }
-    }
-    if (tmp <= 0.0) {
-        throw CanteraError("ChemEquil::equilibrate",
-                           "Element Abundance Vector is zeroed");
-    }
+        if (tmp <= 0.0) {
+            throw CanteraError("ChemEquil::equilibrate",
+                               "Element Abundance Vector is zeroed");
+        }
+    };
+    chooseSkip(false);
 
     // start with a composition with everything non-zero. Note that since we
     // have already save the target element moles, changing the composition at
@@ -409,8 +489,29 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
     double tmaxPhase = s.maxTemp();
     double tminPhase = s.minTemp();
+    int info = 0;
+    if (warmStart) {
+        // Start from the element potentials and temperature of a previously
+        // converged solution, skipping the estimation steps below.
+        if (m_initialEstimate.size() != nvar) {
+            throw CanteraError("ChemEquil::equilibrate", "Initial estimate has "
+                "length {}, but should have length {}",
+                m_initialEstimate.size(), nvar);
+        }
+        std::copy(m_initialEstimate.begin(), m_initialEstimate.begin() + mm,
+                  x.begin());
+        double t0 = s.temperature();
+        if (!tempFixed) {
+            t0 = clip(m_initialEstimate[mm], tminPhase, tmaxPhase);
+        }
+        setToEquilState(s, x, t0);
+        // The component basis of the previous problem may not be valid for the
+        // new element abundances
+        updateComponents(s, elMolesGoal);
+        chooseSkip(true);
+    }
     // loop to estimate T
-    if (!tempFixed) {
+    if (!tempFixed && !warmStart) {
         double tmin = std::max(s.temperature(), tminPhase);
         if (tmin > tmaxPhase) {
             tmin = tmaxPhase - 20;
@@ -481,24 +582,27 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
-
-    // Calculate initial estimates of the element potentials. This algorithm
-    // uses the MultiPhaseEquil object's initialization capabilities to
-    // calculate an initial estimate of the mole fractions for a set of linearly
-    // independent component species. Then, the element potentials are solved
-    // for based on the chemical potentials of the component species.
-    estimateElementPotentials(s, x, elMolesGoal);
-
-    // Do a better estimate of the element potentials. We have found that the
-    // current estimate may not be good enough to avoid drastic numerical issues
-    // associated with the use of a numerically generated Jacobian.
-    //
-    // The Brinkley algorithm assumes a constant T, P system and uses a
-    // linearized analytical Jacobian that turns out to be very stable.
-    int info = estimateEP_Brinkley(s, x, elMolesGoal);
-    if (info == 0) {
-        setToEquilState(s, x, s.temperature());
+    if (!warmStart) {
+        setInitialMoles(s, elMolesGoal,loglevel);
+
+        // Calculate initial estimates of the element potentials. This algorithm
+        // uses the MultiPhaseEquil object's initialization capabilities to
+        // calculate an initial estimate of the mole fractions for a set of
+        // linearly independent component species. Then, the element potentials
+        // are solved for based on the chemical potentials of the component
+        // species.
+        estimateElementPotentials(s, x, elMolesGoal);
+
+        // Do a better estimate of the element potentials. We have found that the
+        // current estimate may not be good enough to avoid drastic numerical
+        // issues associated with the use of a numerically generated Jacobian.
+        //
+        // The Brinkley algorithm assumes a constant T, P system and uses a
+        // linearized analytical Jacobian that turns out to be very stable.
+        info = estimateEP_Brinkley(s, x, elMolesGoal);
+        if (info == 0) {
+            setToEquilState(s, x, s.temperature());
+        }
     }
 
     // Install the log(temp) into the last solution unknown slot.
@@ -567,6 +671,8 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
             if (m_eloc != npos) {
                 adjustEloc(s, elMolesGoal);
             }
+            m_lastSolution.assign(x.begin(), x.begin() + mm);
+            m_lastSolution.push_back(s.temperature());
 
             if (s.temperature() > s.maxTemp() + 1.0 ||
                     s.temperature() < s.minTemp() - 1.0) {
@@ -15,6 +15,7 @@
 #include "cantera/equil/MultiPhase.h"
 #include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/thermo/ThermoPhase.h"
+#include "cantera/numerics/eigen_dense.h"
 
 using namespace std;
 
@@ -2127,14 +2128,17 @@ int VCS_SOLVE::vcs_report(int iconv)
 
 void VCS_SOLVE::vcs_elab()
 {
-    for (size_t j = 0; j < m_nelem; ++j) {
-        m_elemAbundances[j] = 0.0;
-        for (size_t i = 0; i < m_nsp; ++i) {
-            if (m_speciesUnknownType[i] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
-                m_elemAbundances[j] += m_formulaMatrix(i,j) * m_molNumSpecies_old[i];
-            }
+    m_molNumMasked.resize(m_nsp);
+    for (size_t i = 0; i < m_nsp; ++i) {
+        if (m_speciesUnknownType[i] != VCS_SPECIES_TYPE_INTERFACIALVOLTAGE) {
+            m_molNumMasked[i] = m_molNumSpecies_old[i];
+        } else {
+            m_molNumMasked[i] = 0.0;
         }
     }
+    ConstMappedMatrix F(m_formulaMatrix.ptrColumn(0), m_nsp, m_nelem);
+    MappedVector(&m_elemAbundances[0], m_nelem).noalias() =
+        F.transpose() * ConstMappedVector(m_molNumMasked.data(), m_nsp);
 }
 
 bool VCS_SOLVE::vcs_elabcheck(int ibound)
@@ -2338,7 +2342,8 @@ int VCS_SOLVE::vcs_elcorr(double aa[], double x[])
 
     // Ok, do the general case. Linear algebra problem is of length nc, not ne,
     // as there may be degenerate rows when nc .ne. ne.
-    DenseMatrix A(m_numComponents, m_numComponents);
+    DenseMatrix& A = m_compMatrix;
+    A.resize(m_numComponents, m_numComponents);
     for (size_t i = 0; i < m_numComponents; ++i) {
         x[i] = m_elemAbundances[i] - m_elemAbundancesGoal[i];
         if (fabs(x[i]) > 1.0E-13) {
@@ -13,6 +13,7 @@
 #include "cantera/base/clockWC.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/numerics/eigen_dense.h"
 
 #include <cstdio>
 
@@ -74,6 +75,7 @@ int VCS_SOLVE::vcs_solve_TP(int print_lvl, int printDetails, int maxit)
     m_sa.assign(m_nelem, 0.0);
     m_aw.assign(m_nsp, 0.0);
     m_wx.assign(m_nelem, 0.0);
+    m_zeroedComponents.reserve(m_nelem);
 
     int solveFail = false;
 
@@ -2018,7 +2020,7 @@ int VCS_SOLVE::vcs_basopt(const bool doJustComponents, double aw[], double sa[],
     size_t k;
     size_t juse = npos;
     size_t jlose = npos;
-    DenseMatrix C;
+    DenseMatrix& C = m_compMatrix;
     clockWC tickTock;
     if (m_debug_print_lvl >= 2) {
         plogf("   ");
@@ -2062,7 +2064,6 @@ int VCS_SOLVE::vcs_basopt(const bool doJustComponents, double aw[], double sa[],
     size_t ncTrial = std::min(m_nelem, m_nsp);
     m_numComponents = ncTrial;
     *usedZeroedSpecies = false;
-    vector<int> ipiv(ncTrial);
 
     // Use a temporary work array for the mole numbers, aw[]
     std::copy(m_molNumSpecies_old.begin(),
@@ -2211,32 +2212,23 @@ int VCS_SOLVE::vcs_basopt(const bool doJustComponents, double aw[], double sa[],
             for (size_t j = 0; j < m_nelem; ++j) {
                 sm[j + jr*m_nelem] = m_formulaMatrix(k,j);
             }
+            MappedVector smNew(sm + jr*m_nelem, m_nelem);
             if (jl > 0) {
                 // Compute the coefficients of JA column of the the upper
                 // triangular R matrix, SS(J) = R_J_JR this is slightly
                 // different than Dalquist) R_JA_JA = 1
-                for (size_t j = 0; j < jl; ++j) {
-                    ss[j] = 0.0;
-                    for (size_t i = 0; i < m_nelem; ++i) {
-                        ss[j] += sm[i + jr*m_nelem] * sm[i + j*m_nelem];
-                    }
-                    ss[j] /= sa[j];
-                }
+                MappedMatrix Q(sm, m_nelem, jl);
+                MappedVector ssv(ss, jl);
+                ssv.noalias() = Q.transpose() * smNew;
+                ssv.array() /= ConstMappedVector(sa, jl).array();
                 // Now make the new column, (*,JR), orthogonal to the previous
                 // columns
-                for (size_t j = 0; j < jl; ++j) {
-                    for (size_t i = 0; i < m_nelem; ++i) {
-                        sm[i + jr*m_nelem] -= ss[j] * sm[i + j*m_nelem];
-                    }
-                }
+                smNew.noalias() -= Q * ssv;
             }
 
             // Find the new length of the new column in Q. It will be used in
             // the denominator in future row calcs.
-            sa[jr] = 0.0;
-            for (size_t ml = 0; ml < m_nelem; ++ml) {
-                sa[jr] += pow(sm[ml + jr*m_nelem], 2);
-            }
+            sa[jr] = smNew.squaredNorm();
 
             // IF NORM OF NEW ROW .LT. 1E-3 REJECT
             if (sa[jr] > 1.0e-6) {
@@ -3107,60 +3099,51 @@ void VCS_SOLVE::vcs_deltag(const int L, const bool doDeleted,
         }
     }
 
-    if (L < 0) {
-        // MAJORS and ZEROED SPECIES ONLY
-        for (size_t irxn = 0; irxn < m_numRxnRdc; ++irxn) {
-            size_t kspec = irxn + m_numComponents;
-            if (m_speciesStatus[kspec] != VCS_SPECIES_MINOR) {
-                int icase = 0;
-                deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
-                double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-                for (kspec = 0; kspec < m_numComponents; ++kspec) {
-                    deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                    if (molNumSpecies[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF && dtmp_ptr[kspec] < 0.0) {
-                        icase = 1;
-                    }
-                }
-                if (icase) {
-                    deltaGRxn[irxn] = std::max(0.0, deltaGRxn[irxn]);
-                }
+    // Components with zero moles. Formation reactions which would consume one
+    // of these are not allowed to have a negative deltaG.
+    const double* molNumComp = (L > 0) ? &m_molNumSpecies_old[0] : molNumSpecies;
+    m_zeroedComponents.clear();
+    for (size_t j = 0; j < m_numComponents; ++j) {
+        if (molNumComp[j] < VCS_DELETE_MINORSPECIES_CUTOFF) {
+            m_zeroedComponents.push_back(j);
+        }
+    }
+    auto limitZeroedComponents = [&](size_t irxn) {
+        const double* sc = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
+        for (size_t j : m_zeroedComponents) {
+            if (sc[j] < 0.0) {
+                deltaGRxn[irxn] = std::max(0.0, deltaGRxn[irxn]);
+                return;
             }
         }
-    } else if (L == 0) {
+    };
+
+    ConstMappedVector feComponents(feSpecies, m_numComponents);
+    if (L == 0) {
         // ALL REACTIONS
+        //
+        // Evaluate the contributions of the components to all of the formation
+        // reactions as a single matrix-vector product.
+        Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<>> sc(
+            m_stoichCoeffRxnMatrix.ptrColumn(0), m_numComponents, irxnl,
+            Eigen::OuterStride<>(m_stoichCoeffRxnMatrix.nRows()));
+        MappedVector(deltaGRxn, irxnl).noalias() = sc.transpose() * feComponents;
         for (size_t irxn = 0; irxn < irxnl; ++irxn) {
-            int icase = 0;
-            deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
-            double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-            for (size_t kspec = 0; kspec < m_numComponents; ++kspec) {
-                deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                if (molNumSpecies[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF &&
-                        dtmp_ptr[kspec] < 0.0) {
-                    icase = 1;
-                }
-            }
-            if (icase) {
-                deltaGRxn[irxn] = std::max(0.0, deltaGRxn[irxn]);
-            }
+            deltaGRxn[irxn] += feSpecies[m_indexRxnToSpecies[irxn]];
+            limitZeroedComponents(irxn);
         }
     } else {
-        // MINORS AND ZEROED SPECIES
+        // L < 0: MAJORS and ZEROED SPECIES ONLY
+        // L > 0: MINORS AND ZEROED SPECIES
         for (size_t irxn = 0; irxn < m_numRxnRdc; ++irxn) {
-            size_t kspec = irxn + m_numComponents;
-            if (m_speciesStatus[kspec] <= VCS_SPECIES_MINOR) {
-                int icase = 0;
-                deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]];
-                double* dtmp_ptr = m_stoichCoeffRxnMatrix.ptrColumn(irxn);
-                for (kspec = 0; kspec < m_numComponents; ++kspec) {
-                    deltaGRxn[irxn] += dtmp_ptr[kspec] * feSpecies[kspec];
-                    if (m_molNumSpecies_old[kspec] < VCS_DELETE_MINORSPECIES_CUTOFF &&
-                            dtmp_ptr[kspec] < 0.0) {
-                        icase = 1;
-                    }
-                }
-                if (icase) {
-                    deltaGRxn[irxn] = std::max(0.0, deltaGRxn[irxn]);
-                }
+            int status = m_speciesStatus[irxn + m_numComponents];
+            if ((L < 0 && status != VCS_SPECIES_MINOR) ||
+                (L > 0 && status <= VCS_SPECIES_MINOR)) {
+                ConstMappedVector sc(m_stoichCoeffRxnMatrix.ptrColumn(irxn),
+                                     m_numComponents);
+                deltaGRxn[irxn] = feSpecies[m_indexRxnToSpecies[irxn]]
+                                  + sc.dot(feComponents);
+                limitZeroedComponents(irxn);
             }
         }
     }
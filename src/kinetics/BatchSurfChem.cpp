@@ -0,0 +1,149 @@
+//! @file BatchSurfChem.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/BatchSurfChem.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/base/global.h"
+#include <thread>
+
+namespace Cantera
+{
+
+BatchSurfChem::BatchSurfChem(shared_ptr<Solution> surf)
+    : m_surf(surf)
+{
+    if (!surf || !std::dynamic_pointer_cast<InterfaceKinetics>(surf->kinetics())) {
+        throw CanteraError("BatchSurfChem::BatchSurfChem",
+                           "Requires a Solution with interface kinetics.");
+    }
+}
+
+shared_ptr<SolutionArray> BatchSurfChem::solve(SolutionArray& gas)
+{
+    return run(gas, nullptr, 0.0);
+}
+
+shared_ptr<SolutionArray> BatchSurfChem::solve(SolutionArray& gas,
+                                               SolutionArray& initial)
+{
+    return run(gas, &initial, 0.0);
+}
+
+shared_ptr<SolutionArray> BatchSurfChem::advance(SolutionArray& gas,
+                                                 SolutionArray& initial, double dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("BatchSurfChem::advance",
+                           "Time interval must be positive; got {}.", dt);
+    }
+    return run(gas, &initial, dt);
+}
+
+shared_ptr<SolutionArray> BatchSurfChem::run(SolutionArray& gas,
+                                             SolutionArray* initial, double dt)
+{
+    size_t nStates = gas.size();
+    string gasName = gas.solution()->name();
+    bool found = false;
+    for (size_t n = 0; n < m_surf->nAdjacent(); n++) {
+        found = found || m_surf->adjacent(n)->name() == gasName;
+    }
+    if (!found) {
+        throw CanteraError("BatchSurfChem::run", "Phase '{}' is not adjacent to "
+            "interface '{}'.", gasName, m_surf->name());
+    }
+    if (gas.solution()->thermo()->speciesNames()
+        != m_surf->adjacent(gasName)->thermo()->speciesNames())
+    {
+        throw CanteraError("BatchSurfChem::run", "Species of SolutionArray do not "
+            "match species of adjacent phase '{}'.", gasName);
+    }
+    if (initial && static_cast<size_t>(initial->size()) != nStates) {
+        throw CanteraError("BatchSurfChem::run", "Size mismatch: {} gas states but "
+            "{} interface states.", nStates, initial->size());
+    }
+    if (initial && initial->solution()->thermo()->speciesNames()
+        != m_surf->thermo()->speciesNames())
+    {
+        throw CanteraError("BatchSurfChem::run", "Species of initial states do not "
+            "match species of interface '{}'.", m_surf->name());
+    }
+
+    // Retrieving states changes the state of the shared Solution objects, so all
+    // input states are read before starting the worker threads
+    vector<vector<double>> gasData(nStates), surfData(nStates);
+    for (size_t i = 0; i < nStates; i++) {
+        gasData[i] = gas.getState(static_cast<int>(i));
+        if (initial) {
+            surfData[i] = initial->getState(static_cast<int>(i));
+        }
+    }
+
+    size_t nThreads = m_maxThreads;
+    if (nThreads == 0) {
+        nThreads = std::thread::hardware_concurrency();
+    }
+    nThreads = std::max<size_t>(std::min(nThreads, nStates), 1);
+
+    // Each thread uses its own copy of the interface and its adjacent phases
+    vector<shared_ptr<Solution>> copies;
+    for (size_t w = 0; w < nThreads; w++) {
+        copies.push_back(m_surf->clone());
+    }
+
+    // States are split into contiguous ranges, each of which is processed using one
+    // of the copies
+    parallelFor(nThreads, [&](size_t w) {
+        ThermoPhase& surf = *copies[w]->thermo();
+        ThermoPhase& adj = *copies[w]->adjacent(gasName)->thermo();
+        auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(
+            copies[w]->kinetics());
+        // Integrator for advance(), set up for the first state and reinitialized
+        // for each subsequent state. The step size is limited to the time interval
+        // in the same way as by InterfaceKinetics::advanceCoverages.
+        unique_ptr<ImplicitSurfChem> integ;
+        if (dt > 0.0) {
+            integ = make_unique<ImplicitSurfChem>(vector<InterfaceKinetics*>{kin.get()},
+                m_rtol, m_atol, dt, m_maxSteps);
+        }
+        bool first = true;
+        size_t iEnd = (w + 1) * nStates / nThreads;
+        for (size_t i = w * nStates / nThreads; i < iEnd; i++) {
+            try {
+                adj.restoreState(gasData[i]);
+                if (initial) {
+                    surf.restoreState(surfData[i]);
+                }
+                surf.setState_TP(adj.temperature(), adj.pressure());
+                if (dt > 0.0 && first) {
+                    integ->integrate(0.0, dt);
+                    first = false;
+                } else if (dt > 0.0) {
+                    integ->reinitialize(0.0);
+                    integ->integrate0(0.0, dt);
+                } else {
+                    kin->solvePseudoSteadyStateProblem();
+                }
+            } catch (CanteraError& err) {
+                throw CanteraError("BatchSurfChem::run", "Surface coverage "
+                    "calculation failed for state {}:\n{}", i, err.getMessage());
+            }
+            surf.saveState(surfData[i]);
+        }
+    });
+
+    auto out = SolutionArray::create(m_surf, static_cast<int>(nStates), gas.meta());
+    for (size_t i = 0; i < nStates; i++) {
+        out->setState(static_cast<int>(i), surfData[i]);
+    }
+    out->setApiShape(gas.apiShape());
+    return out;
+}
+
+}
@@ -0,0 +1,148 @@
+//! @file BruteForceSensitivity.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/BruteForceSensitivity.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/base/global.h"
+#include <atomic>
+#include <thread>
+
+namespace Cantera
+{
+
+BruteForceSensitivity::BruteForceSensitivity(shared_ptr<Solution> sol)
+    : m_sol(sol)
+{
+    if (!m_sol || !m_sol->thermo() || !m_sol->kinetics()) {
+        throw CanteraError("BruteForceSensitivity::BruteForceSensitivity",
+                           "Solution object must contain a Kinetics object.");
+    }
+}
+
+void BruteForceSensitivity::setPerturbation(double dk)
+{
+    if (dk == 0.0) {
+        throw CanteraError("BruteForceSensitivity::setPerturbation",
+                           "Perturbation must be non-zero.");
+    }
+    m_dk = dk;
+}
+
+void BruteForceSensitivity::addObjectiveName(const string& name)
+{
+    if (std::find(m_names.begin(), m_names.end(), name) != m_names.end()) {
+        throw CanteraError("BruteForceSensitivity::addObjectiveName",
+                           "Objective '{}' already exists.", name);
+    }
+    m_names.push_back(name);
+}
+
+shared_ptr<SolutionArray> BruteForceSensitivity::compute()
+{
+    if (m_names.empty()) {
+        throw CanteraError("BruteForceSensitivity::compute", "No objectives defined.");
+    }
+    size_t nr = m_sol->kinetics()->nReactions();
+    vector<size_t> reactions = m_reactions;
+    if (reactions.empty()) {
+        for (size_t i = 0; i < nr; i++) {
+            reactions.push_back(i);
+        }
+    }
+    for (size_t i : reactions) {
+        m_sol->kinetics()->checkReactionIndex(i);
+    }
+    size_t nObj = m_names.size();
+    size_t nRuns = reactions.size();
+    size_t nThreads = m_maxThreads;
+    if (nThreads == 0) {
+        nThreads = std::thread::hardware_concurrency();
+    }
+    nThreads = std::max<size_t>(std::min(nThreads, nRuns), 1);
+
+    // Each worker owns a separate model, set up on the calling thread
+    vector<unique_ptr<Worker>> workers;
+    for (size_t w = 0; w < nThreads; w++) {
+        workers.push_back(newWorker(cloneSolution(m_sol)));
+    }
+    m_base.assign(nObj, 0.0);
+    workers[0]->solve(false, m_base);
+
+    vector<double> sens(nRuns * nObj, NAN);
+    std::atomic<size_t> next{0};
+    std::atomic<long int> failed{0};
+    // Runs are assigned to the workers dynamically, since solution times differ
+    // between perturbed reactions
+    parallelFor(nThreads, [&](size_t w) {
+        Worker& worker = *workers[w];
+        vector<double> values(nObj);
+        if (w != 0 && next < nRuns) {
+            // Unperturbed solution used as the initial state for warm starts
+            worker.solve(false, values);
+        }
+        Kinetics& kin = worker.kinetics();
+        for (size_t j = next++; j < nRuns; j = next++) {
+            size_t i = reactions[j];
+            double multiplier = kin.multiplier(i);
+            kin.setMultiplier(i, multiplier * (1 + m_dk));
+            try {
+                worker.solve(true, values);
+                for (size_t n = 0; n < nObj; n++) {
+                    double dG = values[n] - m_base[n];
+                    sens[j * nObj + n] = dG / (m_base[n] * m_dk);
+                }
+            } catch (CanteraError&) {
+                failed++;
+            }
+            kin.setMultiplier(i, multiplier);
+        }
+    });
+
+    AnyMap meta;
+    meta["perturbation"] = m_dk;
+    AnyMap base;
+    for (size_t n = 0; n < nObj; n++) {
+        base[m_names[n]] = m_base[n];
+    }
+    meta["base-values"] = std::move(base);
+    meta["failed-runs"] = failed.load();
+    auto arr = SolutionArray::create(m_sol, static_cast<int>(nRuns), meta);
+    vector<long int> index(reactions.begin(), reactions.end());
+    vector<string> equations;
+    for (size_t i : reactions) {
+        equations.push_back(m_sol->kinetics()->reaction(i)->equation());
+    }
+    AnyValue data;
+    data = index;
+    arr->addExtra("reaction-index");
+    arr->setComponent("reaction-index", data);
+    data = equations;
+    arr->addExtra("equation");
+    arr->setComponent("equation", data);
+    vector<double> column(nRuns);
+    for (size_t n = 0; n < nObj; n++) {
+        for (size_t j = 0; j < nRuns; j++) {
+            column[j] = sens[j * nObj + n];
+        }
+        data = column;
+        arr->addExtra(m_names[n]);
+        arr->setComponent(m_names[n], data);
+    }
+    return arr;
+}
+
+shared_ptr<Solution> BruteForceSensitivity::cloneSolution(shared_ptr<Solution> sol)
+{
+    auto clone = sol->clone();
+    for (size_t i = 0; i < sol->kinetics()->nReactions(); i++) {
+        clone->kinetics()->setMultiplier(i, sol->kinetics()->multiplier(i));
+    }
+    return clone;
+}
+
+}
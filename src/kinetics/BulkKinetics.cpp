@@ -39,6 +39,26 @@ bool BulkKinetics::addReaction(shared_ptr<Reaction> r, bool resize)
         m_irrev.push_back(nReactions()-1);
     }
 
+    // Species whose concentrations appear as factors in the rates of progress
+    m_fwdOrderSpecies.emplace_back();
+    for (const auto& [name, stoich] : r->reactants) {
+        auto iter = r->orders.find(name);
+        if ((iter == r->orders.end() ? stoich : iter->second) != 0.0) {
+            m_fwdOrderSpecies.back().push_back(kineticsSpeciesIndex(name));
+        }
+    }
+    for (const auto& [name, order] : r->orders) {
+        if (order != 0.0 && r->reactants.find(name) == r->reactants.end()) {
+            m_fwdOrderSpecies.back().push_back(kineticsSpeciesIndex(name));
+        }
+    }
+    m_revOrderSpecies.emplace_back();
+    if (r->reversible) {
+        for (const auto& [name, stoich] : r->products) {
+            m_revOrderSpecies.back().push_back(kineticsSpeciesIndex(name));
+        }
+    }
+
     shared_ptr<ReactionRate> rate = r->rate();
     string rtype = rate->subType();
     if (rtype == "") {
@@ -88,6 +108,10 @@ void BulkKinetics::addThirdBody(shared_ptr<Reaction> r)
     m_multi_concm.install(nReactions() - 1, efficiencies,
                           r->thirdBody()->default_efficiency,
                           r->thirdBody()->mass_action);
+    if (m_ready) {
+        // reaction arrays were already resized by Kinetics::addReaction
+        m_multi_concm.resizeCoeffs(nTotalSpecies(), nReactions());
+    }
 }
 
 void BulkKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
@@ -120,6 +144,7 @@ void BulkKinetics::resizeSpecies()
     Kinetics::resizeSpecies();
     m_act_conc.resize(m_kk);
     m_phys_conc.resize(m_kk);
+    m_wdot.resize(m_kk);
     m_grt.resize(m_kk);
     for (auto& rates : m_bulk_rates) {
         rates->resize(m_kk, nReactions(), nPhases());
@@ -136,12 +161,20 @@ void BulkKinetics::resizeReactions()
     m_sbuf0.resize(nTotalSpecies());
     m_state.resize(thermo().stateSize());
     m_multi_concm.resizeCoeffs(nTotalSpecies(), nReactions());
+    m_fusedStoich.resizeCoeffs(m_reactantStoich, m_revProductStoich, m_stoichMatrix);
+    m_wdot.resize(m_kk);
     for (auto& rates : m_bulk_rates) {
         rates->resize(nTotalSpecies(), nReactions(), nPhases());
         // @todo ensure that ReactionData are updated; calling rates->update
         //      blocks correct behavior in update_rates_T
         //      and running updateROP() is premature
     }
+    if (!m_userActive.empty()) {
+        // newly added reactions are active
+        m_userActive.resize(nReactions(), true);
+    }
+    m_active.clear(); // force update of active reactions
+    m_activeChanged = true;
 }
 
 void BulkKinetics::setMultiplier(size_t i, double f)
@@ -150,6 +183,91 @@ void BulkKinetics::setMultiplier(size_t i, double f)
     m_ROP_ok = false;
 }
 
+void BulkKinetics::setActiveReactions(const vector<bool>& active)
+{
+    if (!active.empty() && active.size() != nReactions()) {
+        throw CanteraError("BulkKinetics::setActiveReactions", "Size of the "
+            "mask ({}) does not match the number of reactions ({})",
+            active.size(), nReactions());
+    }
+    m_userActive = active;
+    m_activeChanged = true;
+    m_ROP_ok = false;
+}
+
+void BulkKinetics::setSkipThreshold(double threshold)
+{
+    m_skipThreshold = threshold;
+    m_activeChanged = true;
+    m_ROP_ok = false;
+}
+
+size_t BulkKinetics::nActiveReactions()
+{
+    updateROP();
+    return m_activeIndex.size();
+}
+
+bool BulkKinetics::updateActiveReactions()
+{
+    size_t nr = nReactions();
+    bool changed = (m_active.size() != nr);
+    m_active.resize(nr, true);
+    m_activeChanged = false;
+    for (size_t i = 0; i < nr; i++) {
+        bool active = m_userActive.empty() || m_userActive[i];
+        if (active && m_skipThreshold >= 0 && !m_skipSuspended) {
+            bool fwd = true;
+            for (size_t k : m_fwdOrderSpecies[i]) {
+                fwd &= (std::abs(m_act_conc[k]) > m_skipThreshold);
+            }
+            bool rev = !m_revOrderSpecies[i].empty();
+            for (size_t k : m_revOrderSpecies[i]) {
+                rev &= (std::abs(m_act_conc[k]) > m_skipThreshold);
+            }
+            active = fwd || rev;
+        }
+        if (active != m_active[i]) {
+            m_active[i] = active;
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return false;
+    }
+
+    // Compacted index lists
+    m_activeIndex.clear();
+    for (size_t i = 0; i < nr; i++) {
+        if (m_active[i]) {
+            m_activeIndex.push_back(i);
+        } else {
+            m_rfn[i] = m_ropf[i] = m_ropr[i] = m_ropnet[i] = 0.0;
+        }
+    }
+    m_activeRevIndex.clear();
+    for (size_t i : m_revindex) {
+        if (m_active[i]) {
+            m_activeRevIndex.push_back(i);
+        }
+    }
+
+    // Evaluators use an empty mask to process all reactions
+    vector<bool> mask;
+    if (m_activeIndex.size() < nr) {
+        mask = m_active;
+    }
+    for (auto& rates : m_bulk_rates) {
+        rates->setActive(mask);
+    }
+    m_multi_concm.setActive(mask);
+    m_reactantStoich.setActive(mask);
+    m_revProductStoich.setActive(mask);
+    m_fusedStoich.setActive(mask);
+    m_ROP_ok = false;
+    return true;
+}
+
 void BulkKinetics::invalidateCache()
 {
     Kinetics::invalidateCache();
@@ -165,6 +283,15 @@ void BulkKinetics::getFwdRateConstants(double* kfwd)
     }
 }
 
+void BulkKinetics::getDerivativeRateConstants(double* kfwd)
+{
+    updateDerivativeROP();
+    copy(m_rfn.begin(), m_rfn.end(), kfwd);
+    if (legacy_rate_constants_used()) {
+        processThirdBodies(kfwd);
+    }
+}
+
 void BulkKinetics::getEquilibriumConstants(double* kc)
 {
     updateROP();
@@ -284,21 +411,21 @@ void BulkKinetics::setDerivativeSettings(const AnyMap& settings)
 void BulkKinetics::getFwdRateConstants_ddT(double* dkfwd)
 {
     assertDerivativesValid("BulkKinetics::getFwdRateConstants_ddT");
-    updateROP();
+    updateDerivativeROP();
     process_ddT(m_rfn, dkfwd);
 }
 
 void BulkKinetics::getFwdRatesOfProgress_ddT(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getFwdRatesOfProgress_ddT");
-    updateROP();
+    updateDerivativeROP();
     process_ddT(m_ropf, drop);
 }
 
 void BulkKinetics::getRevRatesOfProgress_ddT(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getRevRatesOfProgress_ddT");
-    updateROP();
+    updateDerivativeROP();
     process_ddT(m_ropr, drop);
     Eigen::Map<Eigen::VectorXd> dRevRop(drop, nReactions());
 
@@ -312,7 +439,7 @@ void BulkKinetics::getRevRatesOfProgress_ddT(double* drop)
 void BulkKinetics::getNetRatesOfProgress_ddT(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getNetRatesOfProgress_ddT");
-    updateROP();
+    updateDerivativeROP();
     process_ddT(m_ropnet, drop);
     Eigen::Map<Eigen::VectorXd> dNetRop(drop, nReactions());
 
@@ -326,56 +453,56 @@ void BulkKinetics::getNetRatesOfProgress_ddT(double* drop)
 void BulkKinetics::getFwdRateConstants_ddP(double* dkfwd)
 {
     assertDerivativesValid("BulkKinetics::getFwdRateConstants_ddP");
-    updateROP();
+    updateDerivativeROP();
     process_ddP(m_rfn, dkfwd);
 }
 
 void BulkKinetics::getFwdRatesOfProgress_ddP(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getFwdRatesOfProgress_ddP");
-    updateROP();
+    updateDerivativeROP();
     process_ddP(m_ropf, drop);
 }
 
 void BulkKinetics::getRevRatesOfProgress_ddP(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getRevRatesOfProgress_ddP");
-    updateROP();
+    updateDerivativeROP();
     process_ddP(m_ropr, drop);
 }
 
 void BulkKinetics::getNetRatesOfProgress_ddP(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getNetRatesOfProgress_ddP");
-    updateROP();
+    updateDerivativeROP();
     process_ddP(m_ropnet, drop);
 }
 
 void BulkKinetics::getFwdRateConstants_ddC(double* dkfwd)
 {
     assertDerivativesValid("BulkKinetics::getFwdRateConstants_ddC");
-    updateROP();
+    updateDerivativeROP();
     process_ddC(m_reactantStoich, m_rfn, dkfwd, false);
 }
 
 void BulkKinetics::getFwdRatesOfProgress_ddC(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getFwdRatesOfProgress_ddC");
-    updateROP();
+    updateDerivativeROP();
     process_ddC(m_reactantStoich, m_ropf, drop);
 }
 
 void BulkKinetics::getRevRatesOfProgress_ddC(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getRevRatesOfProgress_ddC");
-    updateROP();
+    updateDerivativeROP();
     return process_ddC(m_revProductStoich, m_ropr, drop);
 }
 
 void BulkKinetics::getNetRatesOfProgress_ddC(double* drop)
 {
     assertDerivativesValid("BulkKinetics::getNetRatesOfProgress_ddC");
-    updateROP();
+    updateDerivativeROP();
     process_ddC(m_reactantStoich, m_ropf, drop);
     Eigen::Map<Eigen::VectorXd> dNetRop(drop, nReactions());
 
@@ -390,7 +517,7 @@ Eigen::SparseMatrix<double> BulkKinetics::fwdRatesOfProgress_ddX()
 
     // forward reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     return calculateCompositionDerivatives(m_reactantStoich, rop_rates);
 }
 
@@ -400,7 +527,7 @@ Eigen::SparseMatrix<double> BulkKinetics::revRatesOfProgress_ddX()
 
     // reverse reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     applyEquilibriumConstants(rop_rates.data());
     return calculateCompositionDerivatives(m_revProductStoich, rop_rates);
 }
@@ -411,7 +538,7 @@ Eigen::SparseMatrix<double> BulkKinetics::netRatesOfProgress_ddX()
 
     // forward reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     auto jac = calculateCompositionDerivatives(m_reactantStoich, rop_rates);
 
     // reverse reaction rate coefficients
@@ -425,7 +552,7 @@ Eigen::SparseMatrix<double> BulkKinetics::fwdRatesOfProgress_ddCi()
 
     // forward reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     return calculateCompositionDerivatives(m_reactantStoich, rop_rates, false);
 }
 
@@ -435,7 +562,7 @@ Eigen::SparseMatrix<double> BulkKinetics::revRatesOfProgress_ddCi()
 
     // reverse reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     applyEquilibriumConstants(rop_rates.data());
     return calculateCompositionDerivatives(m_revProductStoich, rop_rates, false);
 }
@@ -446,7 +573,7 @@ Eigen::SparseMatrix<double> BulkKinetics::netRatesOfProgress_ddCi()
 
     // forward reaction rate coefficients
     vector<double>& rop_rates = m_rbuf0;
-    getFwdRateConstants(rop_rates.data());
+    getDerivativeRateConstants(rop_rates.data());
     auto jac = calculateCompositionDerivatives(m_reactantStoich, rop_rates, false);
 
     // reverse reaction rate coefficients
@@ -455,14 +582,50 @@ Eigen::SparseMatrix<double> BulkKinetics::netRatesOfProgress_ddCi()
 }
 
 void BulkKinetics::updateROP()
+{
+    if (m_skipSuspended) {
+        m_skipSuspended = false;
+        m_activeChanged |= (m_skipThreshold >= 0);
+    }
+    updateActiveROP();
+}
+
+void BulkKinetics::updateDerivativeROP()
+{
+    // Skipped reactions have negligible rates of progress, but their derivatives
+    // with respect to the species causing them to be skipped are generally nonzero
+    if (!m_skipSuspended) {
+        m_skipSuspended = true;
+        m_activeChanged |= (m_skipThreshold >= 0);
+    }
+    updateActiveROP();
+}
+
+void BulkKinetics::updateActiveROP()
 {
     static const int cacheId = m_cache.getId();
     CachedScalar last = m_cache.getScalar(cacheId);
     double T = thermo().temperature();
     double rho = thermo().density();
     int statenum = thermo().stateMFNumber();
+    bool updateKc = (last.state1 != T || last.state2 != rho);
+    bool updateConc = !last.validate(T, rho, statenum);
 
-    if (last.state1 != T || last.state2 != rho) {
+    if (updateConc) {
+        // Update terms dependent on species concentrations and temperature
+        thermo().getActivityConcentrations(m_act_conc.data());
+        thermo().getConcentrations(m_phys_conc.data());
+        m_activeChanged |= (m_skipThreshold >= 0);
+        m_ROP_ok = false;
+    }
+
+    if (m_activeChanged && updateActiveReactions()) {
+        // Equilibrium constants and third-body concentrations of newly activated
+        // reactions need to be evaluated
+        updateKc = updateConc = true;
+    }
+
+    if (updateKc) {
         // Update properties that are independent of the composition
         thermo().getStandardChemPotentials(m_grt.data());
         fill(m_delta_gibbs0.begin(), m_delta_gibbs0.end(), 0.0);
@@ -472,8 +635,7 @@ void BulkKinetics::updateROP()
         getRevReactionDelta(m_grt.data(), m_delta_gibbs0.data());
 
         double rrt = 1.0 / thermo().RT();
-        for (size_t i = 0; i < m_revindex.size(); i++) {
-            size_t irxn = m_revindex[i];
+        for (size_t irxn : m_activeRevIndex) {
             m_rkcn[irxn] = std::min(
                 exp(m_delta_gibbs0[irxn] * rrt - m_dn[irxn] * logStandConc), BigNumber);
         }
@@ -483,15 +645,9 @@ void BulkKinetics::updateROP()
         }
     }
 
-    if (!last.validate(T, rho, statenum)) {
-        // Update terms dependent on species concentrations and temperature
-        thermo().getActivityConcentrations(m_act_conc.data());
-        thermo().getConcentrations(m_phys_conc.data());
-        double ctot = thermo().molarDensity();
-
+    if (updateConc) {
         // Third-body objects interacting with MultiRate evaluator
-        m_multi_concm.update(m_phys_conc, ctot, m_concm.data());
-        m_ROP_ok = false;
+        m_multi_concm.update(m_phys_conc, thermo().molarDensity(), m_concm.data());
     }
 
     // loop over MultiRate evaluators for each reaction type
@@ -509,24 +665,23 @@ void BulkKinetics::updateROP()
         return;
     }
 
-    // Scale the forward rate coefficient by the perturbation factor
-    for (size_t i = 0; i < nReactions(); ++i) {
+    // Scale the forward rate coefficient by the perturbation factor. Entries for
+    // inactive reactions remain zero.
+    for (size_t i : m_activeIndex) {
         m_rfn[i] = m_kf0[i] * m_perturb[i];
     }
 
     copy(m_rfn.begin(), m_rfn.end(), m_ropf.data());
     processThirdBodies(m_ropf.data());
-    copy(m_ropf.begin(), m_ropf.end(), m_ropr.begin());
 
-    // multiply ropf by concentration products
-    m_reactantStoich.multiply(m_act_conc.data(), m_ropf.data());
-
-    // for reversible reactions, multiply ropr by concentration products
-    applyEquilibriumConstants(m_ropr.data());
-    m_revProductStoich.multiply(m_act_conc.data(), m_ropr.data());
-    for (size_t j = 0; j != nReactions(); ++j) {
-        m_ropnet[j] = m_ropf[j] - m_ropr[j];
+    // multiply forward and reverse rate coefficients by concentration products and
+    // accumulate net production rates in a single pass over the active reactions
+    if (m_fusedStoich.nReactions() != nReactions()) {
+        throw CanteraError("BulkKinetics::updateROP", "The object is not fully "
+            "configured; make sure to call resizeReactions().");
     }
+    m_fusedStoich.evaluate(m_act_conc.data(), m_rkcn.data(), m_ropf.data(),
+                           m_ropr.data(), m_ropnet.data(), m_wdot.data());
 
     for (size_t i = 0; i < m_rfn.size(); i++) {
         AssertFinite(m_rfn[i], "BulkKinetics::updateROP",
@@ -539,6 +694,12 @@ void BulkKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void BulkKinetics::getNetProductionRates(double* wdot)
+{
+    updateROP();
+    copy(m_wdot.begin(), m_wdot.end(), wdot);
+}
+
 void BulkKinetics::getThirdBodyConcentrations(double* concm)
 {
     updateROP();
@@ -556,8 +717,9 @@ void BulkKinetics::processThirdBodies(double* rop)
 void BulkKinetics::applyEquilibriumConstants(double* rop)
 {
     // For reverse rates computed from thermochemistry, multiply the forward
-    // rate coefficients by the reciprocals of the equilibrium constants
-    for (size_t i = 0; i < nReactions(); ++i) {
+    // rate coefficients by the reciprocals of the equilibrium constants, which
+    // are zero for irreversible reactions
+    for (size_t i : m_activeIndex) {
         rop[i] *= m_rkcn[i];
     }
 }
@@ -582,8 +744,7 @@ void BulkKinetics::applyEquilibriumConstants_ddT(double* drkcn)
     double Tinv = 1. / T;
     double rrt_dTinv = rrt * Tinv / m_jac_rtol_delta;
     double rrtt = rrt * Tinv;
-    for (size_t i = 0; i < m_revindex.size(); i++) {
-        size_t irxn = m_revindex[i];
+    for (size_t irxn : m_activeRevIndex) {
         double factor = delta_gibbs0[irxn] - m_delta_gibbs0[irxn];
         factor *= rrt_dTinv;
         factor += m_dn[irxn] * Tinv - m_delta_gibbs0[irxn] * rrtt;
@@ -630,10 +791,11 @@ void BulkKinetics::process_ddC(StoichManagerN& stoich, const vector<double>& in,
         return;
     }
 
-    // derivatives due to third-body colliders in law of mass action
+    // derivatives due to third-body colliders in law of mass action; entries of
+    // inactive reactions are not written by the evaluators and remain zero
     Eigen::Map<Eigen::VectorXd> outM(m_rbuf1.data(), nReactions());
+    outM.fill(0.);
     if (mass_action) {
-        outM.fill(0.);
         m_multi_concm.scale(in.data(), outM.data(), ctot_inv);
         out += outM;
     }
@@ -661,7 +823,7 @@ Eigen::SparseMatrix<double> BulkKinetics::calculateCompositionDerivatives(
     copy(in.begin(), in.end(), scaled.begin());
     if (ddX) {
         double ctot = thermo().molarDensity();
-        for (size_t i = 0; i < nReactions(); ++i) {
+        for (size_t i : m_activeIndex) {
             scaled[i] *= ctot;
         }
     }
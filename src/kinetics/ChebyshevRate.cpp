@@ -15,6 +15,82 @@ void ChebyshevData::update(double T)
         "Missing state information: 'ChebyshevData' requires pressure.");
 }
 
+void ChebyshevData::update(double T, double P)
+{
+    ReactionData::update(T);
+    pressure = P;
+    log10P = std::log10(P);
+    if (m_coeffs.empty()) {
+        return;
+    }
+
+    if (log10P != m_dotProdLog10P) {
+        // Sum over the pressure direction for all rates
+        m_dotProdLog10P = log10P;
+        Eigen::ArrayXd Pr = (2 * log10P + m_PrNum) * m_PrDen;
+        Eigen::ArrayXd Cnm1 = Pr;
+        Eigen::ArrayXd Cn = Eigen::ArrayXd::Ones(Pr.size());
+        m_dotProd = m_coeffs[0];
+        for (size_t j = 1; j < m_coeffs.size(); j++) {
+            Eigen::ArrayXd Cnp1 = 2 * Pr * Cn - Cnm1;
+            m_dotProd += m_coeffs[j].colwise() * Cnp1;
+            Cnm1 = Cn;
+            Cn = Cnp1;
+        }
+    }
+
+    Eigen::ArrayXd Tr = (2 * recipT + m_TrNum) * m_TrDen;
+    Eigen::ArrayXd Cnm1 = Tr;
+    Eigen::ArrayXd Cn = Eigen::ArrayXd::Ones(Tr.size());
+    Eigen::ArrayXd logk = m_dotProd.col(0);
+    for (Eigen::Index i = 1; i < m_dotProd.cols(); i++) {
+        Eigen::ArrayXd Cnp1 = 2 * Tr * Cn - Cnm1;
+        logk += Cnp1 * m_dotProd.col(i);
+        Cnm1 = Cn;
+        Cn = Cnp1;
+    }
+    rateCoefficients = (std::log(10.0) * logk).exp();
+    rateTemperature = T;
+}
+
+void ChebyshevData::setRates(const vector<ReactionRate*>& rates)
+{
+    vector<ChebyshevRate*> cheb;
+    size_t nT = 0, nP = 0;
+    for (auto rate : rates) {
+        auto R = dynamic_cast<ChebyshevRate*>(rate);
+        if (R) {
+            R->m_dataIndex = cheb.size();
+            cheb.push_back(R);
+            nT = std::max(nT, R->m_coeffs.nRows());
+            nP = std::max(nP, R->m_coeffs.nColumns());
+        }
+    }
+    Eigen::Index nRates = cheb.size();
+    m_coeffs.assign(nRates ? nP : 0, Eigen::ArrayXXd::Zero(nRates, nT));
+    m_TrNum.resize(nRates);
+    m_TrDen.resize(nRates);
+    m_PrNum.resize(nRates);
+    m_PrDen.resize(nRates);
+    for (Eigen::Index k = 0; k < nRates; k++) {
+        const auto& R = *cheb[k];
+        for (size_t i = 0; i < R.m_coeffs.nRows(); i++) {
+            for (size_t j = 0; j < R.m_coeffs.nColumns(); j++) {
+                m_coeffs[j](k, i) = R.m_coeffs(i, j);
+            }
+        }
+        m_TrNum[k] = R.TrNum_;
+        m_TrDen[k] = R.TrDen_;
+        m_PrNum[k] = R.PrNum_;
+        m_PrDen[k] = R.PrDen_;
+    }
+    rateCoefficients.setZero(nRates);
+    m_dotProdLog10P = NAN;
+    rateTemperature = NAN;
+    // Force evaluation of the rate coefficients
+    invalidateCache();
+}
+
 bool ChebyshevData::update(const ThermoPhase& phase, const Kinetics& kin)
 {
     double T = phase.temperature();
@@ -41,11 +41,62 @@ bool ElectronCollisionPlasmaData::update(const ThermoPhase& phase, const Kinetic
         m_level_number = pp.levelNumber();
         energyLevels.resize(pp.nElectronEnergyLevels());
         pp.getElectronEnergyLevels(energyLevels.data());
+        updateCrossSections();
+    }
+
+    // Rate coefficients of all registered rates in m3/kmol/s
+    if (!rateCoefficients.empty()) {
+        double factor = 0.5 * sqrt(2.0 * ElectronCharge / ElectronMass) * Avogadro;
+        Eigen::Map<const Eigen::VectorXd> F(distribution.data(), distribution.size());
+        Eigen::Map<Eigen::VectorXd>(rateCoefficients.data(), rateCoefficients.size())
+            = factor * (m_crossSections * m_weights.cwiseProduct(F));
     }
 
     return true;
 }
 
+void ElectronCollisionPlasmaData::setRates(const vector<ReactionRate*>& rates)
+{
+    m_rateEnergyLevels.clear();
+    m_rateCrossSections.clear();
+    for (auto rate : rates) {
+        auto R = dynamic_cast<ElectronCollisionPlasmaRate*>(rate);
+        if (!R) {
+            continue;
+        }
+        R->m_dataIndex = npos;
+        if (R->m_energyLevels.empty()) {
+            // rate without cross section data
+            continue;
+        }
+        R->m_dataIndex = m_rateEnergyLevels.size();
+        m_rateEnergyLevels.push_back(R->m_energyLevels);
+        m_rateCrossSections.push_back(R->m_crossSections);
+    }
+    rateCoefficients.assign(m_rateEnergyLevels.size(), 0.0);
+    // Force interpolation of the new set of cross sections
+    m_dist_number = -1;
+    m_level_number = -1;
+}
+
+void ElectronCollisionPlasmaData::updateCrossSections()
+{
+    size_t nLevels = energyLevels.size();
+    size_t nRates = m_rateEnergyLevels.size();
+    m_crossSections.resize(nRates, nLevels);
+    for (size_t i = 0; i < nRates; i++) {
+        for (size_t j = 0; j < nLevels; j++) {
+            m_crossSections(i, j) = linearInterp(energyLevels[j],
+                m_rateEnergyLevels[i], m_rateCrossSections[i]);
+        }
+    }
+    if (nRates) {
+        // Integration is performed with respect to the squared energy levels
+        Eigen::Map<const Eigen::ArrayXd> eps(energyLevels.data(), nLevels);
+        m_weights = simpsonWeights(eps.square());
+    }
+}
+
 void ElectronCollisionPlasmaRate::setParameters(const AnyMap& node, const UnitStack& rate_units)
 {
     ReactionRate::setParameters(node, rate_units);
@@ -73,6 +124,11 @@ void ElectronCollisionPlasmaRate::getParameters(AnyMap& node) const {
 double ElectronCollisionPlasmaRate::evalFromStruct(
     const ElectronCollisionPlasmaData& shared_data)
 {
+    if (m_dataIndex < shared_data.rateCoefficients.size()) {
+        // rate coefficients are evaluated jointly for all rates
+        return shared_data.rateCoefficients[m_dataIndex];
+    }
+
     // Interpolate cross-sections data to the energy levels of
     // the electron energy distribution function
     if (shared_data.levelChanged) {
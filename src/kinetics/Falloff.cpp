@@ -33,6 +33,8 @@ void FalloffData::update(double T, double M)
 {
     ReactionData::update(T);
     conc_3b[0] = M;
+    // jointly evaluated rates require third-body concentrations for each reaction
+    rateTemperature = NAN;
 }
 
 bool FalloffData::update(const ThermoPhase& phase, const Kinetics& kin)
@@ -51,9 +53,121 @@ bool FalloffData::update(const ThermoPhase& phase, const Kinetics& kin)
         conc_3b = kin.thirdBodyConcentrations();
         changed = true;
     }
+    if (changed) {
+        updateRateCoefficients();
+    }
     return changed;
 }
 
+void FalloffData::setRates(const vector<ReactionRate*>& rates)
+{
+    m_falloffType.clear();
+    m_rateIndices.clear();
+    rateCoefficients.resize(0);
+    rateTemperature = NAN;
+    invalidateCache();
+    if (rates.empty()) {
+        return;
+    }
+    static const map<string, size_t> nParameters = {
+        {"Lindemann", 0}, {"Troe", 4}, {"SRI", 5}, {"Tsang", 2}};
+    string falloffType = rates[0]->subType();
+    if (!nParameters.count(falloffType)) {
+        // unknown parameterization; rates are evaluated individually
+        return;
+    }
+    for (auto rate : rates) {
+        if (rate->subType() != falloffType) {
+            return;
+        }
+    }
+
+    size_t n = rates.size();
+    m_lowA.resize(n);
+    m_lowB.resize(n);
+    m_lowEa_R.resize(n);
+    m_highA.resize(n);
+    m_highB.resize(n);
+    m_highEa_R.resize(n);
+    m_chemAct.resize(n);
+    m_falloffParams.resize(n, nParameters.at(falloffType));
+    m_conc.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        auto R = static_cast<FalloffRate*>(rates[i]);
+        R->m_dataIndex = i;
+        m_rateIndices.push_back(R->rateIndex());
+        m_lowA[i] = R->m_lowRate.preExponentialFactor();
+        m_lowB[i] = R->m_lowRate.temperatureExponent();
+        m_lowEa_R[i] = R->m_lowRate.activationEnergy() / GasConstant;
+        m_highA[i] = R->m_highRate.preExponentialFactor();
+        m_highB[i] = R->m_highRate.temperatureExponent();
+        m_highEa_R[i] = R->m_highRate.activationEnergy() / GasConstant;
+        m_chemAct[i] = R->m_chemicallyActivated ? 1.0 : 0.0;
+        if (falloffType == "Troe") {
+            auto troe = static_cast<TroeRate*>(R);
+            m_falloffParams.row(i) << troe->m_a, troe->m_rt3, troe->m_rt1, troe->m_t2;
+        } else if (falloffType == "SRI") {
+            auto sri = static_cast<SriRate*>(R);
+            m_falloffParams.row(i) << sri->m_a, sri->m_b, sri->m_c, sri->m_d, sri->m_e;
+        } else if (falloffType == "Tsang") {
+            auto tsang = static_cast<TsangRate*>(R);
+            m_falloffParams.row(i) << tsang->m_a, tsang->m_b;
+        }
+    }
+    m_falloffType = falloffType;
+}
+
+void FalloffData::updateRateCoefficients()
+{
+    if (m_falloffType.empty() || !ready) {
+        rateTemperature = NAN;
+        return;
+    }
+    for (size_t i = 0; i < m_rateIndices.size(); i++) {
+        m_conc[i] = conc_3b[m_rateIndices[i]];
+    }
+    double T = temperature;
+    Eigen::ArrayXd kLow = m_lowA * (m_lowB * logT - m_lowEa_R * recipT).exp();
+    Eigen::ArrayXd kHigh = m_highA * (m_highB * logT - m_highEa_R * recipT).exp();
+    Eigen::ArrayXd pr = m_conc * kLow / (kHigh + SmallNumber);
+
+    Eigen::ArrayXd F;
+    if (m_falloffType == "Lindemann") {
+        F.setOnes(pr.size());
+    } else if (m_falloffType == "SRI") {
+        auto a = m_falloffParams.col(0);
+        auto c = m_falloffParams.col(2);
+        Eigen::ArrayXd base = a * (-m_falloffParams.col(1) * recipT).exp()
+            + (c != 0.0).select((-T / c).exp(), 0.0);
+        Eigen::ArrayXd lpr = pr.max(SmallNumber).log10();
+        Eigen::ArrayXd xx = 1.0 / (1.0 + lpr.square());
+        F = base.pow(xx) * m_falloffParams.col(3)
+            * (m_falloffParams.col(4) * logT).exp();
+    } else {
+        Eigen::ArrayXd Fcent;
+        if (m_falloffType == "Troe") {
+            auto a = m_falloffParams.col(0);
+            auto t2 = m_falloffParams.col(3);
+            Fcent = (1.0 - a) * (-T * m_falloffParams.col(1)).exp()
+                + a * (-T * m_falloffParams.col(2)).exp()
+                + (t2 != 0.0).select((-t2 * recipT).exp(), 0.0);
+        } else { // Tsang
+            Fcent = m_falloffParams.col(0) + m_falloffParams.col(1) * T;
+        }
+        Eigen::ArrayXd logFcent = Fcent.max(SmallNumber).log10();
+        Eigen::ArrayXd lpr = pr.max(SmallNumber).log10();
+        Eigen::ArrayXd cc = -0.4 - 0.67 * logFcent;
+        Eigen::ArrayXd nn = 0.75 - 1.27 * logFcent;
+        Eigen::ArrayXd f1 = (lpr + cc) / (nn - 0.14 * (lpr + cc));
+        F = (logFcent / (1.0 + f1.square()) * std::log(10.0)).exp();
+    }
+
+    // Chemically activated: k = k_0 F / (1 + Pr); falloff: k = k_inf F Pr / (1 + Pr)
+    rateCoefficients = F / (1.0 + pr)
+        * (m_chemAct != 0.0).select(kLow, pr * kHigh);
+    rateTemperature = T;
+}
+
 void FalloffData::perturbThirdBodies(double deltaM)
 {
     if (m_perturbed) {
@@ -65,6 +179,7 @@ void FalloffData::perturbThirdBodies(double deltaM)
         c3b *= 1. + deltaM;
     }
     m_perturbed = true;
+    updateRateCoefficients();
 }
 
 void FalloffData::restore()
@@ -76,6 +191,7 @@ void FalloffData::restore()
     }
     conc_3b = m_conc_3b_buf;
     m_perturbed = false;
+    updateRateCoefficients();
 }
 
 FalloffRate::FalloffRate(const AnyMap& node, const UnitStack& rate_units)
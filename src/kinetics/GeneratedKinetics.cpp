@@ -0,0 +1,86 @@
+//! @file GeneratedKinetics.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/GeneratedKinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#define BOOST_DLL_USE_STD_FS
+#include <boost/dll/shared_library.hpp>
+
+namespace Cantera
+{
+
+GeneratedKinetics::GeneratedKinetics(const string& library, const string& prefix)
+{
+    typedef int (count_t)();
+    try {
+        auto lib = make_shared<boost::dll::shared_library>(library,
+            boost::dll::load_mode::append_decorations);
+        m_wdot = &lib->get<wdot_t>(prefix + "_getNetProductionRates");
+        m_wdot_ddC = &lib->get<wdot_ddC_t>(prefix + "_getNetProductionRates_ddC");
+        m_nSpecies = lib->get<count_t>(prefix + "_nSpecies")();
+        m_nReactions = lib->get<count_t>(prefix + "_nReactions")();
+        m_library = lib;
+    } catch (std::exception& err) {
+        throw CanteraError("GeneratedKinetics::GeneratedKinetics",
+            "Error loading generated functions with prefix '{}' from '{}':\n{}",
+            prefix, library, err.what());
+    }
+}
+
+void GeneratedKinetics::checkMechanism(const string& method)
+{
+    if (nTotalSpecies() != m_nSpecies || nReactions() != m_nReactions) {
+        throw CanteraError(method, "Mechanism with {} species and {} reactions does "
+            "not match the generated code for {} species and {} reactions.",
+            nTotalSpecies(), nReactions(), m_nSpecies, m_nReactions);
+    }
+}
+
+void GeneratedKinetics::evalGenerated(double T, double P, const double* C,
+                                      double* wdot, double* jac)
+{
+    checkMechanism("GeneratedKinetics::evalGenerated");
+    if (jac) {
+        m_wdot_ddC(T, P, C, wdot, jac);
+    } else {
+        m_wdot(T, P, C, wdot);
+    }
+}
+
+void GeneratedKinetics::getNetProductionRates(double* wdot)
+{
+    checkMechanism("GeneratedKinetics::getNetProductionRates");
+    m_C.resize(m_nSpecies);
+    thermo().getConcentrations(m_C.data());
+    m_wdot(thermo().temperature(), thermo().pressure(), m_C.data(), wdot);
+}
+
+Eigen::SparseMatrix<double> GeneratedKinetics::netProductionRates_ddCi()
+{
+    checkMechanism("GeneratedKinetics::netProductionRates_ddCi");
+    size_t nsp = m_nSpecies;
+    m_C.resize(nsp);
+    m_jac.resize(nsp * nsp);
+    vector<double> wdot(nsp);
+    thermo().getConcentrations(m_C.data());
+    m_wdot_ddC(thermo().temperature(), thermo().pressure(), m_C.data(), wdot.data(),
+               m_jac.data());
+
+    vector<Eigen::Triplet<double>> trips;
+    for (size_t k = 0; k < nsp; k++) {
+        for (size_t j = 0; j < nsp; j++) {
+            if (m_jac[k * nsp + j] != 0.0) {
+                trips.emplace_back(static_cast<int>(k), static_cast<int>(j),
+                                   m_jac[k * nsp + j]);
+            }
+        }
+    }
+    Eigen::SparseMatrix<double> jac(nsp, nsp);
+    jac.setFromTriplets(trips.begin(), trips.end());
+    return jac;
+}
+
+}
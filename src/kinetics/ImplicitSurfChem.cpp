@@ -130,6 +130,15 @@ void ImplicitSurfChem::initialize(double t0)
     m_integ->initialize(t0, *this);
 }
 
+void ImplicitSurfChem::reinitialize(double t0)
+{
+    this->setTolerances(m_rtol, m_atol);
+    this->setMaxStepSize(m_maxstep);
+    this->setMaxSteps(m_nmax);
+    this->setMaxErrTestFails(m_maxErrTestFails);
+    m_integ->reinitialize(t0, *this);
+}
+
 void ImplicitSurfChem::integrate(double t0, double t1)
 {
     this->initialize(t0);
@@ -10,6 +10,7 @@
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/AnyMap.h"
 #include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -39,6 +40,7 @@ void InterfaceData::update(double T, const vector<double>& values)
     for (size_t n = 0; n < coverages.size(); n++) {
         logCoverages[n] = std::log(std::max(coverages[n], Tiny));
     }
+    updateCoverageTerms();
 }
 
 bool InterfaceData::update(const ThermoPhase& phase, const Kinetics& kin)
@@ -66,6 +68,7 @@ bool InterfaceData::update(const ThermoPhase& phase, const Kinetics& kin)
         for (size_t n = 0; n < coverages.size(); n++) {
             logCoverages[n] = std::log(std::max(coverages[n], Tiny));
         }
+        updateCoverageTerms();
         for (size_t n = 0; n < kin.nPhases(); n++) {
             size_t start = kin.kineticsSpeciesIndex(0, n);
             const auto& ph = kin.thermo(n);
@@ -89,6 +92,76 @@ void InterfaceData::perturbTemperature(double deltaT)
     throw NotImplementedError("InterfaceData::perturbTemperature");
 }
 
+void InterfaceData::setRates(const vector<ReactionRate*>& rates)
+{
+    size_t nsp = coverages.size();
+    SparseTriplets tripletsA, tripletsE, tripletsM;
+    size_t nRows = 0;
+    for (auto rate : rates) {
+        auto R = dynamic_cast<InterfaceRateBase*>(rate);
+        if (!R) {
+            continue;
+        }
+        R->m_covRow = npos;
+        if (R->m_cov.empty() || R->m_indices.size() != R->m_cov.size()) {
+            // rate has no coverage dependencies or is not set up correctly
+            continue;
+        }
+        int row = static_cast<int>(nRows);
+        for (auto& [iCov, iKin] : R->m_indices) {
+            int col = static_cast<int>(iKin);
+            tripletsA.emplace_back(row, col, R->m_ac[iCov]);
+            tripletsM.emplace_back(row, col, R->m_mc[iCov]);
+            const auto& E = R->m_ec[iCov];
+            if (R->m_lindep[iCov]) {
+                tripletsE.emplace_back(row, col, E[1]);
+                continue;
+            }
+            tripletsE.emplace_back(row, static_cast<int>(4 * nsp), E[0]);
+            for (size_t p = 1; p < std::min<size_t>(E.size(), 5); p++) {
+                int offset = static_cast<int>((p - 1) * nsp);
+                tripletsE.emplace_back(row, offset + col, E[p]);
+            }
+        }
+        R->m_covRow = nRows++;
+    }
+
+    int rows = static_cast<int>(nRows);
+    int cols = static_cast<int>(nsp);
+    m_covA.resize(rows, cols);
+    m_covA.setFromTriplets(tripletsA.begin(), tripletsA.end());
+    m_covE.resize(rows, 4 * cols + 1);
+    m_covE.setFromTriplets(tripletsE.begin(), tripletsE.end());
+    m_covM.resize(rows, cols);
+    m_covM.setFromTriplets(tripletsM.begin(), tripletsM.end());
+    m_covPowers.assign(4 * nsp + 1, 1.0);
+    acov.assign(nRows, 0.0);
+    ecov.assign(nRows, 0.0);
+    mcov.assign(nRows, 0.0);
+}
+
+void InterfaceData::updateCoverageTerms()
+{
+    if (acov.empty()) {
+        return;
+    }
+    Eigen::Index nsp = static_cast<Eigen::Index>(coverages.size());
+    Eigen::Index nRows = static_cast<Eigen::Index>(acov.size());
+    ConstMappedVector theta(coverages.data(), nsp);
+    // The last entry of m_covPowers is a constant and remains unchanged
+    MappedVector powers(m_covPowers.data(), 4 * nsp);
+    powers.head(nsp) = theta;
+    for (Eigen::Index p = 1; p < 4; p++) {
+        powers.segment(p * nsp, nsp) =
+            powers.segment((p - 1) * nsp, nsp).cwiseProduct(theta);
+    }
+    MappedVector(acov.data(), nRows) = m_covA * theta;
+    MappedVector(ecov.data(), nRows) =
+        m_covE * ConstMappedVector(m_covPowers.data(), 4 * nsp + 1);
+    MappedVector(mcov.data(), nRows) =
+        m_covM * ConstMappedVector(logCoverages.data(), nsp);
+}
+
 InterfaceRateBase::InterfaceRateBase()
     : m_siteDensity(NAN)
     , m_acov(0.)
@@ -230,24 +303,30 @@ void InterfaceRateBase::updateFromStruct(const InterfaceData& shared_data) {
         m_siteDensity = shared_data.density;
     }
 
-    if (m_indices.size() != m_cov.size()) {
+    if (m_covRow < shared_data.acov.size()) {
+        // coverage terms are evaluated jointly for all rates
+        m_acov = shared_data.acov[m_covRow];
+        m_ecov = shared_data.ecov[m_covRow];
+        m_mcov = shared_data.mcov[m_covRow];
+    } else if (m_indices.size() != m_cov.size()) {
         // object is not set up correctly (setSpecies needs to be run)
         m_acov = NAN;
         m_ecov = NAN;
         m_mcov = NAN;
         return;
-    }
-    m_acov = 0.0;
-    m_ecov = 0.0;
-    m_mcov = 0.0;
-    for (auto& [iCov, iKin] : m_indices) {
-        m_acov += m_ac[iCov] * shared_data.coverages[iKin];
-        if (m_lindep[iCov]) {
-            m_ecov += m_ec[iCov][1] * shared_data.coverages[iKin];
-        } else {
-            m_ecov += poly4(shared_data.coverages[iKin], m_ec[iCov].data());
+    } else {
+        m_acov = 0.0;
+        m_ecov = 0.0;
+        m_mcov = 0.0;
+        for (auto& [iCov, iKin] : m_indices) {
+            m_acov += m_ac[iCov] * shared_data.coverages[iKin];
+            if (m_lindep[iCov]) {
+                m_ecov += m_ec[iCov][1] * shared_data.coverages[iKin];
+            } else {
+                m_ecov += poly4(shared_data.coverages[iKin], m_ec[iCov].data());
+            }
+            m_mcov += m_mc[iCov] * shared_data.logCoverages[iKin];
         }
-        m_mcov += m_mc[iCov] * shared_data.logCoverages[iKin];
     }
 
     // Update change in electrical potential energy
@@ -706,6 +706,13 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r, bool resize)
     return true;
 }
 
+void Kinetics::clearReactionInput()
+{
+    for (auto& rxn : m_reactions) {
+        rxn->input.clear();
+    }
+}
+
 void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     checkReactionIndex(i);
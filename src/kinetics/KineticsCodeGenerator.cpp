@@ -0,0 +1,632 @@
+//! @file KineticsCodeGenerator.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/KineticsCodeGenerator.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/Falloff.h"
+#include "cantera/kinetics/PlogRate.h"
+#include "cantera/kinetics/ChebyshevRate.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/thermo/speciesThermoTypes.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/global.h"
+#include <boost/algorithm/string.hpp>
+#include <fstream>
+#include <sstream>
+
+namespace ba = boost::algorithm;
+
+namespace Cantera
+{
+
+namespace {
+
+bool isIdentifier(const string& name)
+{
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    for (char c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Format a floating point literal which reproduces the value exactly
+string num(double x)
+{
+    if (!std::isfinite(x)) {
+        throw CanteraError("KineticsCodeGenerator", "Unable to generate code for "
+            "non-finite parameter value {}.", x);
+    }
+    string s = fmt::format("{:.17g}", x);
+    if (s.find_first_of(".e") == string::npos) {
+        s += ".0";
+    }
+    return s;
+}
+
+//! Expression for the rate constant of a modified Arrhenius expression, matching
+//! ArrheniusRate::evalRate
+string arrheniusExpr(const ArrheniusRate& rate)
+{
+    double A = rate.preExponentialFactor();
+    double b = rate.temperatureExponent();
+    double Ea_R = rate.activationEnergy() / GasConstant;
+    if (b == 0.0 && Ea_R == 0.0) {
+        return num(A);
+    } else if (b == 0.0) {
+        return fmt::format("{} * std::exp({} * recipT)", num(A), num(-Ea_R));
+    } else if (Ea_R == 0.0) {
+        return fmt::format("{} * std::exp({} * logT)", num(A), num(b));
+    }
+    return fmt::format("{} * std::exp({} * logT - {} * recipT)",
+                       num(A), num(b), num(Ea_R));
+}
+
+//! Expression for the natural logarithm of the sum of Arrhenius expressions, matching
+//! PlogRate::evalFromStruct
+string logArrheniusExpr(const vector<ArrheniusRate>& rates)
+{
+    if (rates.size() == 1 && rates[0].preExponentialFactor() > 0.0) {
+        const auto& rate = rates[0];
+        return fmt::format("{} + {} * logT - {} * recipT",
+                           num(std::log(rate.preExponentialFactor())),
+                           num(rate.temperatureExponent()),
+                           num(rate.activationEnergy() / GasConstant));
+    }
+    string sum = "1e-300";
+    for (const auto& rate : rates) {
+        sum += " + " + arrheniusExpr(rate);
+    }
+    return fmt::format("std::log({})", sum);
+}
+
+//! Factors of a product of concentrations raised to the power of reaction orders
+struct ConcentrationProduct
+{
+    //! Set up the product from a map of species indices to orders, where products
+    //! with small integer orders are written as plain multiplications and all other
+    //! products use powPos() (matching the distinction made by StoichManagerN)
+    explicit ConcentrationProduct(const map<size_t, double>& orders, bool plain)
+        : factors(orders.begin(), orders.end())
+    {
+        double total = 0.0;
+        for (const auto& [k, order] : factors) {
+            total += order;
+            plain = plain && order == std::round(order) && order > 0.0;
+        }
+        m_plain = plain && total <= 3.0;
+    }
+
+    //! Expression for the product
+    string expr() const {
+        return product(npos);
+    }
+
+    //! Expression for the derivative of the product with respect to the
+    //! concentration of species *k*, or an empty string if it is zero
+    string derivative(size_t k) const {
+        for (const auto& [j, order] : factors) {
+            if (j != k) {
+                continue;
+            }
+            string others = product(k);
+            string factor;
+            if (!m_plain) {
+                factor = fmt::format("{} * powPos(C[{}], {})",
+                                     num(order), k, num(order - 1.0));
+            } else if (order == 1.0) {
+                return others;
+            } else if (order == 2.0) {
+                factor = fmt::format("2.0 * C[{}]", k);
+            } else {
+                factor = fmt::format("3.0 * C[{}] * C[{}]", k, k);
+            }
+            return others == "1.0" ? factor : factor + " * " + others;
+        }
+        return "";
+    }
+
+    vector<pair<size_t, double>> factors; //!< Species indices and orders
+
+protected:
+    //! Product of all factors, excluding species *skip*
+    string product(size_t skip) const {
+        vector<string> terms;
+        for (const auto& [k, order] : factors) {
+            if (k == skip) {
+                continue;
+            }
+            if (!m_plain) {
+                terms.push_back(fmt::format("powPos(C[{}], {})", k, num(order)));
+                continue;
+            }
+            for (int n = 0; n < order; n++) {
+                terms.push_back(fmt::format("C[{}]", k));
+            }
+        }
+        if (terms.empty()) {
+            return "1.0";
+        }
+        std::stringstream out;
+        for (size_t n = 0; n < terms.size(); n++) {
+            out << (n ? " * " : "") << terms[n];
+        }
+        return out.str();
+    }
+
+    bool m_plain; //!< Use plain multiplications
+};
+
+//! Helper functions included in the generated source
+const string helpers = R"(
+//! Concentration raised to a non-integer power, or zero for non-positive values
+inline double powPos(double c, double order)
+{
+    return c > 0.0 ? std::pow(c, order) : 0.0;
+}
+
+//! Troe falloff function, where *g* is set to d ln(F) / d ln(Pr)
+inline double troeF(double logFcent, double pr, double& g)
+{
+    double lpr = std::log10(std::max(pr, SmallNumber));
+    double cc = -0.4 - 0.67 * logFcent;
+    double nn = 0.75 - 1.27 * logFcent;
+    double den = nn - 0.14 * (lpr + cc);
+    double f1 = (lpr + cc) / den;
+    double s = 1.0 / (1.0 + f1 * f1);
+    g = (pr > SmallNumber) ? -2.0 * logFcent * f1 * s * s * nn / (den * den) : 0.0;
+    return std::pow(10.0, logFcent / (1.0 + f1 * f1));
+}
+
+//! SRI falloff function, where *g* is set to d ln(F) / d ln(Pr)
+inline double sriF(double base, double scale, double pr, double& g)
+{
+    double lpr = std::log10(std::max(pr, SmallNumber));
+    double xx = 1.0 / (1.0 + lpr * lpr);
+    g = (pr > SmallNumber) ? -2.0 * lpr * xx * xx * std::log10(base) : 0.0;
+    return std::pow(base, xx) * scale;
+}
+
+//! Chebyshev rate expression with coefficients *c* in row-major order, where rows
+//! correspond to the reduced temperature *Tr* and columns to the reduced
+//! pressure *Pr*
+inline double chebyshev(const double* c, int nT, int nP, double Tr, double Pr)
+{
+    double logk = 0.0;
+    double Tnm1 = Tr;
+    double Tn = 1.0;
+    for (int i = 0; i < nT; i++) {
+        if (i) {
+            double Tnp1 = 2 * Tr * Tn - Tnm1;
+            Tnm1 = Tn;
+            Tn = Tnp1;
+        }
+        double dotProd = c[i * nP];
+        double Cnm1 = Pr;
+        double Cn = 1.0;
+        for (int j = 1; j < nP; j++) {
+            double Cnp1 = 2 * Pr * Cn - Cnm1;
+            dotProd += Cnp1 * c[i * nP + j];
+            Cnm1 = Cn;
+            Cn = Cnp1;
+        }
+        logk += (i ? Tn : 1.0) * dotProd;
+    }
+    return std::pow(10, logk);
+}
+)";
+
+} // end anonymous namespace
+
+KineticsCodeGenerator::KineticsCodeGenerator(shared_ptr<Solution> soln)
+    : m_soln(soln)
+{
+    if (!soln || !soln->kinetics() || soln->kinetics()->kineticsType() != "bulk"
+        || soln->thermo()->type() != "ideal-gas")
+    {
+        throw CanteraError("KineticsCodeGenerator::KineticsCodeGenerator",
+            "Code generation requires a Solution with an ideal gas phase and bulk "
+            "kinetics.");
+    }
+    m_prefix = isIdentifier(soln->name()) ? soln->name() : "mechanism";
+}
+
+void KineticsCodeGenerator::setPrefix(const string& prefix)
+{
+    if (!isIdentifier(prefix)) {
+        throw CanteraError("KineticsCodeGenerator::setPrefix",
+            "Prefix '{}' is not a valid identifier.", prefix);
+    }
+    m_prefix = prefix;
+}
+
+string KineticsCodeGenerator::toSource() const
+{
+    auto& thermo = *m_soln->thermo();
+    auto& kin = *m_soln->kinetics();
+    size_t nsp = thermo.nSpecies();
+    size_t nrxn = kin.nReactions();
+    std::stringstream out;
+
+    out << fmt::format(
+        "// Code generated by Cantera {} for phase '{}'; do not edit.\n"
+        "//\n"
+        "// Species ({}): {}\n"
+        "// Reactions: {}\n\n"
+        "#include <algorithm>\n#include <cmath>\n\nnamespace\n{{\n\n"
+        "const int nSpecies = {};\nconst int nReactions = {};\n"
+        "const double GasConstant = {};\nconst double refPressure = {};\n"
+        "const double SmallNumber = {};\nconst double BigNumber = {};\n",
+        version(), thermo.name(), nsp, ba::join(thermo.speciesNames(), " "), nrxn,
+        nsp, nrxn, num(GasConstant), num(thermo.refPressure()), num(SmallNumber),
+        num(BigNumber));
+    out << helpers;
+
+    // Reference state thermodynamic properties
+    out << "\n//! NASA polynomial coefficients: [T_mid, 7 high-T coefficients, "
+           "7 low-T coefficients]\n"
+           "const double nasaCoeffs[nSpecies][15] = {\n";
+    for (size_t k = 0; k < nsp; k++) {
+        auto& spThermo = *thermo.species(k)->thermo;
+        size_t n;
+        int type;
+        double tlow, thigh, pref;
+        vector<double> c(15);
+        spThermo.reportParameters(n, type, tlow, thigh, pref, c.data());
+        if (type != NASA2) {
+            throw NotImplementedError("KineticsCodeGenerator::toSource",
+                "Species '{}' uses an unsupported thermo model.",
+                thermo.speciesName(k));
+        }
+        vector<string> coeffs;
+        for (double x : c) {
+            coeffs.push_back(num(x));
+        }
+        out << fmt::format("    {{{}}}, // {}\n", ba::join(coeffs, ", "),
+                           thermo.speciesName(k));
+    }
+    out << "};\n\n"
+        "void updateThermo(double T, double* cp_R, double* h_RT, double* s_R)\n"
+        "{\n"
+        "    double tt[6];\n"
+        "    tt[0] = T;\n"
+        "    tt[1] = T * T;\n"
+        "    tt[2] = tt[1] * T;\n"
+        "    tt[3] = tt[2] * T;\n"
+        "    tt[4] = 1.0 / T;\n"
+        "    tt[5] = std::log(T);\n"
+        "    for (int k = 0; k < nSpecies; k++) {\n"
+        "        const double* c = (T <= nasaCoeffs[k][0]) ? nasaCoeffs[k] + 8\n"
+        "                                                  : nasaCoeffs[k] + 1;\n"
+        "        double ct1 = c[1] * tt[0];\n"
+        "        double ct2 = c[2] * tt[1];\n"
+        "        double ct3 = c[3] * tt[2];\n"
+        "        double ct4 = c[4] * tt[3];\n"
+        "        cp_R[k] = c[0] + ct1 + ct2 + ct3 + ct4;\n"
+        "        h_RT[k] = c[0] + 0.5 * ct1 + 1.0 / 3.0 * ct2 + 0.25 * ct3 + 0.2 * ct4\n"
+        "            + c[5] * tt[4];\n"
+        "        s_R[k] = c[0] * tt[5] + ct1 + 0.5 * ct2 + 1.0 / 3.0 * ct3\n"
+        "            + 0.25 * ct4 + c[6];\n"
+        "    }\n"
+        "}\n\n";
+
+    // Coefficient tables of Chebyshev rates
+    for (size_t i = 0; i < nrxn; i++) {
+        auto rate = std::dynamic_pointer_cast<ChebyshevRate>(kin.reaction(i)->rate());
+        if (!rate) {
+            continue;
+        }
+        const auto& data = rate->data();
+        vector<string> coeffs;
+        for (size_t m = 0; m < data.nRows(); m++) {
+            for (size_t n = 0; n < data.nColumns(); n++) {
+                coeffs.push_back(num(data(m, n)));
+            }
+        }
+        out << fmt::format("const double chebyshev{}[] = {{{}}};\n", i,
+                           ba::join(coeffs, ", "));
+    }
+
+    // Rates of progress and production rates
+    out << "\n"
+        "void evaluate(double T, double P, const double* C, double* wdot, "
+        "double* jac)\n"
+        "{\n"
+        "    double logT = std::log(T);\n"
+        "    double recipT = 1.0 / T;\n"
+        "    double logP = std::log(P);\n"
+        "    double log10P = std::log10(P);\n"
+        "    double cp_R[nSpecies], h_RT[nSpecies], s_R[nSpecies], g[nSpecies];\n"
+        "    updateThermo(T, cp_R, h_RT, s_R);\n"
+        "    for (int k = 0; k < nSpecies; k++) {\n"
+        "        g[k] = h_RT[k] - s_R[k];\n"
+        "        wdot[k] = 0.0;\n"
+        "    }\n"
+        "    if (jac) {\n"
+        "        std::fill(jac, jac + nSpecies * nSpecies, 0.0);\n"
+        "    }\n"
+        "    double logC0 = std::log(refPressure / (GasConstant * T));\n"
+        "    double ctot = 0.0;\n"
+        "    for (int k = 0; k < nSpecies; k++) {\n"
+        "        ctot += C[k];\n"
+        "    }\n"
+        "    double kf, rkcn, M, k0, kinf, pr, F, gF, dkf, fwd, rev, r, dr, q, dq;\n"
+        "    double Fcent, lk1, lk2;\n"
+        "    (void) ctot; (void) logP; (void) log10P; (void) dkf; (void) dr;\n"
+        "    (void) Fcent; (void) lk1; (void) lk2; (void) gF;\n";
+
+    for (size_t i = 0; i < nrxn; i++) {
+        auto rxn = kin.reaction(i);
+        auto rate = rxn->rate();
+        out << fmt::format("\n    // Reaction {}: {}\n", i, rxn->equation());
+
+        // Third-body concentration and efficiencies
+        auto tbody = rxn->thirdBody();
+        vector<double> eff;
+        if (tbody) {
+            eff.assign(nsp, tbody->default_efficiency);
+            string expr = (tbody->default_efficiency == 0.0) ? ""
+                : (tbody->default_efficiency == 1.0) ? "ctot"
+                : num(tbody->default_efficiency) + " * ctot";
+            for (const auto& [name, efficiency] : tbody->efficiencies) {
+                size_t k = kin.kineticsSpeciesIndex(name);
+                if (k == npos) {
+                    continue;
+                }
+                eff[k] = efficiency;
+                double delta = efficiency - tbody->default_efficiency;
+                if (delta != 0.0) {
+                    expr += fmt::format("{}{} * C[{}]", expr.empty() ? "" : " + ",
+                                        num(delta), k);
+                }
+            }
+            out << fmt::format("    M = {};\n", expr.empty() ? "0.0" : expr);
+        }
+
+        // Rate constant
+        bool falloff = false;
+        if (rate->type() == "Arrhenius") {
+            auto& arr = dynamic_cast<ArrheniusRate&>(*rate);
+            out << fmt::format("    kf = {};\n", arrheniusExpr(arr));
+        } else if (auto fr = std::dynamic_pointer_cast<FalloffRate>(rate)) {
+            falloff = true;
+            out << fmt::format("    k0 = {};\n", arrheniusExpr(fr->lowRate()));
+            out << fmt::format("    kinf = {};\n", arrheniusExpr(fr->highRate()));
+            out << "    pr = M * k0 / (kinf + SmallNumber);\n";
+            vector<double> c;
+            fr->getFalloffCoeffs(c);
+            string subType = fr->subType();
+            if (subType == "Lindemann") {
+                out << "    F = 1.0;\n    gF = 0.0;\n";
+            } else if (subType == "Troe" || subType == "Tsang") {
+                string Fcent;
+                if (subType == "Troe") {
+                    vector<string> terms;
+                    if (std::abs(c[1]) >= SmallNumber) {
+                        terms.push_back(fmt::format("{} * std::exp(-T * {})",
+                                                    num(1.0 - c[0]), num(1.0 / c[1])));
+                    }
+                    if (std::abs(c[2]) >= SmallNumber) {
+                        terms.push_back(fmt::format("{} * std::exp(-T * {})",
+                                                    num(c[0]), num(1.0 / c[2])));
+                    }
+                    if (c.size() == 4 && c[3] != 0.0) {
+                        terms.push_back(fmt::format("std::exp(-{} / T)", num(c[3])));
+                    }
+                    Fcent = terms.empty() ? "0.0" : ba::join(terms, " + ");
+                } else {
+                    Fcent = fmt::format("{} + {} * T", num(c[0]),
+                                        num(c.size() > 1 ? c[1] : 0.0));
+                }
+                out << fmt::format("    Fcent = {};\n", Fcent);
+                out << "    F = troeF(std::log10(std::max(Fcent, SmallNumber)), pr, "
+                       "gF);\n";
+            } else if (subType == "SRI") {
+                double d = c.size() == 5 ? c[3] : 1.0;
+                double e = c.size() == 5 ? c[4] : 0.0;
+                string base = fmt::format("{} * std::exp(-{} / T)", num(c[0]),
+                                          num(c[1]));
+                if (c[2] != 0.0) {
+                    base += fmt::format(" + std::exp(-T / {})", num(c[2]));
+                }
+                out << fmt::format("    F = sriF({}, {} * std::pow(T, {}), pr, gF);\n",
+                                   base, num(d), num(e));
+            } else {
+                throw NotImplementedError("KineticsCodeGenerator::toSource",
+                    "Unsupported falloff parameterization '{}' for reaction '{}'",
+                    subType, rxn->equation());
+            }
+            if (fr->chemicallyActivated()) {
+                out << "    kf = F / (1.0 + pr) * k0;\n"
+                       "    dkf = k0 * F / (1.0 + pr) * ((M > 0.0 ? gF / M : 0.0)\n"
+                       "        - k0 / (kinf + SmallNumber) / (1.0 + pr));\n";
+            } else {
+                out << "    kf = pr * (F / (1.0 + pr)) * kinf;\n"
+                       "    dkf = k0 * F / (1.0 + pr) * (1.0 / (1.0 + pr) + gF);\n";
+            }
+        } else if (auto plog = std::dynamic_pointer_cast<PlogRate>(rate)) {
+            vector<pair<double, vector<ArrheniusRate>>> levels;
+            for (const auto& [p, arr] : plog->getRates()) {
+                double logp = std::log(p);
+                if (levels.empty() || levels.back().first != logp) {
+                    levels.emplace_back(logp, vector<ArrheniusRate>());
+                }
+                levels.back().second.push_back(arr);
+            }
+            size_t nLevels = levels.size();
+            out << fmt::format("    if (logP < {}) {{\n        kf = std::exp({});\n",
+                               num(levels[0].first), logArrheniusExpr(levels[0].second));
+            for (size_t n = 1; n < nLevels; n++) {
+                double lp1 = levels[n - 1].first;
+                double lp2 = levels[n].first;
+                out << fmt::format(
+                    "    }} else if (logP < {}) {{\n"
+                    "        lk1 = {};\n"
+                    "        lk2 = {};\n"
+                    "        kf = std::exp(lk1 + (lk2 - lk1) * (logP - {}) * {});\n",
+                    num(lp2), logArrheniusExpr(levels[n - 1].second),
+                    logArrheniusExpr(levels[n].second), num(lp1),
+                    num(1.0 / (lp2 - lp1)));
+            }
+            out << fmt::format("    }} else {{\n        kf = std::exp({});\n    }}\n",
+                               logArrheniusExpr(levels.back().second));
+        } else if (auto cheb = std::dynamic_pointer_cast<ChebyshevRate>(rate)) {
+            double TminInv = 1.0 / cheb->Tmin();
+            double TmaxInv = 1.0 / cheb->Tmax();
+            double logPmin = std::log10(cheb->Pmin());
+            double logPmax = std::log10(cheb->Pmax());
+            out << fmt::format(
+                "    kf = chebyshev(chebyshev{}, {}, {}, (2 * recipT + {}) * {},\n"
+                "                   (2 * log10P + {}) * {});\n",
+                i, cheb->data().nRows(), cheb->data().nColumns(),
+                num(-TminInv - TmaxInv), num(1.0 / (TmaxInv - TminInv)),
+                num(-logPmin - logPmax), num(1.0 / (logPmax - logPmin)));
+        } else {
+            throw NotImplementedError("KineticsCodeGenerator::toSource",
+                "Unsupported rate type '{}' for reaction '{}'",
+                rate->type(), rxn->equation());
+        }
+
+        // Equilibrium constant and products of concentrations
+        map<size_t, double> netStoich, fwdOrders, revOrders;
+        double dn = 0.0;
+        string dG;
+        for (const auto& [name, stoich] : rxn->reactants) {
+            size_t k = kin.kineticsSpeciesIndex(name);
+            netStoich[k] -= stoich;
+            fwdOrders[k] = stoich;
+            dn -= stoich;
+            dG += fmt::format(" - {} * g[{}]", num(stoich), k);
+        }
+        for (const auto& [name, order] : rxn->orders) {
+            size_t k = kin.kineticsSpeciesIndex(name);
+            if (order == 0.0) {
+                fwdOrders.erase(k);
+            } else {
+                fwdOrders[k] = order;
+            }
+        }
+        for (const auto& [name, stoich] : rxn->products) {
+            size_t k = kin.kineticsSpeciesIndex(name);
+            netStoich[k] += stoich;
+            revOrders[k] = stoich;
+            dn += stoich;
+            dG += fmt::format(" + {} * g[{}]", num(stoich), k);
+        }
+        ConcentrationProduct fwd(fwdOrders, rxn->orders.empty());
+        ConcentrationProduct rev(revOrders, true);
+        bool reversible = rxn->reversible;
+        out << fmt::format("    fwd = {};\n", fwd.expr());
+        if (reversible) {
+            out << fmt::format("    rkcn = std::min(std::exp({} - {} * logC0), "
+                               "BigNumber);\n", dG.substr(1), num(dn));
+            out << fmt::format("    rev = {};\n", rev.expr());
+            out << "    r = kf * fwd - kf * rkcn * rev;\n";
+        } else {
+            out << "    r = kf * fwd;\n";
+        }
+        bool massAction = tbody && tbody->mass_action && !falloff;
+        out << (massAction ? "    q = r * M;\n" : "    q = r;\n");
+        for (const auto& [k, nu] : netStoich) {
+            if (nu == 1.0) {
+                out << fmt::format("    wdot[{}] += q;\n", k);
+            } else if (nu == -1.0) {
+                out << fmt::format("    wdot[{}] -= q;\n", k);
+            } else if (nu != 0.0) {
+                out << fmt::format("    wdot[{}] += {} * q;\n", k, num(nu));
+            }
+        }
+
+        // Derivatives with respect to species concentrations
+        out << "    if (jac) {\n";
+        if (falloff) {
+            out << (reversible ? "        dr = dkf * (fwd - rkcn * rev);\n"
+                               : "        dr = dkf * fwd;\n");
+        }
+        for (size_t j = 0; j < nsp; j++) {
+            vector<string> terms;
+            string dfwd = fwd.derivative(j);
+            if (!dfwd.empty()) {
+                terms.push_back(fmt::format("kf * {}", dfwd));
+            }
+            string drev = reversible ? rev.derivative(j) : "";
+            if (!drev.empty()) {
+                terms.push_back(fmt::format("- kf * rkcn * {}", drev));
+            }
+            string dq = ba::join(terms, " ");
+            if (massAction && !dq.empty()) {
+                dq = "(" + dq + ") * M";
+            }
+            // Third-body concentration only enters the rate for mass-action
+            // third-body reactions and through the reduced pressure of falloff
+            // reactions
+            if ((massAction || falloff) && eff[j] != 0.0) {
+                string third = massAction ? "r" : "dr";
+                if (eff[j] != 1.0) {
+                    third = num(eff[j]) + " * " + third;
+                }
+                dq += dq.empty() ? third : " + " + third;
+            }
+            if (dq.empty()) {
+                continue;
+            }
+            out << fmt::format("        dq = {};\n", dq);
+            for (const auto& [k, nu] : netStoich) {
+                if (nu == 1.0) {
+                    out << fmt::format("        jac[{}] += dq;\n", k * nsp + j);
+                } else if (nu == -1.0) {
+                    out << fmt::format("        jac[{}] -= dq;\n", k * nsp + j);
+                } else if (nu != 0.0) {
+                    out << fmt::format("        jac[{}] += {} * dq;\n", k * nsp + j,
+                                       num(nu));
+                }
+            }
+        }
+        out << "    }\n";
+    }
+    out << "}\n\n} // end anonymous namespace\n\n";
+
+    // Public interface
+    string p = m_prefix;
+    out << "// Export the public functions when compiled into a shared library\n"
+           "#ifndef CT_CODEGEN_EXPORT\n#if defined(_WIN32)\n"
+           "#define CT_CODEGEN_EXPORT __declspec(dllexport)\n"
+           "#elif defined(__GNUC__)\n"
+           "#define CT_CODEGEN_EXPORT __attribute__((visibility(\"default\")))\n"
+           "#else\n#define CT_CODEGEN_EXPORT\n#endif\n#endif\n\n";
+    out << "extern \"C\" {\n\n";
+    out << fmt::format(
+        "CT_CODEGEN_EXPORT int {}_nSpecies()\n{{\n    return nSpecies;\n}}\n\n", p);
+    out << fmt::format(
+        "CT_CODEGEN_EXPORT int {}_nReactions()\n{{\n    return nReactions;\n}}\n\n",
+        p);
+    out << fmt::format(
+        "CT_CODEGEN_EXPORT void {}_getThermo(double T, double* cp_R, double* h_RT,\n"
+        "    double* s_R)\n{{\n    updateThermo(T, cp_R, h_RT, s_R);\n}}\n\n", p);
+    out << fmt::format(
+        "CT_CODEGEN_EXPORT void {}_getNetProductionRates(double T, double P,\n"
+        "    const double* C, double* wdot)\n"
+        "{{\n    evaluate(T, P, C, wdot, nullptr);\n}}\n\n", p);
+    out << fmt::format(
+        "CT_CODEGEN_EXPORT void {}_getNetProductionRates_ddC(double T, double P,\n"
+        "    const double* C, double* wdot, double* jac)\n"
+        "{{\n    evaluate(T, P, C, wdot, jac);\n}}\n\n", p);
+    out << "}\n";
+    return out.str();
+}
+
+void KineticsCodeGenerator::toFile(const string& filename) const
+{
+    std::ofstream out(filename);
+    out << toSource();
+}
+
+}
@@ -13,6 +13,7 @@
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/Solution.h"
+#include "cantera/base/ExtensionManager.h"
 #include <boost/algorithm/string.hpp>
 
 namespace Cantera
@@ -104,6 +105,47 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
     return newKinetics(phases, phaseNode, root);
 }
 
+namespace {
+
+//! Construct reactions from *nodes* concurrently and add them to *kin* in order. For
+//! optimized builds, errors are collected in *errors* instead of being thrown.
+void addReactionNodes(Kinetics& kin, const vector<AnyMap>& nodes,
+                      fmt::memory_buffer& errors)
+{
+    vector<shared_ptr<Reaction>> reactions(nodes.size());
+    vector<std::exception_ptr> failed(nodes.size());
+    auto build = [&](size_t i) {
+        try {
+            reactions[i] = newReaction(nodes[i], kin);
+        } catch (CanteraError&) {
+            failed[i] = std::current_exception();
+        }
+    };
+    // Rates implemented in external languages are constructed sequentially
+    parallelFor(nodes.size(), build,
+                ExtensionManager::hasReactionDataLinkers() ? npos : 100);
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        #ifdef NDEBUG
+            try {
+                if (failed[i]) {
+                    std::rethrow_exception(failed[i]);
+                }
+                kin.addReaction(reactions[i], false);
+            } catch (CanteraError& err) {
+                fmt_append(errors, "{}", err.what());
+            }
+        #else
+            if (failed[i]) {
+                std::rethrow_exception(failed[i]);
+            }
+            kin.addReaction(reactions[i], false);
+        #endif
+    }
+}
+
+}
+
 void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     kin.skipUndeclaredThirdBodies(
@@ -183,30 +225,11 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
             AnyMap reactions = AnyMap::fromYamlFile(fileName,
                 rootNode.getString("__file__", ""));
             loadExtensions(reactions);
-            for (const auto& R : reactions[node].asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            addReactionNodes(kin, reactions[node].asVector<AnyMap>(), add_rxn_err);
         } else {
             // specified section is in the current file
-            for (const auto& R : rootNode.at(sections[i]).asVector<AnyMap>()) {
-                #ifdef NDEBUG
-                    try {
-                        kin.addReaction(newReaction(R, kin), false);
-                    } catch (CanteraError& err) {
-                        fmt_append(add_rxn_err, "{}", err.what());
-                    }
-                #else
-                    kin.addReaction(newReaction(R, kin), false);
-                #endif
-            }
+            addReactionNodes(kin, rootNode.at(sections[i]).asVector<AnyMap>(),
+                             add_rxn_err);
         }
     }
 
@@ -0,0 +1,206 @@
+//! @file MechanismReducer.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/kinetics/MechanismReducer.h"
+#include "cantera/kinetics/BulkKinetics.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/eigen_dense.h"
+#include <queue>
+
+namespace Cantera
+{
+
+MechanismReducer::MechanismReducer(Kinetics& kin)
+    : m_kin(kin)
+{
+    setup();
+}
+
+void MechanismReducer::setup()
+{
+    size_t nsp = m_kin.nTotalSpecies();
+    size_t nr = m_kin.nReactions();
+    m_nu = m_kin.productStoichCoeffs() - m_kin.reactantStoichCoeffs();
+    m_nu.prune(0.0);
+    m_delta = m_kin.productStoichCoeffs() + m_kin.reactantStoichCoeffs();
+    m_delta.prune(0.0);
+    std::fill(m_delta.valuePtr(), m_delta.valuePtr() + m_delta.nonZeros(), 1.0);
+    m_deltaT = m_delta.transpose();
+    m_importance.assign(nsp, 1.0);
+    m_activeSpecies.assign(nsp, true);
+    m_activeReactions.assign(nr, true);
+    m_ropnet.resize(nr);
+}
+
+void MechanismReducer::setMethod(const string& method)
+{
+    if (method == "DRGEP") {
+        m_drgep = true;
+    } else if (method == "DRG") {
+        m_drgep = false;
+    } else {
+        throw CanteraError("MechanismReducer::setMethod",
+                           "Unknown reduction method '{}'", method);
+    }
+}
+
+void MechanismReducer::setThreshold(double threshold)
+{
+    if (threshold <= 0 || threshold >= 1) {
+        throw CanteraError("MechanismReducer::setThreshold",
+                           "Threshold must be between 0 and 1; got {}", threshold);
+    }
+    m_threshold = threshold;
+}
+
+void MechanismReducer::setTargets(const vector<string>& targets)
+{
+    m_targets.clear();
+    for (const auto& name : targets) {
+        size_t k = m_kin.kineticsSpeciesIndex(name);
+        if (k == npos) {
+            throw CanteraError("MechanismReducer::setTargets",
+                               "Unknown target species '{}'", name);
+        }
+        m_targets.push_back(k);
+    }
+}
+
+bool MechanismReducer::update()
+{
+    if (m_targets.empty()) {
+        throw CanteraError("MechanismReducer::update", "No target species defined.");
+    }
+    size_t nsp = m_kin.nTotalSpecies();
+    size_t nr = m_kin.nReactions();
+    if (static_cast<size_t>(m_nu.rows()) != nsp
+        || static_cast<size_t>(m_nu.cols()) != nr)
+    {
+        setup();
+    }
+
+    // Contributions of each reaction to the species production rates
+    m_kin.getNetRatesOfProgress(m_ropnet.data());
+    Eigen::SparseMatrix<double> nuw =
+        m_nu * MappedVector(m_ropnet.data(), nr).asDiagonal();
+
+    // Denominators of the direct interaction coefficients
+    vector<double> prod(nsp, 0.0);
+    vector<double> cons(nsp, 0.0);
+    for (int i = 0; i < nuw.outerSize(); i++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(nuw, i); it; ++it) {
+            if (it.value() > 0) {
+                prod[it.row()] += it.value();
+            } else {
+                cons[it.row()] -= it.value();
+            }
+        }
+    }
+
+    // Numerators of the direct interaction coefficients, with rows corresponding
+    // to species A and columns to species B. For DRG, contributions of individual
+    // reactions are summed by magnitude, such that opposing contributions do not
+    // cancel; for DRGEP, the absolute value of the sum is used.
+    Eigen::SparseMatrix<double, Eigen::RowMajor> num;
+    if (m_drgep) {
+        num = nuw * m_deltaT;
+    } else {
+        num = nuw.cwiseAbs() * m_deltaT;
+    }
+
+    // Propagate importance from target species along the path maximizing the
+    // product of direct interaction coefficients
+    m_importance.assign(nsp, 0.0);
+    std::priority_queue<pair<double, size_t>> queue;
+    for (size_t k : m_targets) {
+        m_importance[k] = 1.0;
+        queue.emplace(1.0, k);
+    }
+    while (!queue.empty()) {
+        auto [R, a] = queue.top();
+        queue.pop();
+        double denom = m_drgep ? std::max(prod[a], cons[a]) : prod[a] + cons[a];
+        if (R < m_importance[a] || denom == 0.0) {
+            continue;
+        }
+        for (decltype(num)::InnerIterator it(num, a); it; ++it) {
+            size_t b = it.col();
+            double r = std::abs(it.value()) / denom;
+            if (!m_drgep) {
+                // DRG retains all species reachable along edges above the threshold
+                r = (r >= m_threshold) ? 1.0 : 0.0;
+            }
+            if (R * r > m_importance[b]) {
+                m_importance[b] = R * r;
+                queue.emplace(R * r, b);
+            }
+        }
+    }
+
+    for (size_t k = 0; k < nsp; k++) {
+        m_activeSpecies[k] = (m_importance[k] >= m_threshold);
+    }
+    bool changed = false;
+    for (size_t i = 0; i < nr; i++) {
+        bool active = true;
+        for (Eigen::SparseMatrix<double>::InnerIterator it(m_delta, i); it; ++it) {
+            active &= m_activeSpecies[it.row()];
+        }
+        changed |= (active != m_activeReactions[i]);
+        m_activeReactions[i] = active;
+    }
+    return changed;
+}
+
+void MechanismReducer::apply()
+{
+    restore();
+    if (auto bulk = dynamic_cast<BulkKinetics*>(&m_kin)) {
+        // Skip evaluation of inactive reactions, retaining any existing mask
+        m_savedMask = bulk->activeReactions();
+        vector<bool> mask = m_activeReactions;
+        for (size_t i = 0; i < m_savedMask.size(); i++) {
+            mask[i] = mask[i] && m_savedMask[i];
+        }
+        bulk->setActiveReactions(mask);
+        m_applied = true;
+        return;
+    }
+    for (size_t i = 0; i < m_activeReactions.size(); i++) {
+        if (!m_activeReactions[i]) {
+            m_deactivated.emplace_back(i, m_kin.multiplier(i));
+            m_kin.setMultiplier(i, 0.0);
+        }
+    }
+    m_applied = true;
+}
+
+void MechanismReducer::restore()
+{
+    if (!m_applied) {
+        return;
+    }
+    if (auto bulk = dynamic_cast<BulkKinetics*>(&m_kin)) {
+        bulk->setActiveReactions(m_savedMask);
+        m_savedMask.clear();
+    }
+    for (const auto& [i, multiplier] : m_deactivated) {
+        m_kin.setMultiplier(i, multiplier);
+    }
+    m_deactivated.clear();
+    m_applied = false;
+}
+
+size_t MechanismReducer::nActiveSpecies() const
+{
+    return std::count(m_activeSpecies.begin(), m_activeSpecies.end(), true);
+}
+
+size_t MechanismReducer::nActiveReactions() const
+{
+    return std::count(m_activeReactions.begin(), m_activeReactions.end(), true);
+}
+
+}
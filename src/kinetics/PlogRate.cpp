@@ -15,6 +15,80 @@ void PlogData::update(double T)
         "Missing state information: 'PlogData' requires pressure.");
 }
 
+void PlogData::update(double T, double P)
+{
+    ReactionData::update(T);
+    pressure = P;
+    logP = std::log(P);
+    if (!logA.size()) {
+        return;
+    }
+
+    if (logP != m_collapsedLogP) {
+        // Interpolate the Arrhenius parameters of the bounding reference pressures
+        m_collapsedLogP = logP;
+        for (Eigen::Index i = 0; i < logA.size(); i++) {
+            auto begin = m_refLogP.begin() + m_refStart[i];
+            auto end = m_refLogP.begin() + m_refStart[i + 1];
+            auto iter = std::upper_bound(begin, end, logP);
+            if (iter == begin || iter == end) {
+                // out of range; handled by PlogRate::updateFromStruct
+                logA[i] = NAN;
+                continue;
+            }
+            size_t j2 = iter - m_refLogP.begin();
+            size_t j1 = j2 - 1;
+            double f = (logP - m_refLogP[j1]) / (m_refLogP[j2] - m_refLogP[j1]);
+            logA[i] = m_refLogA[j1] + f * (m_refLogA[j2] - m_refLogA[j1]);
+            b[i] = m_refB[j1] + f * (m_refB[j2] - m_refB[j1]);
+            Ea_R[i] = m_refEa_R[j1] + f * (m_refEa_R[j2] - m_refEa_R[j1]);
+        }
+    }
+    rateCoefficients = (logA + b * logT - Ea_R * recipT).exp();
+    rateTemperature = T;
+}
+
+void PlogData::setRates(const vector<ReactionRate*>& rates)
+{
+    m_refStart.assign(1, 0);
+    m_refLogP.clear();
+    m_refLogA.clear();
+    m_refB.clear();
+    m_refEa_R.clear();
+    for (auto rate : rates) {
+        auto R = dynamic_cast<PlogRate*>(rate);
+        if (!R) {
+            continue;
+        }
+        R->m_dataIndex = m_refStart.size() - 1;
+        for (const auto& [logp, indices] : R->pressures_) {
+            m_refLogP.push_back(logp);
+            const auto& [i1, i2] = indices;
+            const ArrheniusRate& k = R->rates_[i1];
+            if (i2 == i1 + 1 && k.preExponentialFactor() > 0) {
+                m_refLogA.push_back(std::log(k.preExponentialFactor()));
+                m_refB.push_back(k.temperatureExponent());
+                m_refEa_R.push_back(k.activationEnergy() / GasConstant);
+            } else {
+                // sums of rate expressions cannot be collapsed
+                m_refLogA.push_back(NAN);
+                m_refB.push_back(0.0);
+                m_refEa_R.push_back(0.0);
+            }
+        }
+        m_refStart.push_back(m_refLogP.size());
+    }
+    size_t nRates = m_refStart.size() - 1;
+    logA.setConstant(nRates, NAN);
+    b.setZero(nRates);
+    Ea_R.setZero(nRates);
+    rateCoefficients.setZero(nRates);
+    m_collapsedLogP = NAN;
+    rateTemperature = NAN;
+    // Force evaluation of the effective rate parameters
+    invalidateCache();
+}
+
 bool PlogData::update(const ThermoPhase& phase, const Kinetics& kin)
 {
     double T = phase.temperature();
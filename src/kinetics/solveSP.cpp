@@ -8,6 +8,7 @@
 #include "cantera/kinetics/solveSP.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/numerics/eigen_dense.h"
 
 namespace Cantera
 {
@@ -42,6 +43,8 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
 
     if (bulkFunc == BULK_DEPOSITION) {
         m_neq = m_numTotSurfSpecies + m_numTotBulkSpeciesSS;
+        // The analytic Jacobian only covers the surface species equations
+        m_analyticJac = false;
     } else {
         m_neq = m_numTotSurfSpecies;
     }
@@ -75,6 +78,28 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
         }
     }
 
+    // Locate the surface phases within the species of each kinetics object
+    m_surfStartKSI.resize(m_numSurfPhases, vector<size_t>(m_numSurfPhases, npos));
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[m_indexKinObjSurfPhase[isp]];
+        for (size_t iph = 0; iph < kin->nPhases(); iph++) {
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                if (&kin->thermo(iph) == m_ptrsSurfPhase[jsp]) {
+                    m_surfStartKSI[isp][jsp] = kin->kineticsSpeciesIndex(0, iph);
+                }
+            }
+        }
+        // Approximate derivatives slow down convergence more than the analytic
+        // Jacobian speeds up each iteration
+        AnyMap settings;
+        kin->getDerivativeSettings(settings);
+        if (settings["skip-coverage-dependence"].asBool()
+            || settings["skip-electrochemistry"].asBool())
+        {
+            m_analyticJac = false;
+        }
+    }
+
     // Dimension solution vector
     size_t dim1 = std::max<size_t>(1, m_neq);
     m_CSolnSP.resize(dim1, 0.0);
@@ -84,6 +109,7 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_wtSpecies.resize(dim1, 0.0);
     m_resid.resize(dim1, 0.0);
     m_Jac.resize(dim1, dim1, 0.0);
+    m_sparseJac.resize(dim1, dim1);
 }
 
 int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
@@ -103,7 +129,11 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
     double damp=1.0;
     double inv_t = 0.0;
     double t_real = 0.0, update_norm = 1.0E6;
+    double resid_norm = 0.0;
     bool do_time = false, not_converged = true;
+    m_jacAge = 0;
+    m_nJacEvalsFD = 0;
+    m_nJacEvalsAnalytic = 0;
     m_ioflag = std::min(m_ioflag, 1);
 
     // Set the initial value of the do_time parameter
@@ -181,23 +211,50 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
         }
         deltaT = 1.0/inv_t;
 
-        // Call the routine to numerically evaluation the Jacobian and residual
-        // for the current iteration.
-        resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
-                    m_CSolnSPOld.data(), do_time, deltaT);
+        // Evaluate the residual and the Jacobian for the current iteration. The
+        // analytic Jacobian is reused while the residual keeps decreasing.
+        bool sparse = m_analyticJac;
+        if (sparse) {
+            fun_eval(m_resid.data(), m_CSolnSP.data(), m_CSolnSPOld.data(),
+                     do_time, deltaT);
+            if (m_jacAge > 0 && m_jacAge < m_maxJacAge && deltaT == m_jacDeltaT
+                && calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq)
+                   < 0.5 * resid_norm)
+            {
+                m_jacAge++;
+            } else {
+                sparse = sparse_jac_eval(do_time, deltaT);
+                if (sparse) {
+                    m_nJacEvalsAnalytic++;
+                }
+            }
+        }
+        if (!sparse) {
+            // Numerically evaluate the Jacobian and residual
+            m_jacAge = 0;
+            m_nJacEvalsFD++;
+            resjac_eval(m_Jac, m_resid.data(), m_CSolnSP.data(),
+                        m_CSolnSPOld.data(), do_time, deltaT);
+        }
 
         // Calculate the weights. Make sure the calculation is carried out on
         // the first iteration.
         if (iter%4 == 1) {
-            calcWeights(m_wtSpecies.data(), m_wtResid.data(),
-                        m_Jac, m_CSolnSP.data(), abstol, reltol);
+            calcWeights(m_wtSpecies.data(), m_wtResid.data(), m_CSolnSP.data(),
+                        abstol, reltol);
         }
 
         // Find the weighted norm of the residual
-        double resid_norm = calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq);
+        resid_norm = calcWeightedNorm(m_wtResid.data(), m_resid.data(), m_neq);
 
         // Solve Linear system.  The solution is in m_resid
-        solve(m_Jac, m_resid.data());
+        if (sparse) {
+            MappedVector resid(m_resid.data(), m_neq);
+            Eigen::VectorXd dx = m_sparseSolver.solve(resid);
+            resid = dx;
+        } else {
+            solve(m_Jac, m_resid.data());
+        }
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
@@ -458,6 +515,66 @@ void solveSP::resjac_eval(DenseMatrix& jac, double resid[], double CSoln[],
     }
 }
 
+bool solveSP::sparse_jac_eval(const bool do_time, const double deltaT)
+{
+    m_jacTrips.clear();
+    size_t kins = 0;
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        size_t nsp = m_nSpeciesSurfPhase[isp];
+        Eigen::SparseMatrix<double> dwdot;
+        try {
+            dwdot = m_objects[isp]->netProductionRates_ddCi();
+        } catch (NotImplementedError&) {
+            // Derivatives are not available, for example for coverage-dependent
+            // reactions; use the finite difference Jacobian from now on
+            m_analyticJac = false;
+            return false;
+        }
+        size_t kstart = m_surfStartKSI[isp][isp];
+        size_t kspecial = kins + m_spSurfLarge[isp];
+        size_t jstart = 0;
+        for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+            size_t jKSI = m_surfStartKSI[isp][jsp];
+            for (size_t j = 0; jKSI != npos && j < m_nSpeciesSurfPhase[jsp]; j++) {
+                for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, jKSI + j);
+                     it; ++it)
+                {
+                    size_t row = static_cast<size_t>(it.row());
+                    if (row < kstart || row >= kstart + nsp) {
+                        continue;
+                    }
+                    size_t k = kins + row - kstart;
+                    if (k != kspecial) {
+                        m_jacTrips.emplace_back(static_cast<int>(k),
+                                                static_cast<int>(jstart + j),
+                                                -it.value());
+                    }
+                }
+            }
+            jstart += m_nSpeciesSurfPhase[jsp];
+        }
+        // Site conservation replaces the equation for the largest species
+        for (size_t k = 0; k < nsp; k++) {
+            m_jacTrips.emplace_back(static_cast<int>(kspecial),
+                                    static_cast<int>(kins + k), -1.0);
+            if (do_time && kins + k != kspecial) {
+                m_jacTrips.emplace_back(static_cast<int>(kins + k),
+                                        static_cast<int>(kins + k), 1.0 / deltaT);
+            }
+        }
+        kins += nsp;
+    }
+    m_sparseJac.setFromTriplets(m_jacTrips.begin(), m_jacTrips.end());
+    m_sparseSolver.compute(m_sparseJac);
+    if (m_sparseSolver.info() != Eigen::Success) {
+        m_jacAge = 0;
+        return false;
+    }
+    m_jacAge = 1;
+    m_jacDeltaT = deltaT;
+    return true;
+}
+
 /**
  * This function calculates a damping factor for the Newton iteration update
  * vector, dxneg, to insure that all site and bulk fractions, x, remain
@@ -527,8 +644,7 @@ static double calcWeightedNorm(const double wtX[], const double dx[], size_t dim
     return sqrt(norm/dim);
 }
 
-void solveSP::calcWeights(double wtSpecies[], double wtResid[],
-                          const Array2D& Jac, const double CSoln[],
+void solveSP::calcWeights(double wtSpecies[], double wtResid[], const double CSoln[],
                           const double abstol, const double reltol)
 {
     // First calculate the weighting factor for the concentrations of the
@@ -552,10 +668,21 @@ void solveSP::calcWeights(double wtSpecies[], double wtResid[],
     // Now do the residual Weights. Since we have the Jacobian, we will use it
     // to generate a number based on the what a significant change in a solution
     // variable does to each residual. This is a row sum scale operation.
+    if (m_jacAge) {
+        std::fill(wtResid, wtResid + m_neq, 0.0);
+        for (int jcol = 0; jcol < m_sparseJac.outerSize(); jcol++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(m_sparseJac, jcol); it;
+                 ++it)
+            {
+                wtResid[it.row()] += fabs(it.value() * wtSpecies[jcol]);
+            }
+        }
+        return;
+    }
     for (size_t k = 0; k < m_neq; k++) {
         wtResid[k] = 0.0;
         for (size_t jcol = 0; jcol < m_neq; jcol++) {
-            wtResid[k] += fabs(Jac(k,jcol) * wtSpecies[jcol]);
+            wtResid[k] += fabs(m_Jac(k,jcol) * wtSpecies[jcol]);
         }
     }
 }
@@ -68,6 +68,26 @@ extern "C" {
         }
     #endif
 
+    //! Function called by cvodes to evaluate the right-hand side of the adjoint
+    //! equations
+    static int cvodes_rhsB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector yBdot,
+                           void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointNoThrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                     NV_DATA_S(yBdot));
+    }
+
+    //! Function called by cvodes to evaluate the integrand of the adjoint
+    //! sensitivities
+    static int cvodes_quadB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector qBdot,
+                            void* f_data)
+    {
+        FuncEval* f = (FuncEval*) f_data;
+        return f->evalAdjointQuadratureNoThrow(t, NV_DATA_S(y), NV_DATA_S(yB),
+                                               NV_DATA_S(qBdot));
+    }
+
     static int cvodes_prec_setup(sunrealtype t, N_Vector y, N_Vector ydot,
                                  sunbooleantype jok, sunbooleantype *jcurPtr,
                                  sunrealtype gamma, void *f_data)
@@ -109,6 +129,8 @@ CVodesIntegrator::~CVodesIntegrator()
 
     SUNLinSolFree((SUNLinearSolver) m_linsol);
     SUNMatDestroy((SUNMatrix) m_linsol_matrix);
+    SUNLinSolFree((SUNLinearSolver) m_linsolB);
+    SUNMatDestroy((SUNMatrix) m_linsol_matrixB);
 
     if (m_y) {
         N_VDestroy_Serial(m_y);
@@ -119,6 +141,12 @@ CVodesIntegrator::~CVodesIntegrator()
     if (m_dky) {
         N_VDestroy_Serial(m_dky);
     }
+    if (m_yB) {
+        N_VDestroy_Serial(m_yB);
+    }
+    if (m_qB) {
+        N_VDestroy_Serial(m_qB);
+    }
     if (m_yS) {
         #if SUNDIALS_VERSION_MAJOR >= 6
             N_VDestroyVectorArray(m_yS, static_cast<int>(m_np));
@@ -331,6 +359,16 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
                                   func.m_paramScales.data(), NULL);
         checkError(flag, "initialize", "CVodeSetSensParams");
     }
+
+    // Memory of the backward problem was freed along with the previous CVODES
+    // memory block
+    m_whichB = -1;
+    m_nCheckpoints = 0;
+    m_adjoint = (m_adjointInterval > 0);
+    if (m_adjoint) {
+        flag = CVodeAdjInit(m_cvode_mem, m_adjointInterval, CV_HERMITE);
+        checkError(flag, "initialize", "CVodeAdjInit");
+    }
     applyOptions();
 }
 
@@ -348,6 +386,12 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     }
     int result = CVodeReInit(m_cvode_mem, m_t0, m_y);
     checkError(result, "reinitialize", "CVodeReInit");
+    if (m_adjoint) {
+        // discard checkpoints of the previous forward integration
+        result = CVodeAdjReInit(m_cvode_mem);
+        checkError(result, "reinitialize", "CVodeAdjReInit");
+        m_nCheckpoints = 0;
+    }
     applyOptions();
 }
 
@@ -517,7 +561,7 @@ void CVodesIntegrator::integrate(double tout)
                 "time ({}).\nCurrent integrator time: {}{}",
                 nsteps, tout, m_tInteg, f_errs);
         }
-        int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+        int flag = stepForward(tout);
         if (flag != CV_SUCCESS) {
             string f_errs = m_func->getErrors();
             if (!f_errs.empty()) {
@@ -539,7 +583,7 @@ void CVodesIntegrator::integrate(double tout)
 
 double CVodesIntegrator::step(double tout)
 {
-    int flag = CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+    int flag = stepForward(tout);
     if (flag != CV_SUCCESS) {
         string f_errs = m_func->getErrors();
         if (!f_errs.empty()) {
@@ -557,6 +601,133 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+int CVodesIntegrator::stepForward(double tout)
+{
+    if (m_adjoint) {
+        return CVodeF(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP,
+                      &m_nCheckpoints);
+    }
+    return CVode(m_cvode_mem, tout, m_y, &m_tInteg, CV_ONE_STEP);
+}
+
+void CVodesIntegrator::adjointInit()
+{
+    #if SUNDIALS_VERSION_MAJOR < 4
+        int flag = CVodeCreateB(m_cvode_mem, m_method, CV_NEWTON, &m_whichB);
+    #else
+        int flag = CVodeCreateB(m_cvode_mem, m_method, &m_whichB);
+    #endif
+    checkError(flag, "adjointInit", "CVodeCreateB");
+    flag = CVodeInitB(m_cvode_mem, m_whichB, cvodes_rhsB, m_time, m_yB);
+    checkError(flag, "adjointInit", "CVodeInitB");
+    flag = CVodeQuadInitB(m_cvode_mem, m_whichB, cvodes_quadB, m_qB);
+    checkError(flag, "adjointInit", "CVodeQuadInitB");
+    flag = CVodeSetUserDataB(m_cvode_mem, m_whichB, m_func);
+    checkError(flag, "adjointInit", "CVodeSetUserDataB");
+
+    // Dense linear solver, where the Jacobian of the adjoint equations is evaluated
+    // by finite differences of their right-hand side
+    sd_size_t N = static_cast<sd_size_t>(m_neq);
+    SUNLinSolFree((SUNLinearSolver) m_linsolB);
+    SUNMatDestroy((SUNMatrix) m_linsol_matrixB);
+    #if SUNDIALS_VERSION_MAJOR >= 6
+        m_linsol_matrixB = SUNDenseMatrix(N, N, m_sundials_ctx.get());
+    #else
+        m_linsol_matrixB = SUNDenseMatrix(N, N);
+    #endif
+    if (m_linsol_matrixB == nullptr) {
+        throw CanteraError("CVodesIntegrator::adjointInit",
+            "Unable to create SUNDenseMatrix of size {0} x {0}", N);
+    }
+    #if SUNDIALS_VERSION_MAJOR >= 6
+        #if CT_SUNDIALS_USE_LAPACK
+            m_linsolB = SUNLinSol_LapackDense(m_yB, (SUNMatrix) m_linsol_matrixB,
+                                              m_sundials_ctx.get());
+        #else
+            m_linsolB = SUNLinSol_Dense(m_yB, (SUNMatrix) m_linsol_matrixB,
+                                        m_sundials_ctx.get());
+        #endif
+        flag = CVodeSetLinearSolverB(m_cvode_mem, m_whichB,
+            (SUNLinearSolver) m_linsolB, (SUNMatrix) m_linsol_matrixB);
+    #else
+        #if CT_SUNDIALS_USE_LAPACK
+            m_linsolB = SUNLapackDense(m_yB, (SUNMatrix) m_linsol_matrixB);
+        #else
+            m_linsolB = SUNDenseLinearSolver(m_yB, (SUNMatrix) m_linsol_matrixB);
+        #endif
+        flag = CVDlsSetLinearSolverB(m_cvode_mem, m_whichB,
+            (SUNLinearSolver) m_linsolB, (SUNMatrix) m_linsol_matrixB);
+    #endif
+    if (m_linsolB == nullptr) {
+        throw CanteraError("CVodesIntegrator::adjointInit",
+            "Error creating Sundials dense linear solver object");
+    }
+    checkError(flag, "adjointInit", "CVodeSetLinearSolverB");
+}
+
+void CVodesIntegrator::integrateAdjoint(const double* lambda, double* sens)
+{
+    if (!m_adjoint) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint", "No checkpoints "
+            "are available. Checkpointing needs to be enabled using "
+            "setAdjointCheckpointInterval before initializing the integrator.");
+    } else if (m_time == m_t0) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                           "No forward integration has been performed.");
+    }
+    size_t np = m_func->m_sens_params.size();
+    if (np == 0) {
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+                           "No sensitivity parameters are defined.");
+    }
+    if (!m_yB || NV_LENGTH_S(m_yB) != static_cast<sd_size_t>(m_neq)) {
+        if (m_yB) {
+            N_VDestroy_Serial(m_yB);
+        }
+        m_yB = newNVector(m_neq, m_sundials_ctx);
+    }
+    if (!m_qB || NV_LENGTH_S(m_qB) != static_cast<sd_size_t>(np)) {
+        if (m_qB) {
+            N_VDestroy_Serial(m_qB);
+        }
+        m_qB = newNVector(np, m_sundials_ctx);
+    }
+    std::copy(lambda, lambda + m_neq, NV_DATA_S(m_yB));
+    N_VConst(0.0, m_qB);
+
+    int flag;
+    if (m_whichB < 0) {
+        adjointInit();
+    } else {
+        flag = CVodeReInitB(m_cvode_mem, m_whichB, m_time, m_yB);
+        checkError(flag, "integrateAdjoint", "CVodeReInitB");
+        flag = CVodeQuadReInitB(m_cvode_mem, m_whichB, m_qB);
+        checkError(flag, "integrateAdjoint", "CVodeQuadReInitB");
+    }
+    flag = CVodeSStolerancesB(m_cvode_mem, m_whichB, m_reltolsens, m_abstolsens);
+    checkError(flag, "integrateAdjoint", "CVodeSStolerancesB");
+    if (m_maxsteps > 0) {
+        CVodeSetMaxNumStepsB(m_cvode_mem, m_whichB, m_maxsteps);
+    }
+
+    flag = CVodeB(m_cvode_mem, m_t0, CV_NORMAL);
+    if (flag != CV_SUCCESS) {
+        string f_errs = m_func->getErrors();
+        if (!f_errs.empty()) {
+            f_errs = "Exceptions caught during adjoint evaluation:\n" + f_errs;
+        }
+        throw CanteraError("CVodesIntegrator::integrateAdjoint",
+            "CVodes error encountered. Error code: {}\n{}\n{}",
+            flag, m_error_message, f_errs);
+    }
+    double tB;
+    flag = CVodeGetB(m_cvode_mem, m_whichB, &tB, m_yB);
+    checkError(flag, "integrateAdjoint", "CVodeGetB");
+    flag = CVodeGetQuadB(m_cvode_mem, m_whichB, &tB, m_qB);
+    checkError(flag, "integrateAdjoint", "CVodeGetQuadB");
+    std::copy(NV_DATA_S(m_qB), NV_DATA_S(m_qB) + np, sens);
+}
+
 double* CVodesIntegrator::derivative(double tout, int n)
 {
     int flag = CVodeGetDky(m_cvode_mem, tout, n, m_dky);
@@ -617,6 +788,19 @@ AnyMap CVodesIntegrator::solverStats() const
         stats["step_solve_fails"] = stepSolveFails;
     #endif
 
+    if (m_adjoint) {
+        stats["adjoint_checkpoints"] = m_nCheckpoints;
+    }
+    if (m_whichB >= 0) {
+        // statistics of the last backward integration of the adjoint equations
+        void* memB = CVodeGetAdjCVodeBmem(m_cvode_mem, m_whichB);
+        long int stepsB = 0, rhsEvalsB = 0;
+        CVodeGetNumSteps(memB, &stepsB);
+        CVodeGetNumRhsEvals(memB, &rhsEvalsB);
+        stats["adjoint_steps"] = stepsB;
+        stats["adjoint_rhs_evals"] = rhsEvalsB;
+    }
+
     stats["steps"] = steps;
     stats["rhs_evals"] = rhsEvals;
     stats["nonlinear_iters"] = nonlinIters;
@@ -68,6 +68,74 @@ int FuncEval::evalDaeNoThrow(double t, double* y, double* ydot, double* r)
     return 0; // successful evaluation
 }
 
+int FuncEval::evalAdjointNoThrow(double t, double* y, double* lambda,
+                                 double* lambdaDot)
+{
+    try {
+        evalAdjoint(t, y, lambda, lambdaDot, m_sens_params.data());
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::evalAdjointNoThrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    } catch (...) {
+        string msg = "FuncEval::evalAdjointNoThrow: unhandled exception of unknown "
+                     "type\n";
+        if (suppressErrors()) {
+            m_errors.push_back(msg);
+        } else {
+            writelog(msg);
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
+int FuncEval::evalAdjointQuadratureNoThrow(double t, double* y, double* lambda,
+                                           double* qdot)
+{
+    try {
+        evalAdjointQuadrature(t, y, lambda, qdot, m_sens_params.data());
+    } catch (CanteraError& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog(err.what());
+        }
+        return 1; // possibly recoverable error
+    } catch (std::exception& err) {
+        if (suppressErrors()) {
+            m_errors.push_back(err.what());
+        } else {
+            writelog("FuncEval::evalAdjointQuadratureNoThrow: unhandled exception:\n");
+            writelog(err.what());
+            writelogendl();
+        }
+        return -1; // unrecoverable error
+    } catch (...) {
+        string msg = "FuncEval::evalAdjointQuadratureNoThrow: unhandled exception "
+                     "of unknown type\n";
+        if (suppressErrors()) {
+            m_errors.push_back(msg);
+        } else {
+            writelog(msg);
+        }
+        return -1; // unrecoverable error
+    }
+    return 0; // successful evaluation
+}
+
 string FuncEval::getErrors() const {
     std::stringstream errs;
     for (const auto& err : m_errors) {
@@ -5,6 +5,7 @@
 
 #include "cantera/numerics/funcs.h"
 #include "cantera/numerics/polyfit.h"
+#include "cantera/numerics/eigen_dense.h"
 #include "cantera/base/ctexceptions.h"
 
 namespace Cantera
@@ -109,6 +110,40 @@ double simpson(const Eigen::ArrayXd& f, const Eigen::ArrayXd& x)
     }
 }
 
+Eigen::ArrayXd simpsonWeights(const Eigen::ArrayXd& x)
+{
+    if (x.size() < 2) {
+        throw CanteraError("simpsonWeights",
+                           "Vector lengths need to be larger than two.");
+    }
+    Eigen::ArrayXd h = x.tail(x.size() - 1) - x.head(x.size() - 1);
+    if ((h <= 0.0).any()) {
+        throw CanteraError("simpsonWeights",
+            "Values of x need to be positive and monotonically increasing.");
+    }
+
+    Eigen::ArrayXd w = Eigen::ArrayXd::Zero(x.size());
+    // Number of intervals covered by Simpson's rule; for an even number of points,
+    // the last interval uses the trapezoidal rule (see simpson)
+    size_t N = x.size() - 1;
+    if (x.size() % 2 == 0) {
+        N--;
+        w[N] += 0.5 * h[N];
+        w[N + 1] += 0.5 * h[N];
+    }
+    for (size_t i = 1; i < N; i += 2) {
+        double h0 = h[i-1];
+        double h1 = h[i];
+        double hph = h1 + h0;
+        double hdh = h1 / h0;
+        double hmh = h1 * h0;
+        w[i - 1] += (hph / 6.0) * (2.0 - hdh);
+        w[i] += (hph / 6.0) * pow(hph, 2) / hmh;
+        w[i + 1] += (hph / 6.0) * (2.0 - 1.0 / hdh);
+    }
+    return w;
+}
+
 double numericalQuadrature(const string& method,
                            const Eigen::ArrayXd& f,
                            const Eigen::ArrayXd& x)
@@ -124,4 +159,28 @@ double numericalQuadrature(const string& method,
     }
 }
 
+Eigen::MatrixXd expm(const Eigen::MatrixXd& A)
+{
+    const int q = 6;
+    size_t n = A.rows();
+    double norm = A.cwiseAbs().rowwise().sum().maxCoeff();
+    int s = (norm > 0.5) ? static_cast<int>(std::ceil(std::log2(norm / 0.5))) : 0;
+    Eigen::MatrixXd As = A / std::pow(2.0, s);
+    Eigen::MatrixXd X = Eigen::MatrixXd::Identity(n, n);
+    Eigen::MatrixXd N = X;
+    Eigen::MatrixXd D = X;
+    double c = 1.0;
+    for (int k = 1; k <= q; k++) {
+        c *= (q - k + 1.0) / (k * (2.0 * q - k + 1.0));
+        X = As * X;
+        N += c * X;
+        D += ((k % 2) ? -c : c) * X;
+    }
+    Eigen::MatrixXd E = D.partialPivLu().solve(N);
+    for (int k = 0; k < s; k++) {
+        E = E * E;
+    }
+    return E;
+}
+
 }
@@ -0,0 +1,120 @@
+//! @file Sim1DSensitivity.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/oneD/Sim1DSensitivity.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/base/Solution.h"
+
+namespace Cantera
+{
+
+//! Copy of the flame model used by a single thread
+class Sim1DSensitivity::FlameWorker : public BruteForceSensitivity::Worker
+{
+public:
+    FlameWorker(shared_ptr<Solution> sol, const Sim1DSensitivity& parent)
+        : m_sol(sol)
+        , m_refine(parent.m_refine)
+        , m_objectives(parent.m_objectives)
+    {
+        m_sim = parent.m_factory(sol);
+        if (!m_sim) {
+            throw CanteraError("Sim1DSensitivity::newWorker",
+                               "Factory function did not return a Sim1D object.");
+        }
+    }
+
+    Kinetics& kinetics() override {
+        return *m_sol->kinetics();
+    }
+
+    void solve(bool warmStart, vector<double>& values) override {
+        if (warmStart) {
+            restoreBase();
+        }
+        m_sim->solve(0, m_refine);
+        for (size_t n = 0; n < m_objectives.size(); n++) {
+            values[n] = m_objectives[n](*m_sim);
+        }
+        if (!warmStart) {
+            saveBase();
+        }
+    }
+
+protected:
+    //! Store the grid and solution of the unperturbed model
+    void saveBase() {
+        m_grid.clear();
+        m_x.clear();
+        for (size_t n = 0; n < m_sim->nDomains(); n++) {
+            Domain1D& d = m_sim->domain(n);
+            m_grid.push_back(d.grid());
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                for (size_t i = 0; i < d.nComponents(); i++) {
+                    m_x.push_back(m_sim->value(n, i, j));
+                }
+            }
+        }
+    }
+
+    //! Restore the grid and solution of the unperturbed model
+    void restoreBase() {
+        for (size_t n = 0; n < m_sim->nDomains(); n++) {
+            Domain1D& d = m_sim->domain(n);
+            if (d.grid() != m_grid[n]) {
+                d.setupGrid(m_grid[n].size(), m_grid[n].data());
+            }
+        }
+        m_sim->resize();
+        size_t k = 0;
+        for (size_t n = 0; n < m_sim->nDomains(); n++) {
+            Domain1D& d = m_sim->domain(n);
+            for (size_t j = 0; j < d.nPoints(); j++) {
+                for (size_t i = 0; i < d.nComponents(); i++) {
+                    m_sim->setValue(n, i, j, m_x[k++]);
+                }
+            }
+        }
+    }
+
+    shared_ptr<Solution> m_sol;
+    shared_ptr<Sim1D> m_sim;
+    bool m_refine;
+    vector<function<double(Sim1D&)>> m_objectives;
+    vector<vector<double>> m_grid; //!< Grids of the unperturbed solution
+    vector<double> m_x; //!< Unperturbed solution
+};
+
+Sim1DSensitivity::Sim1DSensitivity(
+        shared_ptr<Solution> sol,
+        function<shared_ptr<Sim1D>(shared_ptr<Solution>)> factory)
+    : BruteForceSensitivity(sol)
+    , m_factory(factory)
+{
+}
+
+void Sim1DSensitivity::addObjective(const string& name,
+                                    function<double(Sim1D&)> objective)
+{
+    addObjectiveName(name);
+    m_objectives.push_back(objective);
+}
+
+void Sim1DSensitivity::addFlameSpeed(const string& domain, const string& name)
+{
+    addObjective(name, [domain](Sim1D& sim) {
+        size_t n = sim.domainIndex(domain);
+        return sim.value(n, sim.domain(n).componentIndex("velocity"), 0);
+    });
+}
+
+unique_ptr<BruteForceSensitivity::Worker> Sim1DSensitivity::newWorker(
+    shared_ptr<Solution> sol)
+{
+    return make_unique<FlameWorker>(sol, *this);
+}
+
+}
@@ -16,6 +16,7 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/thermo/Species.h"
+#include "cantera/numerics/eigen_dense.h"
 
 using namespace std;
 
@@ -210,6 +211,44 @@ void CoverageDependentSurfPhase::initThermo()
             }
         }
     }
+    _buildCovDepMatrices();
+}
+
+void CoverageDependentSurfPhase::_buildCovDepMatrices()
+{
+    int nsp = static_cast<int>(m_kk);
+    SparseTriplets enthalpy, entropy;
+    for (auto& item : m_PolynomialDependency) {
+        int k = static_cast<int>(item.k);
+        int j = static_cast<int>(item.j);
+        // The zeroth-order coefficients are always zero
+        for (int p = 1; p < std::min<int>(item.enthalpy_coeffs.size(), 5); p++) {
+            enthalpy.emplace_back(k, (p - 1) * nsp + j, item.enthalpy_coeffs[p]);
+        }
+        for (int p = 1; p < std::min<int>(item.entropy_coeffs.size(), 5); p++) {
+            entropy.emplace_back(k, (p - 1) * nsp + j, item.entropy_coeffs[p]);
+        }
+    }
+    m_polyEnthalpy.resize(nsp, 4 * nsp);
+    m_polyEnthalpy.setFromTriplets(enthalpy.begin(), enthalpy.end());
+    m_polyEntropy.resize(nsp, 4 * nsp);
+    m_polyEntropy.setFromTriplets(entropy.begin(), entropy.end());
+
+    SparseTriplets cpA, cpB;
+    for (auto& item : m_HeatCapacityDependency) {
+        cpA.emplace_back(static_cast<int>(item.k), static_cast<int>(item.j),
+                         item.coeff_a);
+        cpB.emplace_back(static_cast<int>(item.k), static_cast<int>(item.j),
+                         item.coeff_b);
+    }
+    m_cpCoeffsA.resize(nsp, nsp);
+    m_cpCoeffsA.setFromTriplets(cpA.begin(), cpA.end());
+    m_cpCoeffsB.resize(nsp, nsp);
+    m_cpCoeffsB.setFromTriplets(cpB.begin(), cpB.end());
+
+    m_covPowers.assign(4 * m_kk, 0.0);
+    m_cpCovA.assign(m_kk, 0.0);
+    m_cpCovB.assign(m_kk, 0.0);
 }
 
 bool CoverageDependentSurfPhase::addSpecies(shared_ptr<Species> spec)
@@ -465,12 +504,20 @@ void CoverageDependentSurfPhase::_updateCovDepThermo() const
         }
         getCoverages(m_cov.data());
 
-        // For linear and polynomial model
-        for (auto& item : m_PolynomialDependency) {
-            m_h_cov[item.k] += poly4(m_cov[item.j], item.enthalpy_coeffs.data());
-            m_s_cov[item.k] += poly4(m_cov[item.j], item.entropy_coeffs.data());
+        // Number of species when the dependency matrices were set up
+        Eigen::Index nsp = m_polyEnthalpy.rows();
+        ConstMappedVector theta(m_cov.data(), nsp);
+        MappedVector powers(m_covPowers.data(), 4 * nsp);
+        powers.head(nsp) = theta;
+        for (Eigen::Index p = 1; p < 4; p++) {
+            powers.segment(p * nsp, nsp) =
+                powers.segment((p - 1) * nsp, nsp).cwiseProduct(theta);
         }
 
+        // For linear and polynomial model
+        MappedVector(m_h_cov.data(), nsp) = m_polyEnthalpy * powers;
+        MappedVector(m_s_cov.data(), nsp) = m_polyEntropy * powers;
+
         // For piecewise-linear and interpolative model
         for (auto& item : m_InterpolativeDependency) {
             auto h_iter = item.enthalpy_map.upper_bound(m_cov[item.j]);
@@ -505,19 +552,24 @@ void CoverageDependentSurfPhase::_updateCovDepThermo() const
                 * (m_cov[item.j] - lowScov) + lowS;
         }
 
-        // For coverage-dependent heat capacity
-        for (auto& item : m_HeatCapacityDependency) {
-            double a = item.coeff_a;
-            double b = item.coeff_b;
-            m_cp_cov[item.k] += (a * log(tnow) + b) * m_cov[item.j] * m_cov[item.j];
-            double int_cp_tnow = tnow * (a * log(tnow) - a + b);
-            double int_cp_298 = 298.15 * (a * log(298.15) - a + b);
-            m_h_cov[item.k] += (int_cp_tnow - int_cp_298) * m_cov[item.j]
-                               * m_cov[item.j];
-            double int_cp_T_tnow = log(tnow) * (a * log(tnow) + 2 * b);
-            double int_cp_T_298 = log(298.15) * (a * log(298.15) + 2 * b);
-            m_s_cov[item.k] += 0.5 * (int_cp_T_tnow - int_cp_T_298) * m_cov[item.j]
-                               * m_cov[item.j];
+        // For coverage-dependent heat capacity, where the coefficient sums
+        // weighted by the squared coverages are multiplied by the temperature
+        // dependent terms
+        if (!m_HeatCapacityDependency.empty()) {
+            auto theta2 = powers.segment(nsp, nsp);
+            MappedVector cpA(m_cpCovA.data(), nsp);
+            MappedVector cpB(m_cpCovB.data(), nsp);
+            cpA = m_cpCoeffsA * theta2;
+            cpB = m_cpCoeffsB * theta2;
+            double logT = log(tnow);
+            double log298 = log(298.15);
+            double int_cp_a = tnow * (logT - 1.0) - 298.15 * (log298 - 1.0);
+            double int_cp_T_a = 0.5 * (logT * logT - log298 * log298);
+            for (Eigen::Index k = 0; k < nsp; k++) {
+                m_cp_cov[k] += cpA[k] * logT + cpB[k];
+                m_h_cov[k] += cpA[k] * int_cp_a + cpB[k] * (tnow - 298.15);
+                m_s_cov[k] += cpA[k] * int_cp_T_a + cpB[k] * (logT - log298);
+            }
         }
 
         for (size_t k = 0; k < m_kk; k++) {
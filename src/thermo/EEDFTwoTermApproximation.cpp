@@ -0,0 +1,342 @@
+//! @file EEDFTwoTermApproximation.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/thermo/EEDFTwoTermApproximation.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+namespace {
+
+//! Integral of @f$ \epsilon \sigma(\epsilon) @f$ from *a* to *b*, where
+//! @f$ \sigma @f$ is linearly interpolated between the data points and zero below
+//! *eMin*. Since the integrand is quadratic between data points, Simpson's rule
+//! is exact on each segment.
+double integrateEpsSigma(double a, double b, double eMin,
+                         const vector<double>& levels, const vector<double>& sigma)
+{
+    a = std::max(a, eMin);
+    if (b <= a) {
+        return 0.0;
+    }
+    auto f = [&](double e) { return e * linearInterp(e, levels, sigma); };
+    double integral = 0.0;
+    double lower = a;
+    auto iter = std::upper_bound(levels.begin(), levels.end(), a);
+    while (lower < b) {
+        double upper = (iter != levels.end() && *iter < b) ? *iter++ : b;
+        integral += (upper - lower) / 6.0
+            * (f(lower) + 4.0 * f(0.5 * (lower + upper)) + f(upper));
+        lower = upper;
+    }
+    return integral;
+}
+
+}
+
+void EEDFTwoTermApproximation::addCollision(size_t target, const string& kind,
+    double massRatio, double threshold, const vector<double>& energyLevels,
+    const vector<double>& crossSections)
+{
+    if (kind != "elastic" && kind != "excitation" && kind != "ionization"
+        && kind != "attachment")
+    {
+        throw CanteraError("EEDFTwoTermApproximation::addCollision",
+            "Unknown collision type '{}'.", kind);
+    }
+    if (energyLevels.empty() || energyLevels.size() != crossSections.size()) {
+        throw CanteraError("EEDFTwoTermApproximation::addCollision",
+            "Energy levels and cross sections need to be non-empty and of equal "
+            "length; got {} and {} values.", energyLevels.size(),
+            crossSections.size());
+    }
+    m_collisions.push_back(
+        {target, kind, massRatio, threshold, energyLevels, crossSections});
+    resetGrid();
+}
+
+void EEDFTwoTermApproximation::clearCollisions()
+{
+    m_collisions.clear();
+    resetGrid();
+}
+
+void EEDFTwoTermApproximation::resetGrid()
+{
+    // Force re-evaluation of the grid contributions and discard distributions
+    // obtained for the previous collision processes
+    m_levels.resize(0);
+    m_tableState.clear();
+    m_table.clear();
+    m_current.resize(0);
+}
+
+void EEDFTwoTermApproximation::setupGrid(const Eigen::ArrayXd& levels)
+{
+    Eigen::Index n = levels.size();
+    m_levels = levels;
+    m_bounds.resize(n + 1);
+    m_bounds[0] = levels[0];
+    m_bounds.segment(1, n - 1) = 0.5 * (levels.head(n - 1) + levels.tail(n - 1));
+    m_bounds[n] = levels[n - 1];
+    m_normWeights = 2.0 / 3.0 * (m_bounds.tail(n).pow(1.5)
+                                 - m_bounds.head(n).pow(1.5)).matrix();
+
+    m_targets.clear();
+    for (const auto& c : m_collisions) {
+        if (std::find(m_targets.begin(), m_targets.end(), c.target)
+            == m_targets.end())
+        {
+            m_targets.push_back(c.target);
+        }
+    }
+    size_t nTargets = m_targets.size();
+    m_sigmaEps.assign(nTargets, Eigen::ArrayXd::Zero(n + 1));
+    m_sigmaM.assign(nTargets, Eigen::ArrayXd::Zero(n + 1));
+    vector<SparseTriplets> triplets(nTargets);
+
+    for (const auto& c : m_collisions) {
+        size_t j = std::find(m_targets.begin(), m_targets.end(), c.target)
+                   - m_targets.begin();
+        bool elastic = (c.kind == "elastic");
+        double eMin = elastic ? -1.0 : c.threshold;
+        for (Eigen::Index i = 0; i <= n; i++) {
+            double sigma = (m_bounds[i] < eMin) ? 0.0 :
+                linearInterp(m_bounds[i], c.energyLevels, c.crossSections);
+            m_sigmaM[j][i] += sigma;
+            if (elastic) {
+                m_sigmaEps[j][i] += 2.0 * c.massRatio * sigma;
+            }
+        }
+        if (elastic) {
+            continue;
+        }
+
+        // Electrons are removed from each cell at the rate of the collision process
+        for (Eigen::Index i = 0; i < n; i++) {
+            double loss = integrateEpsSigma(m_bounds[i], m_bounds[i + 1], eMin,
+                                            c.energyLevels, c.crossSections);
+            if (loss != 0.0) {
+                triplets[j].emplace_back(i, i, loss);
+            }
+        }
+        if (c.kind == "attachment") {
+            continue;
+        }
+
+        // Electrons scattered from energy e + u are added to the cell containing e.
+        // For the shifted cell [b_i + u, b_{i+1} + u], contributions from all
+        // overlapping cells m are evaluated.
+        Eigen::Index m = 0;
+        for (Eigen::Index i = 0; i < n; i++) {
+            double lower = m_bounds[i] + c.threshold;
+            double upper = m_bounds[i + 1] + c.threshold;
+            while (m < n && m_bounds[m + 1] <= lower) {
+                m++;
+            }
+            for (Eigen::Index k = m; k < n && m_bounds[k] < upper; k++) {
+                double gain = integrateEpsSigma(
+                    std::max(lower, m_bounds[k]), std::min(upper, m_bounds[k + 1]),
+                    eMin, c.energyLevels, c.crossSections);
+                if (gain != 0.0) {
+                    triplets[j].emplace_back(i, k, -gain);
+                }
+            }
+        }
+    }
+
+    m_inelastic.resize(nTargets);
+    for (size_t j = 0; j < nTargets; j++) {
+        m_inelastic[j].resize(n, n);
+        m_inelastic[j].setFromTriplets(triplets[j].begin(), triplets[j].end());
+    }
+    m_table.clear();
+    m_tableState.clear();
+    m_current.resize(0);
+}
+
+bool EEDFTwoTermApproximation::solve(const Eigen::ArrayXd& levels, double EN,
+                                     double T, const double* x,
+                                     Eigen::ArrayXd& distribution)
+{
+    if (m_collisions.empty()) {
+        throw CanteraError("EEDFTwoTermApproximation::solve",
+            "No collision processes have been specified.");
+    }
+    if (EN < 0.0 || T < 0.0 || (EN == 0.0 && T == 0.0)) {
+        throw CanteraError("EEDFTwoTermApproximation::solve",
+            "Invalid reduced electric field ({} V m^2) or temperature ({} K).",
+            EN, T);
+    }
+    Eigen::Index n = levels.size();
+    if (n < 2) {
+        throw CanteraError("EEDFTwoTermApproximation::solve",
+            "At least two energy levels are required.");
+    }
+    if (m_levels.size() != n || (m_levels != levels).any()) {
+        setupGrid(levels);
+    }
+
+    vector<double> state(m_targets.size() + 1);
+    state[0] = T;
+    for (size_t j = 0; j < m_targets.size(); j++) {
+        state[j + 1] = x[m_targets[j]];
+    }
+    if (m_pointsPerDecade && EN > 0.0) {
+        // Tabulated distributions remain valid as long as temperature and
+        // composition are within the tolerance of the state used to calculate them
+        bool valid = !m_tableState.empty();
+        if (valid) {
+            valid = std::abs(T - m_tableState[0]) <= m_tableRtol * m_tableState[0];
+            for (size_t j = 1; valid && j < state.size(); j++) {
+                valid = std::abs(state[j] - m_tableState[j]) <= m_tableRtol;
+            }
+        }
+        if (!valid) {
+            m_table.clear();
+            m_tableState = state;
+        }
+        state = m_tableState;
+    }
+    if (m_current.size() == n && EN == m_currentField && state == m_currentState) {
+        distribution = m_current.array();
+        return false;
+    }
+    m_currentField = EN;
+    m_currentState = state;
+
+    if (!m_pointsPerDecade || EN == 0.0) {
+        m_current = computeDistribution(EN, state);
+    } else {
+        double u = std::log10(EN) * m_pointsPerDecade;
+        double k = std::floor(u);
+        double w = u - k;
+        if (w < 1e-10 || w > 1.0 - 1e-10) {
+            // Requested field coincides with a grid point
+            m_current = tabulated(static_cast<long>(std::round(u)));
+        } else {
+            const auto& F0 = tabulated(static_cast<long>(k));
+            const auto& F1 = tabulated(static_cast<long>(k) + 1);
+            m_current = (F0.array().pow(1.0 - w) * F1.array().pow(w)).matrix();
+            double norm = m_normWeights.dot(m_current);
+            if (norm > 0.0) {
+                m_current /= norm;
+            }
+        }
+    }
+    distribution = m_current.array();
+    return true;
+}
+
+void EEDFTwoTermApproximation::setTabulation(size_t pointsPerDecade, double rtol)
+{
+    if (rtol < 0.0) {
+        throw CanteraError("EEDFTwoTermApproximation::setTabulation",
+            "Tolerance must not be negative; got {}.", rtol);
+    }
+    m_pointsPerDecade = pointsPerDecade;
+    m_tableRtol = rtol;
+    m_tableState.clear();
+    m_table.clear();
+    m_current.resize(0);
+}
+
+const Eigen::VectorXd& EEDFTwoTermApproximation::tabulated(long k)
+{
+    auto cached = m_table.find(k);
+    if (cached != m_table.end()) {
+        return cached->second;
+    }
+    double EN = std::pow(10.0, static_cast<double>(k) / m_pointsPerDecade);
+    return m_table[k] = computeDistribution(EN, m_tableState);
+}
+
+Eigen::VectorXd EEDFTwoTermApproximation::computeDistribution(
+    double EN, const vector<double>& state)
+{
+    Eigen::Index n = m_levels.size();
+    double T = state[0];
+    Eigen::ArrayXd sigmaEps = Eigen::ArrayXd::Zero(n + 1);
+    Eigen::ArrayXd sigmaM = Eigen::ArrayXd::Zero(n + 1);
+    for (size_t j = 0; j < m_targets.size(); j++) {
+        sigmaEps += state[j + 1] * m_sigmaEps[j];
+        sigmaM += state[j + 1] * m_sigmaM[j];
+    }
+    sigmaM = sigmaM.max(1e-30);
+    Eigen::ArrayXd W = -m_bounds.square() * sigmaEps;
+    Eigen::ArrayXd D = EN * EN / 3.0 * m_bounds / sigmaM
+        + Boltzmann * T / ElectronCharge * m_bounds.square() * sigmaEps;
+
+    // Flux through the interior cell boundaries, using the Scharfetter-Gummel
+    // scheme: flux(b_i) = a0[i] * F[i-1] + a1[i] * F[i]
+    Eigen::ArrayXd a0 = Eigen::ArrayXd::Zero(n + 1);
+    Eigen::ArrayXd a1 = Eigen::ArrayXd::Zero(n + 1);
+    for (Eigen::Index i = 1; i < n; i++) {
+        double delta = m_levels[i] - m_levels[i - 1];
+        if (D[i] <= 0.0) {
+            a0[i] = std::max(W[i], 0.0);
+            a1[i] = std::min(W[i], 0.0);
+            continue;
+        }
+        double z = W[i] * delta / D[i];
+        if (std::abs(z) < 1e-8) {
+            a0[i] = D[i] / delta + 0.5 * W[i];
+            a1[i] = -D[i] / delta + 0.5 * W[i];
+        } else {
+            a0[i] = W[i] / -std::expm1(-z);
+            a1[i] = W[i] / -std::expm1(z);
+        }
+    }
+
+    // Balance of each cell, where the last equation is replaced by the
+    // normalization condition
+    SparseTriplets triplets;
+    triplets.reserve(4 * n);
+    for (Eigen::Index i = 0; i < n - 1; i++) {
+        triplets.emplace_back(i, i, a0[i + 1] - a1[i]);
+        triplets.emplace_back(i, i + 1, a1[i + 1]);
+        if (i > 0) {
+            triplets.emplace_back(i, i - 1, -a0[i]);
+        }
+    }
+    for (size_t j = 0; j < m_targets.size(); j++) {
+        for (int k = 0; k < m_inelastic[j].outerSize(); k++) {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(m_inelastic[j], k);
+                 it; ++it)
+            {
+                if (it.row() != n - 1) {
+                    triplets.emplace_back(it.row(), it.col(),
+                                          state[j + 1] * it.value());
+                }
+            }
+        }
+    }
+    for (Eigen::Index i = 0; i < n; i++) {
+        triplets.emplace_back(n - 1, i, m_normWeights[i]);
+    }
+    Eigen::SparseMatrix<double> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    A.makeCompressed();
+    Eigen::VectorXd rhs = Eigen::VectorXd::Zero(n);
+    rhs[n - 1] = 1.0;
+
+    m_solver.compute(A);
+    if (m_solver.info() != Eigen::Success) {
+        throw CanteraError("EEDFTwoTermApproximation::solve",
+            "Factorization of the Boltzmann equation failed: {}",
+            m_solver.lastErrorMessage());
+    }
+    Eigen::VectorXd F = m_solver.solve(rhs);
+    if (m_solver.info() != Eigen::Success || !F.allFinite()) {
+        throw CanteraError("EEDFTwoTermApproximation::solve",
+            "Solution of the Boltzmann equation failed.");
+    }
+    // Remove round-off errors in the exponentially decaying tail
+    return F.cwiseMax(0.0);
+}
+
+}
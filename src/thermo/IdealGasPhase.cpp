@@ -10,6 +10,7 @@
 
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/speciesThermoTypes.h"
 #include "cantera/base/utilities.h"
 
 namespace Cantera
@@ -264,6 +265,135 @@ void IdealGasPhase::setToEquilState(const double* mu_RT)
     setPressure(pres);
 }
 
+void IdealGasPhase::invalidateCache()
+{
+    ThermoPhase::invalidateCache();
+    m_nasaTableValid = false;
+}
+
+void IdealGasPhase::setState_HP(double h, double p, double tol)
+{
+    double T;
+    if (p >= 1.0E-300 && solveMixturePoly(h, tol, false, T)) {
+        setState_TP(T, p);
+    } else {
+        ThermoPhase::setState_HP(h, p, tol);
+    }
+}
+
+void IdealGasPhase::setState_UV(double u, double v, double tol)
+{
+    double T;
+    if (v >= 1.0E-300 && solveMixturePoly(u, tol, true, T)) {
+        setDensity(1.0 / v);
+        setTemperature(T);
+    } else {
+        ThermoPhase::setState_UV(u, v, tol);
+    }
+}
+
+bool IdealGasPhase::solveMixturePoly(double h, double tol, bool doUV,
+                                     double& T) const
+{
+    // Derived classes such as PlasmaPhase modify the mixture enthalpy
+    if (type() != "ideal-gas" || m_kk == 0 || std::isnan(h)) {
+        return false;
+    }
+    if (!m_nasaTableValid) {
+        updateNasaTable();
+    }
+    if (!m_nasaTableUsable) {
+        return false;
+    }
+
+    double Tmin = minTemp();
+    double Tmax = maxTemp();
+    const double* y = massFractions();
+    const vector<double>& rmw = inverseMolecularWeights();
+    double hTarget = h / GasConstant;
+
+    // Coefficients of the mixture polynomial for the current temperature
+    // interval, in units of R per kg
+    double c[7];
+    size_t interval = npos;
+    T = clip(temperature(), Tmin, Tmax);
+    for (int n = 0; n < 100; n++) {
+        size_t i = std::lower_bound(m_nasaMidT.begin(), m_nasaMidT.end(), T)
+                   - m_nasaMidT.begin();
+        if (i != interval) {
+            interval = i;
+            std::fill(c, c + 7, 0.0);
+            for (size_t k = 0; k < m_kk; k++) {
+                double w = y[k] * rmw[k];
+                if (w != 0.0) {
+                    const double* a = &m_nasaCoeffs(7*i, k);
+                    for (size_t j = 0; j < 7; j++) {
+                        c[j] += w * a[j];
+                    }
+                }
+            }
+            if (doUV) {
+                // u = h - RT/W and c_v = c_p - R/W
+                c[0] -= 1.0 / meanMolecularWeight();
+            }
+        }
+        double cp = c[0] + T * (c[1] + T * (c[2] + T * (c[3] + T * c[4])));
+        double hNow = T * (c[0] + T * (c[1] / 2 + T * (c[2] / 3
+                      + T * (c[3] / 4 + T * c[4] / 5)))) + c[5];
+        if (cp <= 0.0) {
+            return false;
+        }
+        // limit step size to 100 K, as in ThermoPhase::setState_HPorUV
+        double dT = clip((hTarget - hNow) / cp, -100.0, 100.0);
+        T += dT;
+        if (T <= 0.0) {
+            return false;
+        }
+        if (std::abs(dT) < tol * T) {
+            return T >= Tmin && T <= Tmax;
+        }
+    }
+    return false;
+}
+
+void IdealGasPhase::updateNasaTable() const
+{
+    m_nasaTableValid = true;
+    m_nasaTableUsable = false;
+    m_nasaMidT.clear();
+    for (size_t k = 0; k < m_kk; k++) {
+        if (m_spthermo.reportType(k) != NASA2) {
+            return;
+        }
+    }
+
+    // NasaPoly2 reports the midpoint temperature followed by the coefficients
+    // for the high and low temperature ranges
+    Array2D params(15, m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        int type;
+        double tlow, thigh, pref;
+        m_spthermo.reportParams(k, type, params.ptrColumn(k), tlow, thigh, pref);
+        m_nasaMidT.push_back(params(0, k));
+    }
+    std::sort(m_nasaMidT.begin(), m_nasaMidT.end());
+    m_nasaMidT.erase(std::unique(m_nasaMidT.begin(), m_nasaMidT.end()),
+                     m_nasaMidT.end());
+
+    // Interval i covers temperatures up to and including m_nasaMidT[i]. Species
+    // use their low-temperature coefficients for T <= Tmid.
+    size_t nIntervals = m_nasaMidT.size() + 1;
+    m_nasaCoeffs.resize(7 * nIntervals, m_kk);
+    for (size_t k = 0; k < m_kk; k++) {
+        for (size_t i = 0; i < nIntervals; i++) {
+            bool low = (i < m_nasaMidT.size() && m_nasaMidT[i] <= params(0, k));
+            const double* a = params.ptrColumn(k) + (low ? 8 : 1);
+            std::copy(a, a + 7, &m_nasaCoeffs(7*i, k));
+        }
+    }
+    m_nasaTableUsable = true;
+}
+
 void IdealGasPhase::updateThermo() const
 {
     static const int cacheId = m_cache.getId();
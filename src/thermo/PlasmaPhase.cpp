@@ -7,6 +7,10 @@
 #include <boost/math/special_functions/gamma.hpp>
 #include "cantera/thermo/Species.h"
 #include "cantera/base/global.h"
+#include "cantera/base/Solution.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/ElectronCollisionPlasmaRate.h"
 #include "cantera/numerics/funcs.h"
 
 namespace Cantera {
@@ -22,6 +26,13 @@ PlasmaPhase::PlasmaPhase(const string& inputFile, const string& id_)
     setElectronTemperature(temperature());
 }
 
+PlasmaPhase::~PlasmaPhase()
+{
+    if (shared_ptr<Solution> soln = m_soln.lock()) {
+        soln->removeChangedCallback(this);
+    }
+}
+
 void PlasmaPhase::updateElectronEnergyDistribution()
 {
     if (m_distributionType == "discretized") {
@@ -29,10 +40,30 @@ void PlasmaPhase::updateElectronEnergyDistribution()
             "Invalid for discretized electron energy distribution.");
     } else if (m_distributionType == "isotropic") {
         setIsotropicElectronEnergyDistribution();
+    } else if (m_distributionType == "Boltzmann-two-term") {
+        setCollisions();
+        if (!m_eedfSolver.nCollisions()) {
+            throw CanteraError("PlasmaPhase::updateElectronEnergyDistribution",
+                "The Boltzmann-two-term electron energy distribution requires a "
+                "kinetics manager with electron-collision-plasma reactions.");
+        }
+        // The distribution is calculated when it is next used
+        m_eedfStale = true;
+        return;
     }
     electronEnergyDistributionChanged();
 }
 
+void PlasmaPhase::updateStaleElectronEnergyDistribution() const
+{
+    // The distribution is a cached function of the state of the phase, which is
+    // only calculated once it is used after a state change
+    auto& phase = const_cast<PlasmaPhase&>(*this);
+    if (phase.setTwoTermElectronEnergyDistribution()) {
+        phase.electronEnergyDistributionChanged();
+    }
+}
+
 void PlasmaPhase::normalizeElectronEnergyDistribution() {
     Eigen::ArrayXd eps32 = m_electronEnergyLevels.pow(3./2.);
     double norm = 2./3. * numericalQuadrature(m_quadratureMethod,
@@ -48,14 +79,24 @@ void PlasmaPhase::normalizeElectronEnergyDistribution() {
 void PlasmaPhase::setElectronEnergyDistributionType(const string& type)
 {
     if (type == "discretized" ||
-        type == "isotropic") {
+        type == "isotropic" ||
+        type == "Boltzmann-two-term") {
         m_distributionType = type;
+        m_eedfStale = type == "Boltzmann-two-term" && m_eedfSolver.nCollisions();
     } else {
         throw CanteraError("PlasmaPhase::setElectronEnergyDistributionType",
             "Unknown type for electron energy distribution.");
     }
 }
 
+void PlasmaPhase::setElectronEnergyDistributionTabulation(size_t pointsPerDecade,
+                                                          double rtol)
+{
+    m_eedfSolver.setTabulation(pointsPerDecade, rtol);
+    m_eedfStale = m_distributionType == "Boltzmann-two-term"
+                  && m_eedfSolver.nCollisions();
+}
+
 void PlasmaPhase::setIsotropicElectronEnergyDistribution()
 {
     m_electronEnergyDist.resize(m_nPoints);
@@ -72,6 +113,102 @@ void PlasmaPhase::setIsotropicElectronEnergyDistribution()
     checkElectronEnergyDistribution();
 }
 
+bool PlasmaPhase::setTwoTermElectronEnergyDistribution()
+{
+    // Pick up reactions that were added or modified since the collision processes
+    // were last updated
+    setCollisions();
+    vector<double> x(m_kk);
+    getMoleFractions(x.data());
+    bool changed = m_eedfSolver.solve(m_electronEnergyLevels, m_reducedElectricField,
+                                      temperature(), x.data(), m_electronEnergyDist);
+    m_eedfStale = false;
+    if (!changed) {
+        return false;
+    }
+    if (m_do_normalizeElectronEnergyDist) {
+        normalizeElectronEnergyDistribution();
+    }
+    checkElectronEnergyDistribution();
+    updateElectronTemperatureFromEnergyDist();
+    return true;
+}
+
+void PlasmaPhase::setReducedElectricField(double EN)
+{
+    if (EN < 0.0) {
+        throw CanteraError("PlasmaPhase::setReducedElectricField",
+            "The reduced electric field cannot be negative; got {} V m^2.", EN);
+    }
+    m_reducedElectricField = EN;
+    if (m_distributionType == "Boltzmann-two-term") {
+        updateElectronEnergyDistribution();
+    }
+}
+
+void PlasmaPhase::setCollisions()
+{
+    vector<EEDFTwoTermApproximation::Collision> collisions;
+    shared_ptr<Solution> soln = m_soln.lock();
+    if (soln && soln->thermo().get() == this && soln->kinetics()) {
+        Kinetics& kin = *soln->kinetics();
+        const string& electron = electronSpeciesName();
+        for (size_t i = 0; i < kin.nReactions(); i++) {
+            auto rxn = kin.reaction(i);
+            auto rate = std::dynamic_pointer_cast<ElectronCollisionPlasmaRate>(
+                rxn->rate());
+            if (!rate || rate->energyLevels().empty()) {
+                continue;
+            }
+            size_t target = npos;
+            for (const auto& [name, stoich] : rxn->reactants) {
+                if (name != electron) {
+                    target = speciesIndex(name);
+                }
+            }
+            if (target == npos) {
+                continue;
+            }
+            auto iter = rxn->products.find(electron);
+            double nElectrons = (iter == rxn->products.end()) ? 0.0 : iter->second;
+            string kind;
+            if (nElectrons == 0.0) {
+                kind = "attachment";
+            } else if (nElectrons == 1.0) {
+                kind = (rxn->products == rxn->reactants) ? "elastic" : "excitation";
+            } else {
+                kind = "ionization";
+            }
+            collisions.push_back({target, kind,
+                ElectronMass * Avogadro / molecularWeight(target),
+                rate->energyLevels()[0], rate->energyLevels(), rate->crossSections()});
+        }
+    }
+    if (collisions == m_eedfSolver.collisions()) {
+        return;
+    }
+    m_eedfSolver.clearCollisions();
+    for (const auto& c : collisions) {
+        m_eedfSolver.addCollision(c.target, c.kind, c.massRatio, c.threshold,
+                                  c.energyLevels, c.crossSections);
+    }
+    // Without collision processes, the distribution cannot be updated
+    m_eedfStale = m_distributionType == "Boltzmann-two-term"
+                  && m_eedfSolver.nCollisions();
+}
+
+void PlasmaPhase::setSolution(std::weak_ptr<Solution> soln)
+{
+    if (shared_ptr<Solution> current = m_soln.lock()) {
+        current->removeChangedCallback(this);
+    }
+    ThermoPhase::setSolution(soln);
+    // Update the collision processes whenever the kinetics manager is replaced
+    if (shared_ptr<Solution> root = m_soln.lock()) {
+        root->registerChangedCallback(this, [this]() { setCollisions(); });
+    }
+}
+
 void PlasmaPhase::setElectronTemperature(const double Te) {
     m_electronTemp = Te;
     updateElectronEnergyDistribution();
@@ -195,6 +332,9 @@ void PlasmaPhase::getParameters(AnyMap& phaseNode) const
         Eigen::Map<Eigen::ArrayXd>(dist.data(), m_nPoints) = m_electronEnergyDist;
         eedf["distribution"] = dist;
         eedf["normalize"] = m_do_normalizeElectronEnergyDist;
+    } else if (m_distributionType == "Boltzmann-two-term") {
+        eedf["reduced-electric-field"].setQuantity(m_reducedElectricField, "V*m^2");
+        eedf["normalize"] = m_do_normalizeElectronEnergyDist;
     }
     phaseNode["electron-energy-distribution"] = std::move(eedf);
 }
@@ -239,6 +379,28 @@ void PlasmaPhase::setParameters(const AnyMap& phaseNode, const AnyMap& rootNode)
             setDiscretizedElectronEnergyDist(eedf["energy-levels"].asVector<double>().data(),
                                              eedf["distribution"].asVector<double>().data(),
                                              eedf["energy-levels"].asVector<double>().size());
+        } else if (m_distributionType == "Boltzmann-two-term") {
+            // The distribution is calculated once the collision processes are
+            // available from the kinetics manager
+            if (eedf.hasKey("reduced-electric-field")) {
+                m_reducedElectricField = eedf.convert("reduced-electric-field",
+                                                      "V*m^2");
+            }
+            if (eedf.hasKey("normalize")) {
+                enableNormalizeElectronEnergyDist(eedf["normalize"].asBool());
+            }
+            if (eedf.hasKey("energy-levels")) {
+                const auto& levels = eedf["energy-levels"].asVector<double>();
+                m_nPoints = levels.size();
+                m_electronEnergyLevels = Eigen::Map<const Eigen::ArrayXd>(
+                    levels.data(), levels.size());
+                checkElectronEnergyLevels();
+                electronEnergyLevelChanged();
+            }
+        } else {
+            throw InputFileError("PlasmaPhase::setParameters", eedf["type"],
+                "Unknown electron energy distribution type '{}'.",
+                m_distributionType);
         }
     }
 }
@@ -272,6 +434,22 @@ void PlasmaPhase::initThermo()
     }
 }
 
+void PlasmaPhase::setTemperature(double temp)
+{
+    IdealGasPhase::setTemperature(temp);
+    if (m_distributionType == "Boltzmann-two-term" && m_eedfSolver.nCollisions()) {
+        m_eedfStale = true;
+    }
+}
+
+void PlasmaPhase::compositionChanged()
+{
+    IdealGasPhase::compositionChanged();
+    if (m_distributionType == "Boltzmann-two-term" && m_eedfSolver.nCollisions()) {
+        m_eedfStale = true;
+    }
+}
+
 void PlasmaPhase::updateThermo() const
 {
     IdealGasPhase::updateThermo();
@@ -182,12 +182,13 @@ void addElements(ThermoPhase& thermo, const vector<string>& element_names,
 
 void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& species)
 {
+    vector<const AnyMap*> nodes;
     if (names.is<vector<string>>()) {
         // 'names' is a list of species names which should be found in 'species'
         const auto& species_nodes = species.asMap("name");
         for (const auto& name : names.asVector<string>()) {
             if (species_nodes.count(name)) {
-                thermo.addSpecies(newSpecies(*species_nodes.at(name)));
+                nodes.push_back(species_nodes.at(name));
             } else {
                 throw InputFileError("addSpecies", names, species,
                     "Could not find a species named '{}'.", name);
@@ -196,12 +197,19 @@ void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& spec
     } else if (names == "all") {
         // The keyword 'all' means to add all species from this source
         for (const auto& item : species.asVector<AnyMap>()) {
-            thermo.addSpecies(newSpecies(item));
+            nodes.push_back(&item);
         }
     } else {
         throw InputFileError("addSpecies", names,
             "Could not parse species declaration of type '{}'", names.type_str());
     }
+
+    // Species objects are constructed concurrently and added in order
+    vector<shared_ptr<Species>> spec(nodes.size());
+    parallelFor(nodes.size(), [&](size_t i) { spec[i] = newSpecies(*nodes[i]); }, 200);
+    for (auto& sp : spec) {
+        thermo.addSpecies(sp);
+    }
 }
 
 void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& rootNode)
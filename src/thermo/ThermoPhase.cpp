@@ -1173,9 +1173,13 @@ void ThermoPhase::equilibrate(const string& XY, const string& solver,
         saveState(initial_state);
         debuglog("Trying ChemEquil solver\n", log_level);
         try {
-            ChemEquil E;
+            if (!m_chemEquil) {
+                m_chemEquil = make_shared<ChemEquil>();
+            }
+            ChemEquil& E = *m_chemEquil;
             E.options.maxIterations = max_steps;
             E.options.relTolerance = rtol;
+            E.setReuseTolerance(m_equilReuseTol);
             int ret = E.equilibrate(*this, XY.c_str(), log_level-1);
             if (ret < 0) {
                 throw CanteraError("ThermoPhase::equilibrate",
@@ -1209,6 +1213,11 @@ void ThermoPhase::equilibrate(const string& XY, const string& solver,
     }
 }
 
+void ThermoPhase::setEquilibriumReuseTolerance(double tol)
+{
+    m_equilReuseTol = tol;
+}
+
 void ThermoPhase::getdlnActCoeffdlnN(const size_t ld, double* const dlnActCoeffdlnN)
 {
     for (size_t m = 0; m < m_kk; m++) {
@@ -0,0 +1,131 @@
+//! @file AdjointSensitivity.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/AdjointSensitivity.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+namespace Cantera
+{
+
+AdjointSensitivity::AdjointSensitivity(ReactorNet& net)
+    : m_net(net)
+{
+}
+
+void AdjointSensitivity::setCheckpointInterval(size_t nsteps)
+{
+    if (nsteps == 0) {
+        throw CanteraError("AdjointSensitivity::setCheckpointInterval",
+                           "Checkpoint interval must be positive.");
+    }
+    m_interval = nsteps;
+}
+
+void AdjointSensitivity::integrate(double tf)
+{
+    bool forward = m_net.forwardSensitivities();
+    m_net.setForwardSensitivities(false);
+    m_net.setAdjointCheckpointInterval(static_cast<int>(m_interval));
+    m_net.initialize();
+    double t0 = m_net.time();
+    if (tf <= t0) {
+        m_net.setForwardSensitivities(forward);
+        m_net.setAdjointCheckpointInterval(0);
+        throw CanteraError("AdjointSensitivity::integrate", "Final time ({}) must "
+                           "be greater than the current time ({})", tf, t0);
+    }
+    m_net.advance(tf);
+    m_t0 = t0;
+    m_tf = m_net.time();
+    m_yFinal.resize(m_net.neq());
+    m_net.getState(m_yFinal.data());
+    m_forwardStats = m_net.solverStats();
+    m_backwardStats.clear();
+
+    // Restoring the settings only takes effect once the network is advanced
+    // further, so the checkpoints remain available to solve()
+    m_net.setForwardSensitivities(forward);
+    m_net.setAdjointCheckpointInterval(0);
+}
+
+vector<double> AdjointSensitivity::solve(const vector<double>& dgdy)
+{
+    if (m_yFinal.empty()) {
+        throw CanteraError("AdjointSensitivity::solve",
+                           "Forward pass has not been performed.");
+    }
+    if (m_net.time() != m_tf) {
+        throw CanteraError("AdjointSensitivity::solve", "The reactor network has "
+            "been advanced since the forward pass.");
+    }
+    size_t nv = m_yFinal.size();
+    if (dgdy.size() != nv) {
+        throw CanteraError("AdjointSensitivity::solve", "Size of the objective "
+            "gradient ({}) does not match the size of the state vector ({})",
+            dgdy.size(), nv);
+    }
+    vector<double> sens(m_net.m_sens_params.size());
+    try {
+        m_net.solveAdjoint(dgdy.data(), sens.data());
+    } catch (CanteraError&) {
+        restoreFinalState();
+        throw;
+    }
+    m_backwardStats = m_net.solverStats();
+    restoreFinalState();
+    return sens;
+}
+
+vector<double> AdjointSensitivity::sensitivities(const string& component, int reactor)
+{
+    size_t k = m_net.globalComponentIndex(component, reactor);
+    vector<double> dgdy(m_net.neq(), 0.0);
+    dgdy[k] = 1.0;
+    vector<double> sens = solve(dgdy);
+    double denom = m_yFinal[k];
+    if (denom == 0.0) {
+        denom = SmallNumber;
+    }
+    for (auto& s : sens) {
+        s /= denom;
+    }
+    return sens;
+}
+
+vector<double> AdjointSensitivity::eventTimeSensitivities(const string& component,
+                                                          int reactor)
+{
+    size_t k = m_net.globalComponentIndex(component, reactor);
+    vector<double> dgdy(m_net.neq(), 0.0);
+    dgdy[k] = 1.0;
+    vector<double> sens = solve(dgdy);
+    vector<double> ydot(m_net.neq());
+    vector<double> params = m_net.m_sens_params;
+    m_work = m_yFinal;
+    m_net.eval(m_tf, m_work.data(), ydot.data(), params.data());
+    restoreFinalState();
+    double factor = -1.0 / (ydot[k] * (m_tf - m_t0));
+    for (auto& s : sens) {
+        s *= factor;
+    }
+    return sens;
+}
+
+AnyMap AdjointSensitivity::stats() const
+{
+    AnyMap stats;
+    stats["checkpoints"] = m_forwardStats.getInt("adjoint_checkpoints", 0);
+    stats["forward_steps"] = m_forwardStats.getInt("steps", 0);
+    stats["backward_steps"] = m_backwardStats.getInt("adjoint_steps", 0);
+    return stats;
+}
+
+void AdjointSensitivity::restoreFinalState()
+{
+    m_work = m_yFinal;
+    m_net.updateState(m_work.data());
+}
+
+}
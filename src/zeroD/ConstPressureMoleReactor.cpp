@@ -107,6 +107,15 @@ void ConstPressureMoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool ConstPressureMoleReactor::getProductionRateAdjoint(const double* lambda,
+                                                        double* mu)
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k + m_sidx] * m_vol;
+    }
+    return true;
+}
+
 size_t ConstPressureMoleReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
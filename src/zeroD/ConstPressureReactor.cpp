@@ -118,6 +118,16 @@ void ConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool ConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                    double* mu)
+{
+    const vector<double>& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+2] * mw[k] * m_vol;
+    }
+    return true;
+}
+
 size_t ConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -119,6 +119,16 @@ void IdealGasConstPressureMoleReactor::eval(double time, double* LHS, double* RH
     }
 }
 
+bool IdealGasConstPressureMoleReactor::getProductionRateAdjoint(
+    const double* lambda, double* mu)
+{
+    double lambdaT = m_energy ? lambda[0] : 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k + m_sidx] - lambdaT * m_hk[k]) * m_vol;
+    }
+    return true;
+}
+
 Eigen::SparseMatrix<double> IdealGasConstPressureMoleReactor::jacobian()
 {
     if (m_nv == 0) {
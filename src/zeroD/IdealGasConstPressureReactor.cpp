@@ -130,6 +130,17 @@ void IdealGasConstPressureReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool IdealGasConstPressureReactor::getProductionRateAdjoint(const double* lambda,
+                                                            double* mu)
+{
+    const vector<double>& mw = m_thermo->molecularWeights();
+    double lambdaT = m_energy ? lambda[1] : 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k+2] * mw[k] - lambdaT * m_hk[k]) * m_vol;
+    }
+    return true;
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -153,6 +153,15 @@ void IdealGasMoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool IdealGasMoleReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    double lambdaT = m_energy ? lambda[0] : 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k + m_sidx] - lambdaT * m_uk[k]) * m_vol;
+    }
+    return true;
+}
+
 Eigen::SparseMatrix<double> IdealGasMoleReactor::jacobian()
 {
     if (m_nv == 0) {
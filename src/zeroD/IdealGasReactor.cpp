@@ -135,6 +135,16 @@ void IdealGasReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool IdealGasReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    const vector<double>& mw = m_thermo->molecularWeights();
+    double lambdaT = m_energy ? lambda[2] : 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k+3] * mw[k] - lambdaT * m_uk[k]) * m_vol;
+    }
+    return true;
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -0,0 +1,283 @@
+//! @file IsatTable.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/IsatTable.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/base/Array.h"
+#include "cantera/numerics/funcs.h"
+
+namespace Cantera
+{
+
+//! Tabulated mapping for a single initial state
+struct IsatTable::Record
+{
+    Eigen::VectorXd x0; //!< Initial state
+    Eigen::VectorXd z0; //!< Scaled initial state
+    Eigen::VectorXd r0; //!< Mapping of the initial state
+    Eigen::MatrixXd A; //!< Mapping gradient
+    Eigen::MatrixXd M; //!< EOA in scaled coordinates: z' M z <= 1
+    Node* leaf = nullptr; //!< Leaf of the binary tree holding this record
+    size_t lastUsed = 0; //!< Value of the table clock at the last retrieve
+};
+
+//! Node of the binary search tree. Leaves hold a record, while other nodes hold a
+//! cutting plane `v' z = a`, with states where `v' z > a` on the right.
+struct IsatTable::Node
+{
+    Record* record = nullptr;
+    Eigen::VectorXd v;
+    double a = 0.0;
+    unique_ptr<Node> left;
+    unique_ptr<Node> right;
+    Node* parent = nullptr;
+};
+
+IsatTable::IsatTable(ReactorNet& net)
+    : m_net(net)
+{
+}
+
+IsatTable::~IsatTable()
+{
+}
+
+void IsatTable::setTolerance(double tol)
+{
+    if (tol <= 0) {
+        throw CanteraError("IsatTable::setTolerance",
+                           "Tolerance must be positive; got {}", tol);
+    }
+    if (tol != m_tol) {
+        m_tol = tol;
+        clear();
+    }
+}
+
+void IsatTable::setMaxSize(size_t nmax)
+{
+    m_maxSize = std::max<size_t>(nmax, 1);
+    while (m_records.size() > m_maxSize) {
+        evict();
+    }
+}
+
+void IsatTable::setScales(const vector<double>& scales)
+{
+    clear();
+    m_wt.resize(scales.size());
+    for (size_t i = 0; i < scales.size(); i++) {
+        if (scales[i] <= 0) {
+            throw CanteraError("IsatTable::setScales",
+                               "Scale factor {} is not positive", i);
+        }
+        m_wt[i] = 1.0 / scales[i];
+    }
+    m_userScales = true;
+}
+
+void IsatTable::clear()
+{
+    m_root.reset();
+    m_records.clear();
+    if (!m_userScales) {
+        m_wt.resize(0);
+    }
+    m_clock = 0;
+    m_nQuery = m_nRetrieve = m_nGrow = m_nAdd = m_nDirect = m_nEvict = 0;
+}
+
+AnyMap IsatTable::stats() const
+{
+    AnyMap stats;
+    stats["queries"] = static_cast<long int>(m_nQuery);
+    stats["retrieves"] = static_cast<long int>(m_nRetrieve);
+    stats["grows"] = static_cast<long int>(m_nGrow);
+    stats["adds"] = static_cast<long int>(m_nAdd);
+    stats["direct_evals"] = static_cast<long int>(m_nDirect);
+    stats["evictions"] = static_cast<long int>(m_nEvict);
+    stats["size"] = static_cast<long int>(m_records.size());
+    return stats;
+}
+
+double IsatTable::advance(double dt)
+{
+    if (dt <= 0) {
+        throw CanteraError("IsatTable::advance",
+                           "Integration interval must be positive; got {}", dt);
+    }
+    if (m_net.neq() == 0) {
+        m_net.initialize();
+    }
+    size_t nv = m_net.neq();
+    if (dt != m_dt) {
+        clear();
+        m_dt = dt;
+    }
+    if (m_wt.size() == 0) {
+        vector<double> y(nv);
+        m_net.getState(y.data());
+        m_wt.resize(nv);
+        for (size_t i = 0; i < nv; i++) {
+            m_wt[i] = 1.0 / std::max(std::abs(y[i]), 1.0);
+        }
+    } else if (static_cast<size_t>(m_wt.size()) != nv) {
+        throw CanteraError("IsatTable::advance", "Size of the state vector ({}) "
+            "does not match the number of scale factors ({})", nv, m_wt.size());
+    }
+    m_nQuery++;
+    m_clock++;
+    double t0 = m_net.time();
+
+    Eigen::VectorXd x(nv);
+    m_net.getState(x.data());
+    Eigen::VectorXd z = m_wt.cwiseProduct(x);
+    Node* leaf = findLeaf(z);
+
+    if (leaf) {
+        Record& rec = *leaf->record;
+        Eigen::VectorXd dz = z - rec.z0;
+        if (dz.dot(rec.M * dz) <= 1.0) {
+            // Retrieve: linear approximation within the ellipsoid of accuracy
+            Eigen::VectorXd r = rec.r0 + rec.A * (x - rec.x0);
+            m_net.updateState(r.data());
+            m_net.setInitialTime(t0 + dt);
+            rec.lastUsed = m_clock;
+            m_nRetrieve++;
+            return t0 + dt;
+        }
+    }
+
+    Eigen::VectorXd r(nv);
+    integrate(r);
+    m_nDirect++;
+
+    if (leaf) {
+        Record& rec = *leaf->record;
+        Eigen::VectorXd err = m_wt.cwiseProduct(r - rec.r0 - rec.A * (x - rec.x0));
+        if (err.norm() <= m_tol) {
+            // Grow: minimal rank-one modification of the EOA that includes z
+            Eigen::VectorXd dz = z - rec.z0;
+            Eigen::VectorXd Mdz = rec.M * dz;
+            double rho = dz.dot(Mdz);
+            rec.M += (1.0 - rho) / (rho * rho) * Mdz * Mdz.transpose();
+            rec.lastUsed = m_clock;
+            m_nGrow++;
+            return t0 + dt;
+        }
+    }
+
+    if (m_records.size() >= m_maxSize) {
+        evict();
+        leaf = findLeaf(z);
+    }
+    addRecord(x, r, leaf);
+
+    // Restore the integrated state, which is modified when evaluating the gradient
+    m_net.updateState(r.data());
+    m_net.setInitialTime(t0 + dt);
+    return t0 + dt;
+}
+
+IsatTable::Node* IsatTable::findLeaf(const Eigen::VectorXd& z) const
+{
+    Node* node = m_root.get();
+    while (node && !node->record) {
+        node = (node->v.dot(z) > node->a) ? node->right.get() : node->left.get();
+    }
+    return node;
+}
+
+void IsatTable::integrate(Eigen::VectorXd& r)
+{
+    double t0 = m_net.time();
+    m_net.setInitialTime(t0);
+    m_net.advance(t0 + m_dt);
+    m_net.getState(r.data());
+}
+
+void IsatTable::addRecord(const Eigen::VectorXd& x, const Eigen::VectorXd& r,
+                          Node* leaf)
+{
+    size_t nv = x.size();
+    auto rec = make_unique<Record>();
+    rec->x0 = x;
+    rec->z0 = m_wt.cwiseProduct(x);
+    rec->r0 = r;
+    rec->lastUsed = m_clock;
+
+    // Mapping gradient from the Jacobian at the initial state
+    Array2D jac(nv, nv);
+    vector<double> y(x.data(), x.data() + nv);
+    vector<double> ydot(nv);
+    m_net.evalJacobian(m_net.time(), y.data(), ydot.data(),
+                       m_net.m_sens_params.data(), &jac);
+    rec->A = expm(MappedMatrix(jac.ptrColumn(0), nv, nv) * m_dt);
+
+    // Initial EOA, with singular values of the scaled gradient bounded from below
+    // to limit the extent of the ellipsoid in directions where the mapping is
+    // insensitive to the initial state.
+    Eigen::MatrixXd As = m_wt.asDiagonal() * rec->A * m_wt.cwiseInverse().asDiagonal();
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(As, Eigen::ComputeFullV);
+    Eigen::VectorXd sigma = svd.singularValues().cwiseMax(0.5) / m_tol;
+    rec->M = svd.matrixV() * sigma.cwiseAbs2().asDiagonal() * svd.matrixV().transpose();
+
+    auto node = make_unique<Node>();
+    node->record = rec.get();
+    rec->leaf = node.get();
+    if (!leaf) {
+        m_root = std::move(node);
+    } else {
+        // Replace the leaf with a cutting plane separating the two records
+        Record* other = leaf->record;
+        leaf->record = nullptr;
+        leaf->v = rec->z0 - other->z0;
+        leaf->a = 0.5 * leaf->v.dot(rec->z0 + other->z0);
+        leaf->left = make_unique<Node>();
+        leaf->left->record = other;
+        leaf->left->parent = leaf;
+        other->leaf = leaf->left.get();
+        node->parent = leaf;
+        leaf->right = std::move(node);
+    }
+    m_records.push_back(std::move(rec));
+    m_nAdd++;
+}
+
+void IsatTable::evict()
+{
+    if (m_records.empty()) {
+        return;
+    }
+    size_t iOld = 0;
+    for (size_t i = 1; i < m_records.size(); i++) {
+        if (m_records[i]->lastUsed < m_records[iOld]->lastUsed) {
+            iOld = i;
+        }
+    }
+    Node* leaf = m_records[iOld]->leaf;
+    Node* parent = leaf->parent;
+    if (!parent) {
+        m_root.reset();
+    } else {
+        // Replace the parent node by the sibling of the removed leaf
+        unique_ptr<Node> sibling = (parent->left.get() == leaf) ?
+            std::move(parent->right) : std::move(parent->left);
+        Node* grandparent = parent->parent;
+        sibling->parent = grandparent;
+        if (!grandparent) {
+            m_root = std::move(sibling);
+        } else if (grandparent->left.get() == parent) {
+            grandparent->left = std::move(sibling);
+        } else {
+            grandparent->right = std::move(sibling);
+        }
+    }
+    std::swap(m_records[iOld], m_records.back());
+    m_records.pop_back();
+    m_nEvict++;
+}
+
+}
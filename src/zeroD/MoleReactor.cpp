@@ -280,6 +280,14 @@ void MoleReactor::eval(double time, double* LHS, double* RHS)
     }
 }
 
+bool MoleReactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k + m_sidx] * m_vol;
+    }
+    return true;
+}
+
 
 size_t MoleReactor::componentIndex(const string& nm) const
 {
@@ -13,6 +13,7 @@
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/base/Solution.h"
 #include "cantera/base/utilities.h"
+#include "cantera/numerics/eigen_dense.h"
 
 #include <boost/math/tools/roots.hpp>
 
@@ -540,6 +541,43 @@ void Reactor::resetSensitivity(double* params)
     }
 }
 
+void Reactor::getSensitivityAdjoint(const double* lambda, double* dfdp,
+                                    vector<bool>& handled)
+{
+    Eigen::VectorXd nuMu;
+    vector<double> ropNet;
+    if (m_chem) {
+        vector<double> mu(m_nsp);
+        if (!getProductionRateAdjoint(lambda, mu.data())) {
+            return;
+        }
+        Eigen::SparseMatrix<double> nu = m_kin->productStoichCoeffs()
+                                         - m_kin->reactantStoichCoeffs();
+        nuMu = nu.transpose() * MappedVector(mu.data(), m_nsp);
+        // Multipliers are applied as (nominal value) * p, so the derivative of the
+        // net rate of progress with respect to p is the net rate of progress for
+        // the nominal multiplier
+        m_thermo->restoreState(m_state);
+        ropNet.resize(m_kin->nReactions());
+        m_kin->getNetRatesOfProgress(ropNet.data());
+    }
+    for (auto& p : m_sensParams) {
+        if (p.type == SensParameterType::reaction) {
+            dfdp[p.global] = m_chem ? nuMu[p.local] * ropNet[p.local] : 0.0;
+            handled[p.global] = true;
+        }
+    }
+}
+
+bool Reactor::getProductionRateAdjoint(const double* lambda, double* mu)
+{
+    const vector<double>& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+3] * mw[k] * m_vol;
+    }
+    return true;
+}
+
 void Reactor::setAdvanceLimits(const double *limits)
 {
     if (m_thermo == 0) {
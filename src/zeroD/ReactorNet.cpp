@@ -11,6 +11,8 @@
 #include "cantera/base/Array.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/zeroD/FlowReactor.h"
+#include "cantera/kinetics/MechanismReducer.h"
+#include "cantera/kinetics/Kinetics.h"
 
 #include <cstdio>
 
@@ -66,6 +68,26 @@ void ReactorNet::setSensitivityTolerances(double rtol, double atol)
     m_init = false;
 }
 
+void ReactorNet::setForwardSensitivities(bool enabled)
+{
+    if (enabled != m_forwardSens) {
+        m_forwardSens = enabled;
+        m_init = false;
+    }
+}
+
+void ReactorNet::setAdjointCheckpointInterval(int nsteps)
+{
+    if (nsteps < 0) {
+        throw CanteraError("ReactorNet::setAdjointCheckpointInterval",
+                           "Checkpoint interval must not be negative.");
+    }
+    if (nsteps != m_adjointInterval) {
+        m_adjointInterval = nsteps;
+        m_init = false;
+    }
+}
+
 double ReactorNet::time() {
     if (m_timeIsIndependent) {
         return m_time;
@@ -110,6 +132,34 @@ void ReactorNet::initialize()
         }
     }
 
+    restoreReduction();
+    m_reducers.clear();
+    m_lastReduction = -BigNumber;
+    if (!m_reductionSettings.empty()) {
+        vector<Kinetics*> kinetics;
+        for (auto r : m_reactors) {
+            Kinetics* kin = r->kinetics();
+            if (!kin || kin->nReactions() == 0) {
+                m_reducers.emplace_back();
+                continue;
+            }
+            if (std::find(kinetics.begin(), kinetics.end(), kin) != kinetics.end()) {
+                throw CanteraError("ReactorNet::initialize", "Adaptive chemistry "
+                    "is not supported for reactors sharing a Kinetics object.");
+            }
+            kinetics.push_back(kin);
+            auto reducer = make_unique<MechanismReducer>(*kin);
+            reducer->setTargets(m_reductionSettings["targets"].asVector<string>());
+            if (m_reductionSettings.hasKey("threshold")) {
+                reducer->setThreshold(m_reductionSettings["threshold"].asDouble());
+            }
+            if (m_reductionSettings.hasKey("method")) {
+                reducer->setMethod(m_reductionSettings["method"].asString());
+            }
+            m_reducers.push_back(std::move(reducer));
+        }
+    }
+
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
     m_advancelimits.resize(m_nv,-1.0);
@@ -117,6 +167,7 @@ void ReactorNet::initialize()
     fill(m_atol.begin(), m_atol.end(), m_atols);
     m_integ->setTolerances(m_rtol, neq(), m_atol.data());
     m_integ->setSensitivityTolerances(m_rtolsens, m_atolsens);
+    m_integ->setAdjointCheckpointInterval(m_adjointInterval);
     if (!m_linearSolverType.empty()) {
         m_integ->setLinearSolverType(m_linearSolverType);
     }
@@ -178,9 +229,34 @@ void ReactorNet::advance(double time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
-    m_time = time;
-    updateState(m_integ->solution());
+    if (m_reducers.empty()) {
+        m_integ->integrate(time);
+        m_time = time;
+        updateState(m_integ->solution());
+        return;
+    }
+
+    // Dynamic adaptive chemistry: integrate with reduced mechanisms, which are
+    // updated at the start of the step and at the specified intervals
+    try {
+        while (m_time < time) {
+            double tnext = time;
+            if (m_reductionInterval > 0) {
+                tnext = std::min(time, m_time + m_reductionInterval);
+            }
+            if (applyReduction(true)) {
+                reinitialize();
+                m_nReductionReinits++;
+            }
+            m_integ->integrate(tnext);
+            m_time = tnext;
+            updateState(m_integ->solution());
+            restoreReduction();
+        }
+    } catch (...) {
+        restoreReduction();
+        throw;
+    }
 }
 
 double ReactorNet::advance(double time, bool applylimit)
@@ -245,8 +321,26 @@ double ReactorNet::step()
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_time = m_integ->step(m_time + 1.0);
-    updateState(m_integ->solution());
+    if (m_reducers.empty()) {
+        m_time = m_integ->step(m_time + 1.0);
+        updateState(m_integ->solution());
+        return m_time;
+    }
+
+    try {
+        bool update = m_time >= m_lastReduction + m_reductionInterval
+                      || m_time < m_lastReduction;
+        if (applyReduction(update)) {
+            reinitialize();
+            m_nReductionReinits++;
+        }
+        m_time = m_integ->step(m_time + 1.0);
+        updateState(m_integ->solution());
+        restoreReduction();
+    } catch (...) {
+        restoreReduction();
+        throw;
+    }
     return m_time;
 }
 
@@ -434,6 +528,78 @@ void ReactorNet::evalJacobian(double t, double* y, double* ydot, double* p, Arra
     }
 }
 
+void ReactorNet::evalSensitivityAdjoint(double t, double* y, double* p,
+                                        const double* lambda, double* dfdp)
+{
+    size_t np = m_sens_params.size();
+    vector<double> ydot0(m_nv);
+    eval(t, y, ydot0.data(), p);
+    vector<double> lambdaLHS(m_nv);
+    for (size_t i = 0; i < m_nv; i++) {
+        lambdaLHS[i] = lambda[i] / m_LHS[i];
+    }
+    vector<bool> handled(np, false);
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        m_reactors[n]->getSensitivityAdjoint(lambdaLHS.data() + m_start[n], dfdp,
+                                             handled);
+    }
+
+    // Finite difference approximation for the remaining parameters
+    for (size_t i = 0; i < np; i++) {
+        if (handled[i]) {
+            continue;
+        }
+        double psave = p[i];
+        double dp = 1e-6 * std::max(std::abs(psave), std::abs(m_paramScales[i]));
+        if (dp == 0.0) {
+            dp = 1e-6;
+        }
+        p[i] = psave + dp;
+        eval(t, y, m_ydot.data(), p);
+        p[i] = psave;
+        double sum = 0.0;
+        for (size_t m = 0; m < m_nv; m++) {
+            sum += lambda[m] * (m_ydot[m] - ydot0[m]);
+        }
+        dfdp[i] = sum / dp;
+    }
+}
+
+void ReactorNet::solveAdjoint(const double* lambda, double* sens)
+{
+    m_adjointTime = NAN;
+    m_integ->integrateAdjoint(lambda, sens);
+}
+
+void ReactorNet::evalAdjoint(double t, double* y, double* lambda, double* lambdaDot,
+                             double* p)
+{
+    if (t != m_adjointTime || !std::equal(y, y + m_nv, m_adjointState.begin())) {
+        m_adjointState.assign(y, y + m_nv);
+        m_adjointWork.assign(y, y + m_nv);
+        m_adjointJac.resize(m_nv, m_nv);
+        vector<double> ydot(m_nv);
+        evalJacobian(t, m_adjointWork.data(), ydot.data(), p, &m_adjointJac);
+        m_adjointTime = t;
+    }
+    for (size_t j = 0; j < m_nv; j++) {
+        double sum = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            sum += m_adjointJac(i, j) * lambda[i];
+        }
+        lambdaDot[j] = -sum;
+    }
+}
+
+void ReactorNet::evalAdjointQuadrature(double t, double* y, double* lambda,
+                                       double* qdot, double* p)
+{
+    evalSensitivityAdjoint(t, y, p, lambda, qdot);
+    for (size_t i = 0; i < m_sens_params.size(); i++) {
+        qdot[i] = -qdot[i];
+    }
+}
+
 void ReactorNet::updateState(double* y)
 {
     checkFinite("y", y, m_nv);
@@ -537,6 +703,70 @@ void ReactorNet::setDerivativeSettings(AnyMap& settings)
     }
 }
 
+void ReactorNet::setAdaptiveChemistry(const AnyMap& settings)
+{
+    if (!settings.empty() && !settings.hasKey("targets")) {
+        throw InputFileError("ReactorNet::setAdaptiveChemistry", settings,
+                             "Missing required key 'targets'.");
+    }
+    restoreReduction();
+    m_reducers.clear();
+    m_reductionSettings = settings;
+    m_reductionInterval = settings.getDouble("interval", 0.0);
+    m_nReductionUpdates = 0;
+    m_nReductionReinits = 0;
+    m_init = false;
+}
+
+AnyMap ReactorNet::adaptiveChemistryStats() const
+{
+    AnyMap stats;
+    stats["updates"] = static_cast<long int>(m_nReductionUpdates);
+    stats["reinitializations"] = static_cast<long int>(m_nReductionReinits);
+    vector<long int> nSpecies, nReactions;
+    for (size_t n = 0; n < m_reducers.size(); n++) {
+        if (m_reducers[n]) {
+            nSpecies.push_back(m_reducers[n]->nActiveSpecies());
+            nReactions.push_back(m_reducers[n]->nActiveReactions());
+        } else {
+            nSpecies.push_back(0);
+            nReactions.push_back(0);
+        }
+    }
+    stats["active_species"] = nSpecies;
+    stats["active_reactions"] = nReactions;
+    return stats;
+}
+
+bool ReactorNet::applyReduction(bool update)
+{
+    bool changed = false;
+    for (size_t n = 0; n < m_reducers.size(); n++) {
+        if (!m_reducers[n]) {
+            continue;
+        }
+        if (update) {
+            m_reactors[n]->restoreState();
+            changed |= m_reducers[n]->update();
+        }
+        m_reducers[n]->apply();
+    }
+    if (update) {
+        m_lastReduction = m_time;
+        m_nReductionUpdates++;
+    }
+    return changed;
+}
+
+void ReactorNet::restoreReduction()
+{
+    for (auto& reducer : m_reducers) {
+        if (reducer) {
+            reducer->restore();
+        }
+    }
+}
+
 AnyMap ReactorNet::solverStats() const
 {
     if (m_integ) {
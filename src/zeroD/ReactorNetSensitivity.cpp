@@ -0,0 +1,136 @@
+//! @file ReactorNetSensitivity.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorNetSensitivity.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/Reactor.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+
+namespace Cantera
+{
+
+//! Copy of the reactor model used by a single thread
+class ReactorNetSensitivity::ReactorWorker : public BruteForceSensitivity::Worker
+{
+public:
+    ReactorWorker(shared_ptr<Solution> sol, const ReactorNetSensitivity& parent)
+        : m_sol(sol)
+        , m_tEnd(parent.m_tEnd)
+        , m_components(parent.m_components)
+    {
+        m_sol->thermo()->saveState(m_state0);
+        m_reactor = std::dynamic_pointer_cast<Reactor>(
+            newReactor(parent.m_reactorType, m_sol, "sensitivity"));
+        if (!m_reactor) {
+            throw CanteraError("ReactorNetSensitivity::newWorker",
+                "Reactor type '{}' cannot be integrated.", parent.m_reactorType);
+        }
+        m_net.addReactor(*m_reactor);
+        m_net.setTolerances(parent.m_rtol, parent.m_atol);
+        m_net.initialize();
+        for (const auto& name : m_components) {
+            m_index.push_back(name.empty() ? npos : m_net.globalComponentIndex(name));
+        }
+        m_y.resize(m_net.neq());
+        m_yPrev.resize(m_net.neq());
+    }
+
+    Kinetics& kinetics() override {
+        return *m_sol->kinetics();
+    }
+
+    void solve(bool warmStart, vector<double>& values) override {
+        m_sol->thermo()->restoreState(m_state0);
+        m_reactor->syncState();
+        m_net.setInitialTime(0.0);
+        m_net.reinitialize();
+        double t = 0.0;
+        double T = m_reactor->temperature();
+        double tIgn = 0.0;
+        double maxRate = -BigNumber;
+        while (t < m_tEnd) {
+            m_net.getState(m_yPrev.data());
+            double tPrev = t;
+            double TPrev = T;
+            t = m_net.step();
+            if (t > m_tEnd) {
+                // Return to the start of the step and integrate to the end time
+                m_net.updateState(m_yPrev.data());
+                m_net.setInitialTime(tPrev);
+                m_net.advance(m_tEnd);
+                t = m_tEnd;
+            }
+            T = m_reactor->temperature();
+            double rate = (T - TPrev) / (t - tPrev);
+            if (rate > maxRate) {
+                maxRate = rate;
+                tIgn = 0.5 * (t + tPrev);
+            }
+        }
+        m_net.getState(m_y.data());
+        for (size_t n = 0; n < m_index.size(); n++) {
+            values[n] = (m_index[n] == npos) ? tIgn : m_y[m_index[n]];
+        }
+    }
+
+protected:
+    shared_ptr<Solution> m_sol;
+    shared_ptr<Reactor> m_reactor;
+    ReactorNet m_net;
+    double m_tEnd;
+    vector<string> m_components;
+    vector<size_t> m_index; //!< Global indices of components; npos for ignition delay
+    vector<double> m_state0; //!< Initial thermodynamic state
+    vector<double> m_y;
+    vector<double> m_yPrev;
+};
+
+ReactorNetSensitivity::ReactorNetSensitivity(shared_ptr<Solution> sol,
+                                             const string& reactorType)
+    : BruteForceSensitivity(sol)
+    , m_reactorType(reactorType)
+{
+}
+
+void ReactorNetSensitivity::setEndTime(double tEnd)
+{
+    if (tEnd <= 0.0) {
+        throw CanteraError("ReactorNetSensitivity::setEndTime",
+                           "End time must be positive; got {}", tEnd);
+    }
+    m_tEnd = tEnd;
+}
+
+void ReactorNetSensitivity::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+}
+
+void ReactorNetSensitivity::addIgnitionDelay(const string& name)
+{
+    addObjectiveName(name);
+    m_components.emplace_back();
+}
+
+void ReactorNetSensitivity::addComponent(const string& component)
+{
+    addObjectiveName(component);
+    m_components.push_back(component);
+}
+
+unique_ptr<BruteForceSensitivity::Worker> ReactorNetSensitivity::newWorker(
+    shared_ptr<Solution> sol)
+{
+    if (m_tEnd <= 0.0) {
+        throw CanteraError("ReactorNetSensitivity::newWorker", "End time not set.");
+    }
+    return make_unique<ReactorWorker>(sol, *this);
+}
+
+}
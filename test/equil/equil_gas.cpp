@@ -5,6 +5,10 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/BatchEquil.h"
+#include "cantera/equil/ChemEquil.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -310,6 +314,95 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+TEST(ChemEquil, reuse_solution)
+{
+    auto gas = newThermo("gri30.yaml", "gri30");
+    ChemEquil cold;
+    ChemEquil warm;
+    warm.setReuseTolerance(0.05);
+    for (double phi : {0.9, 0.95, 1.0, 1.05}) {
+        gas->setState_TP(300, OneAtm);
+        gas->setEquivalenceRatio(phi, "CH4", "O2:1.0, N2:3.76");
+        vector<double> state(gas->stateSize());
+        gas->saveState(state);
+        cold.equilibrate(*gas, "HP");
+        vector<double> ref(gas->stateSize());
+        gas->saveState(ref);
+        gas->restoreState(state);
+        warm.equilibrate(*gas, "HP");
+        if (phi != 0.9) {
+            EXPECT_TRUE(warm.warmStarted());
+            EXPECT_LT(warm.options.iterations, cold.options.iterations);
+        }
+        EXPECT_NEAR(gas->temperature(), ref[0], 1e-6 * ref[0]);
+        for (size_t k = 0; k < gas->nSpecies(); k++) {
+            EXPECT_NEAR(gas->massFraction(k), ref[k + 2], 1e-8);
+        }
+    }
+
+    // Solution is not reused for a different mixture
+    gas->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5, AR:8.0");
+    warm.equilibrate(*gas, "TP");
+    EXPECT_FALSE(warm.warmStarted());
+
+    // Solution is reused when an element is removed, which changes the component
+    // basis
+    gas->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5, AR:0.2, N2:8.0");
+    warm.equilibrate(*gas, "TP");
+    gas->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5, N2:8.0");
+    cold.equilibrate(*gas, "TP");
+    vector<double> ref(gas->stateSize());
+    gas->saveState(ref);
+    gas->setState_TPX(1500, OneAtm, "H2:1.0, O2:0.5, N2:8.0");
+    warm.equilibrate(*gas, "TP");
+    EXPECT_TRUE(warm.warmStarted());
+    for (size_t k = 0; k < gas->nSpecies(); k++) {
+        EXPECT_NEAR(gas->massFraction(k), ref[k + 2], 1e-8);
+    }
+}
+
+TEST(BatchEquil, warm_start)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto gas = sol->thermo();
+    vector<double> phi{0.6, 0.8, 1.0, 1.2, 1.5};
+    vector<double> T0{300, 600, 900};
+    auto states = SolutionArray::create(sol, static_cast<int>(phi.size() * T0.size()));
+    int loc = 0;
+    for (double T : T0) {
+        for (double p : phi) {
+            gas->setState_TP(T, OneAtm);
+            gas->setEquivalenceRatio(p, "CH4", "O2:1.0, N2:3.76");
+            vector<double> state(gas->stateSize());
+            gas->saveState(state);
+            states->setState(loc++, state);
+        }
+    }
+    states->setApiShape({static_cast<long int>(T0.size()),
+                         static_cast<long int>(phi.size())});
+
+    BatchEquil equil;
+    equil.setMaxThreads(2);
+    auto out = equil.equilibrate(*states, "HP");
+    ASSERT_EQ(out->size(), states->size());
+    EXPECT_EQ(out->apiShape(), states->apiShape());
+    AnyMap stats = equil.stats();
+    EXPECT_EQ(stats["states"].asInt(), states->size());
+    EXPECT_GT(stats["warm_starts"].asInt(), 0);
+
+    for (int i = 0; i < states->size(); i++) {
+        gas->restoreState(states->getState(i));
+        gas->equilibrate("HP");
+        vector<double> ref(gas->stateSize());
+        gas->saveState(ref);
+        vector<double> actual = out->getState(i);
+        EXPECT_NEAR(actual[0], ref[0], 1e-6 * ref[0]);
+        for (size_t k = 2; k < ref.size(); k++) {
+            EXPECT_NEAR(actual[k], ref[k], 1e-8);
+        }
+    }
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/SolutionArray.h"
+#include <fstream>
 
 using namespace Cantera;
 
@@ -79,6 +80,58 @@ TEST(SolutionArray, simple)
     ASSERT_THROW(arr->setAuxiliary(0, m), CanteraError);
 }
 
+TEST(SolutionArray, componentView)
+{
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto arr = SolutionArray::create(gas, 7);
+    vector<double> T(7);
+    for (size_t k = 0; k < T.size(); k++) {
+        T[k] = 300. + 100. * k;
+    }
+    AnyValue any;
+    any = T;
+    arr->setComponent("T", any);
+    arr->addExtra("spam");
+    arr->setComponent("spam", any);
+
+    auto view = arr->getComponentView("T");
+    ASSERT_EQ(view.size(), 7u);
+    ASSERT_EQ(view.indices(), nullptr);
+    auto H2 = arr->getComponent("H2").asVector<double>();
+    auto viewH2 = arr->getComponentView("H2");
+    for (size_t k = 0; k < T.size(); k++) {
+        EXPECT_EQ(view[k], T[k]);
+        EXPECT_EQ(view.data()[k * view.stride()], T[k]);
+        EXPECT_EQ(viewH2[k], H2[k]);
+    }
+    ASSERT_THROW(arr->getComponentView("foo"), CanteraError);
+
+    // Regular slices use a constant stride
+    auto strided = arr->share({1, 3, 5});
+    view = strided->getComponentView("T");
+    ASSERT_EQ(view.size(), 3u);
+    ASSERT_EQ(view.indices(), nullptr);
+    EXPECT_EQ(view[0], T[1]);
+    EXPECT_EQ(view[2], T[5]);
+    view = strided->getComponentView("spam");
+    ASSERT_EQ(view.stride(), 2u);
+    EXPECT_EQ(view[1], T[3]);
+
+    // Irregular slices use an index
+    auto sliced = arr->share({6, 0, 2});
+    view = sliced->getComponentView("T");
+    ASSERT_NE(view.indices(), nullptr);
+    EXPECT_EQ(view[0], T[6]);
+    EXPECT_EQ(view[1], T[0]);
+    EXPECT_EQ(view[2], T[2]);
+
+    // Views are not available for other data types
+    arr->addExtra("eggs");
+    any = "foo";
+    arr->setComponent("eggs", any);
+    ASSERT_THROW(arr->getComponentView("eggs"), CanteraError);
+}
+
 TEST(SolutionArray, normalize)
 {
     auto gas = newSolution("h2o2.yaml",  "", "none");
@@ -126,6 +179,90 @@ TEST(SolutionArray, normalize)
     }
 }
 
+TEST(SolutionArray, csvRoundTrip)
+{
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto phase = gas->thermo();
+    auto arr = SolutionArray::create(gas, 25);
+    vector<double> state(phase->stateSize());
+    vector<long int> step(arr->size());
+    vector<double> value(arr->size());
+    vector<string> tag(arr->size());
+    for (int loc = 0; loc < arr->size(); loc++) {
+        phase->setState_TPX(300. + 37.1 * loc, OneAtm * (1 + 0.1 * loc),
+                            "H2:1.0, O2:0.5, AR:" + std::to_string(loc));
+        phase->saveState(state);
+        arr->setState(loc, state);
+        step[loc] = -3 + loc;
+        value[loc] = 1. / (loc + 1.);
+        tag[loc] = (loc % 2) ? "spam,eggs" : "ham";
+    }
+    AnyValue any;
+    arr->addExtra("step");
+    any = step;
+    arr->setComponent("step", any);
+    arr->addExtra("value", true);
+    any = value;
+    arr->setComponent("value", any);
+    arr->addExtra("tag", true);
+    any = tag;
+    arr->setComponent("tag", any);
+
+    // Native basis is restored exactly
+    string fname = "solutionarray_roundtrip.csv";
+    arr->writeEntry(fname, true);
+    auto b = SolutionArray::create(gas);
+    b->restore(fname, "");
+    ASSERT_EQ(b->size(), arr->size());
+    EXPECT_EQ(b->componentNames(), arr->componentNames());
+    for (int loc = 0; loc < arr->size(); loc++) {
+        EXPECT_EQ(b->getState(loc), arr->getState(loc));
+    }
+    EXPECT_EQ(b->getComponent("step").asVector<long int>(), step);
+    EXPECT_EQ(b->getComponent("value").asVector<double>(), value);
+    EXPECT_EQ(b->getComponent("tag").asVector<string>(), tag);
+
+    // Mole fractions are converted to native mass fractions
+    arr->writeEntry(fname, true, "mole");
+    b->restore(fname, "");
+    ASSERT_EQ(b->size(), arr->size());
+    for (int loc = 0; loc < arr->size(); loc++) {
+        auto expected = arr->getState(loc);
+        auto actual = b->getState(loc);
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(actual[i], expected[i], 1e-14 * std::max(expected[i], 1.));
+        }
+    }
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, csvColumnTypes)
+{
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    string fname = "solutionarray_types.csv";
+    {
+        std::ofstream out(fname);
+        out << "T,P,X_H2,X_O2,count,value,tag\n"
+            << "300.,101325.,0.6,0.4,1,2,12\n"
+            << "400., 101325,0.5,0.5,+2,1e-3,\n"
+            << "500.,1.01325e5,0.4,0.6,-3,nan,n/a\n";
+    }
+    auto arr = SolutionArray::create(gas);
+    arr->restore(fname, "");
+    ASSERT_EQ(arr->size(), 3);
+    EXPECT_EQ(arr->getComponent("count").asVector<long int>(),
+              vector<long int>({1, 2, -3}));
+    auto value = arr->getComponent("value").asVector<double>();
+    EXPECT_DOUBLE_EQ(value[1], 1e-3);
+    EXPECT_TRUE(std::isnan(value[2]));
+    // column is text as a field in the last row is not numeric
+    EXPECT_EQ(arr->getComponent("tag").asVector<string>(),
+              vector<string>({"12", "", "n/a"}));
+    gas->thermo()->restoreState(arr->getState(2));
+    EXPECT_NEAR(gas->thermo()->pressure(), OneAtm, 1e-8);
+    std::remove(fname.c_str());
+}
+
 TEST(SolutionArray, meta)
 {
     auto gas = newSolution("h2o2.yaml",  "", "none");
@@ -506,3 +643,98 @@ TEST(SolutionArray, extraSlicedStringArrays) {
     ASSERT_EQ(sliced->getAuxiliary(1)["spam"].asVector<string>()[0], "a");
     testMultiCol<string>(*sliced, vector<string>({"foo", "bar", "baz"}), true);
 }
+
+#if CT_USE_HDF5
+
+TEST(SolutionArray, readEntrySlice)
+{
+    const string fname = "solutionarray_slice.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    auto arr = SolutionArray::create(gas, 7);
+    vector<double> state(phase->stateSize());
+    vector<double> value(arr->size());
+    for (int loc = 0; loc < arr->size(); loc++) {
+        phase->setState_TPX(300. + 100. * loc, OneAtm, "H2:1.0, O2:0.5, AR:" +
+                            std::to_string(loc));
+        phase->saveState(state);
+        arr->setState(loc, state);
+        value[loc] = 0.5 * loc;
+    }
+    AnyValue any;
+    arr->addExtra("value");
+    any = value;
+    arr->setComponent("value", any);
+    arr->writeEntry(fname, "group0", "data");
+
+    auto b = SolutionArray::create(gas);
+    b->readEntry(fname, "group0", "data", 2, 3);
+    ASSERT_EQ(b->size(), 3);
+    for (int loc = 0; loc < b->size(); loc++) {
+        auto expected = arr->getState(loc + 2);
+        auto actual = b->getState(loc);
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(actual[i], expected[i], 1e-14 * std::max(expected[i], 1.));
+        }
+    }
+    EXPECT_EQ(b->getComponent("value").asVector<double>(),
+              vector<double>(value.begin() + 2, value.begin() + 5));
+
+    // count is truncated at the end of the stored data
+    b->readEntry(fname, "group0", "data", 5);
+    ASSERT_EQ(b->size(), 2);
+    EXPECT_NEAR(b->getState(1)[0], arr->getState(6)[0], 1e-12);
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, readEntryNative)
+{
+    // The ideal gas state is stored in native mode (T, D, Y)
+    const string fname = "solutionarray_native.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto gas = newSolution("h2o2.yaml", "", "none");
+    auto phase = gas->thermo();
+    auto arr = SolutionArray::create(gas, 6);
+    vector<double> state(phase->stateSize());
+    for (int loc = 0; loc < arr->size(); loc++) {
+        phase->setState_TPX(400. + 150. * loc, (1. + loc) * OneAtm,
+                            "H2:1.0, O2:" + std::to_string(0.2 * (loc + 1)) + ", AR:2");
+        phase->saveState(state);
+        arr->setState(loc, state);
+    }
+    arr->writeEntry(fname, "group0", "data");
+
+    auto checkRows = [&](SolutionArray& b, int start) {
+        for (int loc = 0; loc < b.size(); loc++) {
+            auto expected = arr->getState(loc + start);
+            auto actual = b.getState(loc);
+            ASSERT_EQ(actual.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); i++) {
+                EXPECT_NEAR(actual[i], expected[i], 1e-14 * std::max(expected[i], 1.))
+                    << "row " << loc + start << ", entry " << i;
+            }
+        }
+    };
+
+    auto full = SolutionArray::create(gas);
+    full->readEntry(fname, "group0", "data");
+    ASSERT_EQ(full->size(), arr->size());
+    checkRows(*full, 0);
+
+    auto part = SolutionArray::create(gas);
+    part->readEntry(fname, "group0", "data", 1, 4);
+    ASSERT_EQ(part->size(), 4);
+    checkRows(*part, 1);
+
+    part->readEntry(fname, "group0", "data", 4, 10);
+    ASSERT_EQ(part->size(), 2);
+    checkRows(*part, 4);
+    std::remove(fname.c_str());
+}
+
+#endif
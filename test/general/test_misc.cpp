@@ -5,6 +5,8 @@
 #include "gmock/gmock.h"
 #include "cantera/base/global.h"
 #include "cantera/base/Solution.h"
+#include "cantera/base/logger.h"
+#include <thread>
 
 using namespace Cantera;
 using ::testing::HasSubstr;
@@ -30,3 +32,61 @@ TEST(CanteraError, stacktrace) {
     }
     EXPECT_TRUE(raised);
 }
+
+TEST(parallelFor, results_and_errors) {
+    vector<double> x(5000);
+    parallelFor(x.size(), [&](size_t i) { x[i] = 2.0 * i; }, 10);
+    for (size_t i = 0; i < x.size(); i++) {
+        ASSERT_EQ(x[i], 2.0 * i);
+    }
+    auto fail = [](size_t i) {
+        if (i == 4321) {
+            throw CanteraError("test", "failed at {}", i);
+        }
+    };
+    EXPECT_THROW(parallelFor(x.size(), fail, 10), CanteraError);
+}
+
+//! Logger recording messages and the threads they are written from
+class RecordingLogger : public Logger
+{
+public:
+    void write(const string& msg) override {
+        messages.push_back(msg);
+        threads.push_back(std::this_thread::get_id());
+    }
+    void warn(const string& warning, const string& msg) override {
+        write(warning + ": " + msg);
+    }
+    vector<string> messages;
+    vector<std::thread::id> threads;
+};
+
+TEST(parallelFor, buffered_logging) {
+    size_t n = 1000;
+    auto logger = new RecordingLogger();
+    setLogger(logger); // takes ownership
+    parallelFor(n, [](size_t i) {
+        writelog("task {}", i);
+        if (i % 100 == 0) {
+            warn_user("parallelFor", "warning {}", i);
+        }
+    }, 10);
+    auto messages = logger->messages;
+    auto threads = logger->threads;
+    setLogger(new Logger());
+
+    // messages from all threads are written by the calling thread in task order
+    ASSERT_EQ(messages.size(), n + n / 100);
+    size_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(messages[pos++], fmt::format("task {}", i));
+        if (i % 100 == 0) {
+            EXPECT_THAT(messages[pos++],
+                        HasSubstr(fmt::format("parallelFor: warning {}", i)));
+        }
+    }
+    for (const auto& id : threads) {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
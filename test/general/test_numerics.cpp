@@ -128,6 +128,22 @@ TEST(Simpson, even)
     EXPECT_NEAR(simpson(f, x), 3.34127, 1e-5);
 }
 
+TEST(Simpson, weights)
+{
+    for (int n : {2, 3, 4, 7, 10}) {
+        Eigen::ArrayXd x(n), f(n);
+        for (int i = 0; i < n; i++) {
+            x[i] = 0.1 * i * i + 0.3 * i;
+            f[i] = std::sin(x[i]) + 2.0;
+        }
+        Eigen::ArrayXd w = simpsonWeights(x);
+        EXPECT_NEAR((w * f).sum(), simpson(f, x), 1e-14) << n;
+    }
+    Eigen::ArrayXd x(3);
+    x << 0.0, 1.0, 0.5;
+    EXPECT_THROW(simpsonWeights(x), CanteraError);
+}
+
 TEST(ctfunc, functor)
 {
     auto functor = newFunc1("functor");
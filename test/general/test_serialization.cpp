@@ -717,6 +717,38 @@ TEST(Storage, readCompressed)
     ASSERT_TRUE(data.isMatrix<string>());
 }
 
+TEST(Storage, readPartial)
+{
+    const string fname = "readPartial.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto file = unique_ptr<Storage>(new Storage(fname, true));
+    file->checkGroup("test", true);
+    AnyValue any;
+    any = vector<double>({1.1, 2.2, 3.3, 4.4, 5.5});
+    file->writeData("test", "double-vector", any);
+    any = vector<vector<double>>({{1.1, 2.2, 3.3}, {4.4, 5.5, 6.6}, {7.7, 8.8, 9.9}});
+    file->writeData("test", "double-matrix", any);
+    any = vector<long int>({1, 2, 3});
+    file->writeData("test", "integer-vector", any);
+
+    file = unique_ptr<Storage>(new Storage(fname, false));
+    auto data = file->readData("test", "double-vector", 2, npos, 2);
+    EXPECT_EQ(data.asVector<double>(), vector<double>({3.3, 4.4}));
+    EXPECT_THROW(file->readData("test", "double-vector", 2, npos, 4), CanteraError);
+
+    auto cols = file->readColumns("test", "double-matrix", {2, 0}, 1, 2);
+    ASSERT_EQ(cols.size(), 2u);
+    EXPECT_EQ(cols[0], vector<double>({6.6, 9.9}));
+    EXPECT_EQ(cols[1], vector<double>({4.4, 7.7}));
+    EXPECT_THROW(file->readColumns("test", "double-matrix", {3}, 0, 1), IndexError);
+    EXPECT_THROW(file->readColumns("test", "double-matrix", {0}, 2, 2), CanteraError);
+    EXPECT_THROW(file->readColumns("test", "integer-vector", {0}, 0, 1), CanteraError);
+    EXPECT_THROW(file->readColumns("spam", "double-matrix", {0}, 0, 1), CanteraError);
+    std::remove(fname.c_str());
+}
+
 #else
 
 TEST(Storage, noSupport)
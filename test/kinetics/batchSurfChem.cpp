@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "cantera/base/Interface.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/kinetics/BatchSurfChem.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/thermo/SurfPhase.h"
+
+using namespace Cantera;
+
+class BatchSurfChemTest : public testing::Test
+{
+public:
+    BatchSurfChemTest() {
+        surf = newInterface("diamond.yaml", "diamond_100");
+        gasSol = surf->adjacent("gas");
+        gas = gasSol->thermo();
+        kin = std::dynamic_pointer_cast<InterfaceKinetics>(surf->kinetics());
+        states = SolutionArray::create(gasSol, static_cast<int>(T.size()));
+        vector<double> state(gas->stateSize());
+        for (size_t i = 0; i < T.size(); i++) {
+            gas->setState_TPX(T[i], 0.1 * OneAtm,
+                              "H:0.002, H2:0.988, CH3:0.0002, CH4:0.01");
+            gas->saveState(state);
+            states->setState(static_cast<int>(i), state);
+        }
+        states->setApiShape({2, 3});
+        nsp = surf->thermo()->nSpecies();
+    }
+
+    //! Coverages of state *i* of *arr*
+    vector<double> coverages(SolutionArray& arr, int i) {
+        vector<double> theta(nsp);
+        surf->thermo()->restoreState(arr.getState(i));
+        surf->thermo()->getCoverages(theta.data());
+        return theta;
+    }
+
+    vector<double> T{1000, 1050, 1100, 1150, 1200, 1250};
+    shared_ptr<Interface> surf;
+    shared_ptr<Solution> gasSol;
+    shared_ptr<ThermoPhase> gas;
+    shared_ptr<InterfaceKinetics> kin;
+    shared_ptr<SolutionArray> states;
+    size_t nsp;
+};
+
+TEST_F(BatchSurfChemTest, steady)
+{
+    BatchSurfChem batch(surf);
+    batch.setMaxThreads(2);
+    auto steady = batch.solve(*states);
+    ASSERT_EQ(steady->size(), states->size());
+    EXPECT_EQ(steady->apiShape(), states->apiShape());
+
+    vector<double> ref(nsp);
+    for (int i = 0; i < states->size(); i++) {
+        gas->restoreState(states->getState(i));
+        surf->thermo()->setTemperature(gas->temperature());
+        kin->solvePseudoSteadyStateProblem();
+        surf->thermo()->getCoverages(ref.data());
+        auto actual = coverages(*steady, i);
+        EXPECT_NEAR(surf->thermo()->temperature(), T[i], 1e-10);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(actual[k], ref[k], 1e-6) << i << ", " << k;
+        }
+    }
+}
+
+TEST_F(BatchSurfChemTest, transient)
+{
+    // Advance each state for a short time, starting from the same coverages
+    double dt = 1e-6;
+    vector<double> initial(surf->thermo()->stateSize());
+    surf->thermo()->saveState(initial);
+    auto initialStates = SolutionArray::create(surf, states->size());
+    for (int i = 0; i < states->size(); i++) {
+        initialStates->setState(i, initial);
+    }
+
+    BatchSurfChem batch(surf);
+    batch.setMaxThreads(1);
+    auto serial = batch.advance(*states, *initialStates, dt);
+    batch.setMaxThreads(2);
+    auto parallel = batch.advance(*states, *initialStates, dt);
+    ASSERT_EQ(parallel->size(), states->size());
+    EXPECT_EQ(parallel->apiShape(), states->apiShape());
+
+    vector<double> ref(nsp);
+    for (int i = 0; i < states->size(); i++) {
+        // Serial integration of the coverage equations
+        gas->restoreState(states->getState(i));
+        surf->thermo()->restoreState(initial);
+        surf->thermo()->setState_TP(gas->temperature(), gas->pressure());
+        ImplicitSurfChem integ({kin.get()});
+        integ.integrate(0.0, dt);
+        surf->thermo()->getCoverages(ref.data());
+
+        auto theta1 = coverages(*serial, i);
+        auto theta2 = coverages(*parallel, i);
+        EXPECT_NEAR(surf->thermo()->temperature(), T[i], 1e-10);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(theta1[k], ref[k], 1e-8) << i << ", " << k;
+            // States are integrated by a newly initialized or a reinitialized
+            // integrator, depending on the number of threads
+            EXPECT_NEAR(theta2[k], theta1[k], 1e-12) << i << ", " << k;
+        }
+    }
+    EXPECT_THROW(batch.advance(*states, *initialStates, 0.0), CanteraError);
+}
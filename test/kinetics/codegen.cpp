@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+#include "cantera/kinetics/KineticsCodeGenerator.h"
+#include "cantera/kinetics/GeneratedKinetics.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/base/Solution.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+namespace Cantera
+{
+
+namespace fs = std::filesystem;
+
+//! Path of the shared library compiled from the code generated for *mech*, where
+//! the generated functions use the prefix *name*. The libraries are built by the
+//! SCons test harness, see test/SConscript.
+string codegenLibrary(const string& mech, string& name)
+{
+    const char* dir = std::getenv("CT_CODEGEN_LIBS");
+    if (!dir) {
+        throw CanteraError("codegenLibrary", "Environment variable CT_CODEGEN_LIBS "
+            "is not set. Run the tests using 'scons test-kinetics'.");
+    }
+    name = mech.substr(0, mech.rfind(".yaml"));
+    std::replace(name.begin(), name.end(), '-', '_');
+    return (fs::path(dir) / name).string();
+}
+
+//! Create GeneratedKinetics using the functions with *prefix* from *library* for the
+//! phase of *soln*, with the reactions of this phase read from the file *mech*
+shared_ptr<GeneratedKinetics> newGeneratedKinetics(const string& library,
+    const string& prefix, shared_ptr<Solution> soln, const string& mech)
+{
+    auto kin = make_shared<GeneratedKinetics>(library, prefix);
+    AnyMap root = AnyMap::fromYamlFile(mech);
+    AnyMap& phaseNode = root["phases"].getMapWhere("name", soln->thermo()->name());
+    kin->addThermo(soln->thermo());
+    kin->init();
+    addReactions(*kin, phaseNode, root);
+    return kin;
+}
+
+class KineticsCodeGeneratorTest : public testing::TestWithParam<string>
+{
+public:
+    void check(const string& mech, const vector<pair<double, double>>& states) {
+        auto soln = newSolution(mech);
+        auto thermo = soln->thermo();
+        auto ref = soln->kinetics();
+        string prefix;
+        string library = codegenLibrary(mech, prefix);
+        auto kin = newGeneratedKinetics(library, prefix, soln, mech);
+        size_t nsp = thermo->nSpecies();
+        ASSERT_EQ(kin->nReactions(), ref->nReactions());
+
+        vector<double> X(nsp);
+        for (size_t k = 0; k < nsp; k++) {
+            X[k] = 1.0 + k % 7;
+        }
+        vector<double> C(nsp), wdot(nsp), wdotRef(nsp), wp(nsp), wm(nsp);
+        for (const auto& [T, P] : states) {
+            thermo->setState_TPX(T, P, X.data());
+            thermo->getConcentrations(C.data());
+            ref->getNetProductionRates(wdotRef.data());
+            kin->getNetProductionRates(wdot.data());
+            double scale = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                scale = std::max(scale, std::abs(wdotRef[k]));
+            }
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(wdot[k], wdotRef[k], 1e-9 * std::abs(wdotRef[k])
+                            + 1e-12 * scale) << mech << ", " << thermo->speciesName(k)
+                            << " at T = " << T << ", P = " << P;
+            }
+
+            // Finite difference approximation of the Jacobian at constant T and P
+            Eigen::MatrixXd jac = kin->netProductionRates_ddCi();
+            ASSERT_EQ(jac.rows(), static_cast<Eigen::Index>(nsp));
+            Eigen::MatrixXd jacFD(nsp, nsp);
+            for (size_t j = 0; j < nsp; j++) {
+                vector<double> Cp(C), Cm(C);
+                double dC = 1e-6 * (C[j] + 1e-8);
+                Cp[j] += dC;
+                Cm[j] -= dC;
+                kin->evalGenerated(T, P, Cp.data(), wp.data());
+                kin->evalGenerated(T, P, Cm.data(), wm.data());
+                for (size_t k = 0; k < nsp; k++) {
+                    jacFD(k, j) = (wp[k] - wm[k]) / (2 * dC);
+                }
+            }
+            double jacScale = jac.cwiseAbs().maxCoeff();
+            for (size_t k = 0; k < nsp; k++) {
+                for (size_t j = 0; j < nsp; j++) {
+                    EXPECT_NEAR(jac(k, j), jacFD(k, j), 1e-5 * std::abs(jacFD(k, j))
+                                + 1e-8 * jacScale) << mech << ", " << k << ", " << j
+                                << " at T = " << T << ", P = " << P;
+                }
+            }
+        }
+    }
+};
+
+TEST_P(KineticsCodeGeneratorTest, compare)
+{
+    // Pressures cover the ranges below, within and above the PLOG pressure levels
+    check(GetParam(), {{500, 1e3}, {900, 0.01 * OneAtm}, {1200, OneAtm},
+                       {1500, 7 * OneAtm}, {2500, 500 * OneAtm}});
+}
+
+INSTANTIATE_TEST_SUITE_P(KineticsCodeGenerator, KineticsCodeGeneratorTest,
+    testing::Values("h2o2.yaml", "gri30.yaml", "pdep-test.yaml", "sri-falloff.yaml",
+                    "tsang-falloff.yaml", "chemically-activated-reaction.yaml",
+                    "explicit-forward-order.yaml"));
+
+TEST(GeneratedKinetics, load)
+{
+    string prefix;
+    string library = codegenLibrary("h2o2.yaml", prefix);
+    EXPECT_THROW(GeneratedKinetics(library, "wrong_prefix"), CanteraError);
+    EXPECT_THROW(GeneratedKinetics(library + "_missing", prefix), CanteraError);
+
+    // Mechanism does not match the generated code
+    auto soln = newSolution("gri30.yaml");
+    auto kin = newGeneratedKinetics(library, prefix, soln, "gri30.yaml");
+    vector<double> wdot(kin->nTotalSpecies());
+    EXPECT_THROW(kin->getNetProductionRates(wdot.data()), CanteraError);
+    EXPECT_THROW(kin->netProductionRates_ddCi(), CanteraError);
+
+    // The sparse Jacobian holds the derivatives of the generated code
+    soln = newSolution("h2o2.yaml");
+    kin = newGeneratedKinetics(library, prefix, soln, "h2o2.yaml");
+    soln->thermo()->setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:4");
+    Eigen::MatrixXd jac = kin->netProductionRates_ddCi();
+    size_t nsp = kin->nTotalSpecies();
+    vector<double> C(nsp), jacDense(nsp * nsp);
+    soln->thermo()->getConcentrations(C.data());
+    kin->evalGenerated(1200, OneAtm, C.data(), wdot.data(), jacDense.data());
+    for (size_t k = 0; k < nsp; k++) {
+        for (size_t j = 0; j < nsp; j++) {
+            EXPECT_DOUBLE_EQ(jac(k, j), jacDense[k * nsp + j]);
+        }
+    }
+}
+
+TEST(KineticsCodeGenerator, source)
+{
+    auto soln = newSolution("pdep-test.yaml");
+    KineticsCodeGenerator gen(soln);
+    string src = gen.toSource();
+    EXPECT_NE(src.find("chebyshev("), string::npos);
+    EXPECT_NE(src.find("lk2"), string::npos);
+    EXPECT_EQ(gen.prefix(), "gas");
+    EXPECT_THROW(gen.setPrefix("1abc"), CanteraError);
+    soln->setName("pdep-test");
+    EXPECT_EQ(KineticsCodeGenerator(soln).prefix(), "mechanism");
+}
+
+TEST(KineticsCodeGenerator, unsupported)
+{
+    EXPECT_THROW(KineticsCodeGenerator(newSolution("ptcombust.yaml", "Pt_surf")),
+                 CanteraError);
+    auto soln = newSolution("kineticsfromscratch.yaml");
+    EXPECT_THROW(KineticsCodeGenerator(soln).toSource(), NotImplementedError);
+}
+
+}
@@ -0,0 +1,28 @@
+//! @file generate.cpp
+//! Generate the mechanism-specific source code compiled into shared libraries for
+//! the GeneratedKinetics tests.
+//!
+//! Usage: generate <mechanism file> <prefix> <output file>
+
+#include "cantera/kinetics/KineticsCodeGenerator.h"
+#include "cantera/base/Solution.h"
+#include <iostream>
+
+using namespace Cantera;
+
+int main(int argc, char** argv)
+{
+    if (argc != 4) {
+        std::cerr << "Usage: generate <mechanism file> <prefix> <output file>\n";
+        return 1;
+    }
+    try {
+        KineticsCodeGenerator gen(newSolution(argv[1]));
+        gen.setPrefix(argv[2]);
+        gen.toFile(argv[3]);
+    } catch (std::exception& err) {
+        std::cerr << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
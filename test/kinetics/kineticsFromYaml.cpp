@@ -6,16 +6,22 @@
 #include "cantera/kinetics/ReactionRateFactory.h"
 #include "cantera/kinetics/Reaction.h"
 #include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/BulkKinetics.h"
 #include "cantera/kinetics/ChebyshevRate.h"
 #include "cantera/kinetics/Custom.h"
 #include "cantera/kinetics/ElectronCollisionPlasmaRate.h"
 #include "cantera/kinetics/Falloff.h"
 #include "cantera/kinetics/InterfaceRate.h"
+#include "cantera/kinetics/MechanismReducer.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/solveSP.h"
 #include "cantera/kinetics/PlogRate.h"
 #include "cantera/kinetics/TwoTempPlasmaRate.h"
 #include "cantera/thermo/SurfPhase.h"
+#include "cantera/thermo/Species.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/base/Array.h"
+#include "cantera/numerics/funcs.h"
 
 using namespace Cantera;
 
@@ -556,6 +562,198 @@ TEST(Reaction, ElectronCollisionPlasmaFromYaml)
     }
 }
 
+TEST(Kinetics, ElectronCollisionPlasmaRates)
+{
+    auto sol = newSolution("oxygen-plasma.yaml", "isotropic-electron-energy-plasma",
+                           "none");
+    auto plasma = std::dynamic_pointer_cast<PlasmaPhase>(sol->thermo());
+    auto kin = sol->kinetics();
+
+    // Indices of reactions with cross section data
+    auto plasmaReactions = [&]() {
+        vector<size_t> indices;
+        for (size_t i = 0; i < kin->nReactions(); i++) {
+            auto rate = std::dynamic_pointer_cast<ElectronCollisionPlasmaRate>(
+                kin->reaction(i)->rate());
+            if (rate && !rate->energyLevels().empty()) {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    };
+
+    // Compare rate coefficients evaluated for all reactions at once with the
+    // integrals for individual reactions
+    auto check = [&](size_t nLevels) {
+        vector<double> levels(nLevels);
+        for (size_t j = 0; j < nLevels; j++) {
+            levels[j] = 10.0 * j / (nLevels - 1);
+        }
+        plasma->setElectronEnergyLevels(levels.data(), nLevels);
+        vector<double> dist(nLevels);
+        plasma->getElectronEnergyDistribution(dist.data());
+        Eigen::Map<Eigen::ArrayXd> eps(levels.data(), nLevels);
+        Eigen::Map<Eigen::ArrayXd> F(dist.data(), nLevels);
+
+        vector<double> kf(kin->nReactions());
+        kin->getFwdRateConstants(kf.data());
+        auto indices = plasmaReactions();
+        ASSERT_FALSE(indices.empty());
+        for (size_t i : indices) {
+            auto rate = std::dynamic_pointer_cast<ElectronCollisionPlasmaRate>(
+                kin->reaction(i)->rate());
+            Eigen::ArrayXd sigma(nLevels);
+            for (size_t j = 0; j < nLevels; j++) {
+                sigma[j] = linearInterp(levels[j], rate->energyLevels(),
+                                        rate->crossSections());
+            }
+            double expected = 0.5 * sqrt(2.0 * ElectronCharge / ElectronMass)
+                * Avogadro * simpson(F * sigma, eps.square());
+            EXPECT_NEAR(kf[i], expected, 1e-12 * expected) << nLevels << ", " << i;
+        }
+    };
+    check(41);
+
+    // Adding a reaction rebuilds the cross section matrix
+    size_t nPlasma = plasmaReactions().size();
+    kin->addReaction(newReaction(AnyMap::fromYamlString(
+        "{equation: O2 + E => E + O2,"
+        " type: electron-collision-plasma, duplicate: true,"
+        " energy-levels: [0.0, 0.5, 3.0, 12.0],"
+        " cross-sections: [0.0, 1.0e-20, 4.0e-20, 2.0e-20]}"), *kin));
+    size_t iNew = kin->nReactions() - 1;
+    ASSERT_EQ(plasmaReactions().size(), nPlasma + 1);
+    ASSERT_EQ(plasmaReactions().back(), iNew);
+    check(30);
+
+    // Joint evaluation of the new reaction matches its individual evaluation
+    auto rate = std::dynamic_pointer_cast<ElectronCollisionPlasmaRate>(
+        kin->reaction(iNew)->rate());
+    ElectronCollisionPlasmaData data;
+    data.update(*plasma, *kin);
+    vector<double> kf(kin->nReactions());
+    kin->getFwdRateConstants(kf.data());
+    double kNew = rate->evalFromStruct(data);
+    EXPECT_NEAR(kf[iNew], kNew, 1e-12 * kNew);
+
+    plasma->setMeanElectronEnergy(3.0);
+    check(30);
+}
+
+TEST(Kinetics, JointFalloffRates)
+{
+    // Falloff rates evaluated jointly by the Kinetics object match individual
+    // evaluation for all falloff parameterizations
+    for (auto& [infile, name] : vector<pair<string, string>>{
+        {"kineticsfromscratch.yaml", "ohmech"}, {"gri30.yaml", "gri30"}})
+    {
+        auto sol = newSolution(infile, name, "none");
+        auto gas = sol->thermo();
+        auto kin = sol->kinetics();
+        size_t nReactions = kin->nReactions();
+        vector<double> kf(nReactions), kf2(nReactions), work(nReactions);
+        for (auto [T, P] : vector<pair<double, double>>{
+            {300.0, OneAtm}, {1200.0, 1e4}, {2500.0, 50 * OneAtm}})
+        {
+            gas->setState_TPX(T, P, "H2:0.3, O2:0.5, H2O:0.1, AR:0.1");
+            kin->getFwdRateConstants(kf.data());
+            const auto& conc3b = kin->thirdBodyConcentrations();
+            size_t nFalloff = 0;
+            for (size_t i = 0; i < nReactions; i++) {
+                auto rate = std::dynamic_pointer_cast<FalloffRate>(
+                    kin->reaction(i)->rate());
+                if (!rate) {
+                    continue;
+                }
+                nFalloff++;
+                double k0 = rate->eval(T, conc3b[i]);
+                EXPECT_NEAR(kf[i], k0, 1e-12 * k0) << infile << ", " << i;
+            }
+            EXPECT_GT(nFalloff, 0u);
+
+            // Rate constants are restored after evaluating numerical derivatives
+            kin->getFwdRatesOfProgress_ddT(work.data());
+            kin->getFwdRatesOfProgress_ddC(work.data());
+            kin->getFwdRateConstants(kf2.data());
+            for (size_t i = 0; i < nReactions; i++) {
+                EXPECT_DOUBLE_EQ(kf2[i], kf[i]) << infile << ", " << i;
+            }
+        }
+    }
+}
+
+TEST(Kinetics, ThirdBodyConcentrations)
+{
+    auto sol = newSolution("gri30.yaml", "", "none");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    kin->addReaction(newReaction(AnyMap::fromYamlString(
+        "{equation: O + O + M <=> O2 + M, duplicate: true,"
+        " rate-constant: {A: 1.0e+11, b: -1.0, Ea: 0.0},"
+        " default-efficiency: 0.5, efficiencies: {AR: 0.8, H2O: 12.0}}"), *kin));
+    gas->setState_TPX(1500.0, OneAtm, "H2:0.3, O2:0.5, H2O:0.1, AR:0.1");
+    vector<double> conc(gas->nSpecies());
+    gas->getConcentrations(conc.data());
+    vector<double> concm(kin->nReactions());
+    kin->getThirdBodyConcentrations(concm.data());
+    size_t nThirdBody = 0;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto tbody = kin->reaction(i)->thirdBody();
+        if (!tbody) {
+            continue;
+        }
+        nThirdBody++;
+        double expected = 0.0;
+        for (size_t k = 0; k < gas->nSpecies(); k++) {
+            expected += tbody->efficiency(gas->speciesName(k)) * conc[k];
+        }
+        EXPECT_NEAR(concm[i], expected, 1e-14 * expected) << i;
+    }
+    EXPECT_GT(nThirdBody, 20u);
+}
+
+TEST(Kinetics, FusedNetProductionRates)
+{
+    for (string mech : {"gri30.yaml", "explicit-forward-order.yaml",
+                        "frac.yaml"}) {
+        auto soln = newSolution(mech);
+        auto thermo = soln->thermo();
+        auto& kin = dynamic_cast<BulkKinetics&>(*soln->kinetics());
+        size_t nsp = thermo->nSpecies();
+        size_t nr = kin.nReactions();
+        vector<double> Y(nsp);
+        for (size_t k = 0; k < nsp; k++) {
+            Y[k] = 1.0 + k % 5;
+        }
+        // Negative concentrations of the first species
+        Y[0] = -0.01;
+        thermo->setState_TP(1200, OneAtm);
+        thermo->setMassFractions_NoNorm(Y.data());
+
+        for (int pass = 0; pass < 2; pass++) {
+            vector<double> wdot(nsp), cdot(nsp), ddot(nsp), ropnet(nr);
+            kin.getNetProductionRates(wdot.data());
+            kin.getCreationRates(cdot.data());
+            kin.getDestructionRates(ddot.data());
+            kin.getNetRatesOfProgress(ropnet.data());
+            Eigen::SparseMatrix<double> nu = kin.productStoichCoeffs()
+                - kin.reactantStoichCoeffs();
+            Eigen::VectorXd ref = nu * Eigen::Map<Eigen::VectorXd>(ropnet.data(), nr);
+            double scale = ref.cwiseAbs().maxCoeff();
+            for (size_t k = 0; k < nsp; k++) {
+                EXPECT_NEAR(wdot[k], ref[k], 1e-12 * scale) << mech << ", " << k;
+                EXPECT_NEAR(wdot[k], cdot[k] - ddot[k], 1e-12 * scale) << mech;
+            }
+            // Restrict evaluation to every other reaction
+            vector<bool> active(nr);
+            for (size_t i = 0; i < nr; i += 2) {
+                active[i] = true;
+            }
+            kin.setActiveReactions(active);
+        }
+    }
+}
+
 TEST(Reaction, PythonExtensibleRate)
 {
     #ifdef CT_SKIP_PYTHON // Possibly set via test/SConscript
@@ -993,3 +1191,349 @@ TEST_F(ReactionToYaml, BlowersMaselInterface)
     EXPECT_TRUE(std::dynamic_pointer_cast<InterfaceBlowersMaselRate>(duplicate->rate()));
     compareReactions();
 }
+
+TEST(MechanismReducer, DRGEP)
+{
+    auto soln = newSolution("gri30.yaml", "gri30", "none");
+    soln->thermo()->setState_TPX(1500, OneAtm,
+                                 "CH4:1.0, O2:2.0, N2:7.52, H:1e-4, OH:1e-4");
+    auto& kin = *soln->kinetics();
+    MechanismReducer reducer(kin);
+    EXPECT_EQ(reducer.method(), "DRGEP");
+    EXPECT_THROW(reducer.update(), CanteraError);
+    EXPECT_THROW(reducer.setThreshold(1.5), CanteraError);
+    EXPECT_THROW(reducer.setTargets({"XYZ"}), CanteraError);
+    EXPECT_THROW(reducer.setMethod("DRG2"), CanteraError);
+
+    reducer.setTargets({"CH4", "O2"});
+    reducer.setThreshold(1e-2);
+    reducer.update();
+    size_t iCH4 = kin.kineticsSpeciesIndex("CH4");
+    EXPECT_DOUBLE_EQ(reducer.importance()[iCH4], 1.0);
+    EXPECT_TRUE(reducer.speciesActive(iCH4));
+    size_t nActive = reducer.nActiveReactions();
+    EXPECT_GT(nActive, 0u);
+    EXPECT_LT(nActive, kin.nReactions());
+    EXPECT_LT(reducer.nActiveSpecies(), kin.nTotalSpecies());
+    for (size_t k = 0; k < kin.nTotalSpecies(); k++) {
+        EXPECT_LE(reducer.importance()[k], 1.0);
+    }
+
+    // Deactivated reactions are skipped until restored
+    auto& bulk = dynamic_cast<BulkKinetics&>(kin);
+    vector<double> ropFull(kin.nReactions()), rop(kin.nReactions());
+    kin.getNetRatesOfProgress(ropFull.data());
+    reducer.apply();
+    EXPECT_TRUE(reducer.applied());
+    EXPECT_EQ(bulk.nActiveReactions(), nActive);
+    kin.getNetRatesOfProgress(rop.data());
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        EXPECT_DOUBLE_EQ(rop[i], reducer.reactionActive(i) ? ropFull[i] : 0.0);
+    }
+    reducer.restore();
+    EXPECT_FALSE(reducer.applied());
+    EXPECT_TRUE(bulk.activeReactions().empty());
+    EXPECT_EQ(bulk.nActiveReactions(), kin.nReactions());
+
+    // A lower threshold retains more reactions
+    reducer.setThreshold(1e-4);
+    EXPECT_TRUE(reducer.update());
+    EXPECT_GT(reducer.nActiveReactions(), nActive);
+}
+
+TEST(MechanismReducer, DRG)
+{
+    auto soln = newSolution("gri30.yaml", "gri30", "none");
+    soln->thermo()->setState_TPX(1500, OneAtm,
+                                 "CH4:1.0, O2:2.0, N2:7.52, H:1e-4, OH:1e-4");
+    auto& kin = *soln->kinetics();
+    MechanismReducer reducer(kin);
+    reducer.setMethod("DRG");
+    reducer.setTargets({"CH4", "O2"});
+    reducer.setThreshold(1e-2);
+    reducer.update();
+    for (size_t k = 0; k < kin.nTotalSpecies(); k++) {
+        double R = reducer.importance()[k];
+        EXPECT_TRUE(R == 0.0 || R == 1.0);
+    }
+    EXPECT_LT(reducer.nActiveReactions(), kin.nReactions());
+}
+
+TEST(MechanismReducer, OpposingRates)
+{
+    // Contributions of reactions with opposing rates cancel for DRGEP, but not
+    // for DRG
+    AnyMap root = AnyMap::fromYamlString(R"(
+        phases:
+        - {name: gas, thermo: ideal-gas, elements: [H], species: [A, B, C],
+           kinetics: gas, state: {T: 300, P: 1 atm, X: {A: 1.0, B: 1.0, C: 1.0}}}
+        species:
+        - {name: A, composition: {H: 2}, thermo: {model: constant-cp}}
+        - {name: B, composition: {H: 2}, thermo: {model: constant-cp}}
+        - {name: C, composition: {H: 2}, thermo: {model: constant-cp}}
+        reactions:
+        - {equation: A => B, rate-constant: {A: 1.0, b: 0, Ea: 0}}
+        - {equation: B => A, rate-constant: {A: 1.0, b: 0, Ea: 0}}
+        - {equation: A => C, rate-constant: {A: 0.1, b: 0, Ea: 0}}
+    )");
+    auto soln = newSolution(root["phases"].asVector<AnyMap>()[0], root);
+    auto& kin = *soln->kinetics();
+    size_t kB = kin.kineticsSpeciesIndex("B");
+    size_t kC = kin.kineticsSpeciesIndex("C");
+    MechanismReducer reducer(kin);
+    reducer.setTargets({"A"});
+    reducer.setThreshold(0.05);
+    reducer.update();
+    EXPECT_DOUBLE_EQ(reducer.importance()[kB], 0.0);
+    EXPECT_NEAR(reducer.importance()[kC], 0.1 / 1.1, 1e-14);
+
+    reducer.setMethod("DRG");
+    reducer.update();
+    EXPECT_DOUBLE_EQ(reducer.importance()[kB], 1.0);
+    EXPECT_DOUBLE_EQ(reducer.importance()[kC], 0.0);
+}
+
+TEST(BulkKinetics, ActiveReactions)
+{
+    auto soln = newSolution("gri30.yaml", "gri30", "none");
+    soln->thermo()->setState_TPX(1500, OneAtm, "CH4:1.0, O2:2.0, N2:7.52, OH:1e-4");
+    auto& kin = dynamic_cast<BulkKinetics&>(*soln->kinetics());
+    size_t nr = kin.nReactions();
+    vector<double> kf0(nr), ropf0(nr), ropr0(nr), kf(nr), ropf(nr), ropr(nr);
+    kin.getFwdRateConstants(kf0.data());
+    kin.getFwdRatesOfProgress(ropf0.data());
+    kin.getRevRatesOfProgress(ropr0.data());
+    EXPECT_EQ(kin.nActiveReactions(), nr);
+    EXPECT_THROW(kin.setActiveReactions(vector<bool>(nr + 1)), CanteraError);
+
+    // Reactions can be deactivated explicitly
+    vector<bool> active(nr, true);
+    for (size_t i = 0; i < nr; i += 3) {
+        active[i] = false;
+    }
+    kin.setActiveReactions(active);
+    kin.getFwdRateConstants(kf.data());
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.getRevRatesOfProgress(ropr.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kf[i], active[i] ? kf0[i] : 0.0);
+        EXPECT_DOUBLE_EQ(ropf[i], active[i] ? ropf0[i] : 0.0);
+        EXPECT_DOUBLE_EQ(ropr[i], active[i] ? ropr0[i] : 0.0);
+    }
+
+    // Changes of state update active reactions only
+    soln->thermo()->setState_TP(1600, 2 * OneAtm);
+    kin.getFwdRatesOfProgress(ropf.data());
+    kin.setActiveReactions({});
+    kin.getFwdRatesOfProgress(ropf0.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf[i], active[i] ? ropf0[i] : 0.0);
+    }
+
+    // A threshold of zero skips only reactions with zero rates of progress
+    kin.getNetRatesOfProgress(ropf0.data());
+    kin.setSkipThreshold(0.0);
+    EXPECT_LT(kin.nActiveReactions(), nr);
+    EXPECT_GT(kin.nActiveReactions(), 0u);
+    kin.getNetRatesOfProgress(ropf.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf[i], ropf0[i]);
+    }
+
+    // Skipped reactions are excluded from rate constants, but derivatives are
+    // evaluated for all reactions
+    kin.getFwdRateConstants(kf.data());
+    auto jac = kin.netRatesOfProgress_ddCi();
+    vector<double> ddT(nr);
+    kin.getNetRatesOfProgress_ddT(ddT.data());
+    EXPECT_LT(kin.nActiveReactions(), nr);
+    kin.setSkipThreshold(-1.0);
+    kin.getFwdRateConstants(kf0.data());
+    auto jac0 = kin.netRatesOfProgress_ddCi();
+    vector<double> ddT0(nr);
+    kin.getNetRatesOfProgress_ddT(ddT0.data());
+    kin.setSkipThreshold(0.0);
+    size_t nSkipped = 0;
+    for (size_t i = 0; i < nr; i++) {
+        if (kf[i] == 0.0) {
+            nSkipped++;
+        } else {
+            EXPECT_DOUBLE_EQ(kf[i], kf0[i]);
+        }
+        EXPECT_DOUBLE_EQ(ddT[i], ddT0[i]);
+    }
+    EXPECT_GT(nSkipped, 0u);
+    size_t nSkippedEntries = 0;
+    for (int k = 0; k < jac0.outerSize(); k++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(jac0, k); it; ++it) {
+            EXPECT_DOUBLE_EQ(jac.coeff(it.row(), it.col()), it.value());
+            nSkippedEntries += (kf[it.row()] == 0.0 && it.value() != 0.0);
+        }
+    }
+    EXPECT_GT(nSkippedEntries, 0u);
+
+    // Reactions deactivated explicitly do not contribute to derivatives
+    kin.setActiveReactions(active);
+    jac = kin.netRatesOfProgress_ddCi();
+    kin.getNetRatesOfProgress_ddT(ddT.data());
+    for (size_t i = 0; i < nr; i++) {
+        if (!active[i]) {
+            EXPECT_EQ(ddT[i], 0.0);
+            EXPECT_EQ(jac.row(i).norm(), 0.0);
+        }
+    }
+    kin.setActiveReactions({});
+
+    // Active reactions follow the composition
+    size_t nActive = kin.nActiveReactions();
+    soln->thermo()->setState_TPX(1500, OneAtm, "CH4:1.0, O2:2.0, N2:7.52, OH:1e-4, "
+                                 "H:1e-4, O:1e-4, H2:1e-4, H2O:1e-3, CO:1e-4");
+    EXPECT_GT(kin.nActiveReactions(), nActive);
+    kin.getNetRatesOfProgress(ropf.data());
+    kin.setSkipThreshold(-1.0);
+    kin.getNetRatesOfProgress(ropf0.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(ropf[i], ropf0[i]);
+    }
+}
+
+TEST(Kinetics, ClearReactionInput)
+{
+    auto soln = newSolution("h2o2.yaml", "", "none");
+    auto kin = soln->kinetics();
+    AnyMap rxn = AnyMap::fromYamlString(
+        "{equation: O + H2 <=> H + OH,"
+        " rate-constant: {A: 3.87e+04, b: 2.7, Ea: 6260.0},"
+        " note: user-defined field}");
+    kin->addReaction(newReaction(rxn, *kin));
+    size_t nr = kin->nReactions();
+    vector<AnyMap> before(nr);
+    for (size_t i = 0; i < nr; i++) {
+        before[i] = kin->reaction(i)->parameters(false);
+    }
+    EXPECT_TRUE(kin->reaction(nr - 1)->parameters().hasKey("note"));
+
+    kin->clearReactionInput();
+    for (size_t i = 0; i < nr; i++) {
+        auto R = kin->reaction(i);
+        EXPECT_TRUE(R->input.empty());
+        EXPECT_EQ(R->parameters(), before[i]) << R->equation();
+    }
+    EXPECT_FALSE(kin->reaction(nr - 1)->parameters().hasKey("note"));
+
+    // Reactions can still be reconstructed from their serialized parameters
+    auto params = kin->reaction(0)->parameters();
+    auto R0 = newReaction(AnyMap::fromYamlString(params.toYamlString()), *kin);
+    EXPECT_EQ(R0->equation(), kin->reaction(0)->equation());
+}
+
+TEST(Kinetics, ParallelLoading)
+{
+    // Species and reactions are constructed concurrently for large mechanisms, but
+    // are added in input order and match objects constructed sequentially
+    auto soln = newSolution("nDodecane_Reitz.yaml", "", "none");
+    auto thermo = soln->thermo();
+    auto kin = soln->kinetics();
+    AnyMap root = AnyMap::fromYamlFile("nDodecane_Reitz.yaml");
+    auto& speciesNodes = root["species"].asVector<AnyMap>();
+    ASSERT_EQ(thermo->nSpecies(), speciesNodes.size());
+    for (size_t k = 0; k < thermo->nSpecies(); k++) {
+        auto S = newSpecies(speciesNodes[k]);
+        EXPECT_EQ(thermo->speciesName(k), S->name);
+        EXPECT_EQ(thermo->species(k)->parameters(thermo.get()),
+                  S->parameters(thermo.get())) << S->name;
+    }
+    auto& reactionNodes = root["reactions"].asVector<AnyMap>();
+    ASSERT_EQ(kin->nReactions(), reactionNodes.size());
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto R = newReaction(reactionNodes[i], *kin);
+        EXPECT_EQ(kin->reaction(i)->parameters(), R->parameters()) << i;
+    }
+}
+
+TEST(InterfaceKinetics, SolvePseudoSteadyState)
+{
+    // The diamond mechanism uses the analytic Jacobian, while ptcombust.yaml contains
+    // coverage-dependent reactions, which require a finite difference Jacobian
+    vector<vector<string>> cases = {
+        {"diamond.yaml", "diamond_100", "H:0.002, H2:0.988, CH3:0.0002, CH4:0.01"},
+        {"ptcombust.yaml", "Pt_surf", "CH4:0.095, O2:0.21, AR:0.79"}};
+    for (const auto& c : cases) {
+        const string& mech = c[0];
+        auto surf = newInterface(mech, c[1]);
+        auto gas = surf->adjacent(0)->thermo();
+        gas->setState_TPX(1200.0, OneAtm, c[2]);
+        surf->thermo()->setTemperature(1200.0);
+        auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(surf->kinetics());
+        auto surfPhase = std::dynamic_pointer_cast<SurfPhase>(surf->thermo());
+        vector<double> cov0(surfPhase->nSpecies());
+        surfPhase->getCoverages(cov0.data());
+        ImplicitSurfChem surfChem({kin.get()});
+        for (int bulkFunc : {BULK_DEPOSITION, BULK_ETCH}) {
+            // BULK_DEPOSITION always uses the finite difference Jacobian
+            surfPhase->setCoverages(cov0.data());
+            solveSP solver(&surfChem, bulkFunc);
+            ASSERT_EQ(solver.solveSurfProb(SFLUX_INITIALIZE, 1.0, 1200.0, OneAtm,
+                                           1e-6, 1e-20), 1) << mech;
+            bool analytic = (bulkFunc == BULK_ETCH && mech == "diamond.yaml");
+            EXPECT_GT(solver.nJacEvals(analytic), 0) << mech;
+            EXPECT_EQ(solver.nJacEvals(!analytic), 0) << mech;
+        }
+        kin->solvePseudoSteadyStateProblem();
+
+        size_t nsp = surf->thermo()->nSpecies();
+        vector<double> wdot(kin->nTotalSpecies()), cov(nsp);
+        kin->getNetProductionRates(wdot.data());
+        surf->thermo()->getCoverages(cov.data());
+        double sdot_max = 0.0;
+        for (size_t k = 0; k < kin->nTotalSpecies(); k++) {
+            sdot_max = std::max(sdot_max, std::abs(wdot[k]));
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(wdot[k], 0.0, 1e-6 * sdot_max) << mech << ": " << k;
+            EXPECT_GE(cov[k], 0.0);
+        }
+        EXPECT_NEAR(std::accumulate(cov.begin(), cov.end(), 0.0), 1.0, 1e-8);
+    }
+}
+
+TEST(InterfaceKinetics, CoverageDependencies)
+{
+    // Coverage terms of all reactions are evaluated jointly; compare ratios of rate
+    // constants at two sets of coverages with the individual dependencies
+    auto surf = newInterface("surface-phases.yaml", "Pt-multi-sites");
+    auto thermo = std::dynamic_pointer_cast<SurfPhase>(surf->thermo());
+    auto kin = surf->kinetics();
+    thermo->setTemperature(900.0);
+    double RT = GasConstant * 900.0;
+    vector<double> kf1(kin->nReactions()), kf2(kin->nReactions());
+    auto ratios = [&](const string& cov1, const string& cov2) {
+        thermo->setCoveragesByName(cov1);
+        kin->getFwdRateConstants(kf1.data());
+        thermo->setCoveragesByName(cov2);
+        kin->getFwdRateConstants(kf2.data());
+    };
+    ratios("Pt(s):0.5, H(s):0.2, O(s):0.3", "Pt(s):0.5, H(s):0.4, O(s):0.1");
+
+    // linear activation energy dependence for '2 H(s) => H2 + 2 Pt(s)'
+    EXPECT_NEAR(kf1[1] / kf2[1], exp(6.0e6 * (0.2 - 0.4) / RT), 1e-12);
+    // polynomial activation energy dependence for '2 O(s) <=> O2(s)'
+    vector<double> E{0.0, 1.0e6, 3.0e6, -7.0e7, 5.0e6};
+    double expected = exp(-(poly4(0.3, E.data()) - poly4(0.1, E.data())) / RT);
+    EXPECT_NEAR(kf1[3] / kf2[3], expected, 1e-12 * expected);
+    // reactions without coverage dependencies
+    EXPECT_DOUBLE_EQ(kf1[0], kf2[0]);
+    EXPECT_DOUBLE_EQ(kf1[2], kf2[2]);
+
+    // replaced rates use updated coverage dependencies
+    shared_ptr<Reaction> rxn = newReaction(AnyMap::fromYamlString(
+        "{equation: 2 H(s) => H2 + 2 Pt(s),"
+        " rate-constant: {A: 3.7e21 cm^2/mol/s, b: 0, Ea: 67400 J/mol},"
+        " coverage-dependencies: {H(s): {a: 0.5, m: 1.0, E: 0 J/mol},"
+        "                         O(s): {a: 0, m: 0, E: 2000 J/mol}}}"), *kin);
+    kin->modifyReaction(1, rxn);
+    ratios("Pt(s):0.5, H(s):0.2, O(s):0.3", "Pt(s):0.5, H(s):0.4, O(s):0.1");
+    expected = pow(10.0, 0.5 * (0.2 - 0.4)) * (0.2 / 0.4)
+        * exp(-2.0e6 * (0.3 - 0.1) / RT);
+    EXPECT_NEAR(kf1[1] / kf2[1], expected, 1e-12 * expected);
+}
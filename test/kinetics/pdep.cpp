@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/base/Solution.h"
 #include "cantera/base/global.h"
@@ -219,6 +220,33 @@ TEST_F(PdepTest, ChebyshevEdgeCases)
     EXPECT_NEAR(3.354054351e+07, kf[4], 1e-1);
 }
 
+TEST_F(PdepTest, JointEvaluation)
+{
+    // Rates evaluated jointly by the Kinetics object match individual evaluation
+    auto kin = soln_->kinetics();
+    vector<double> kf(7), dkdT(7), dkdP(7);
+    for (double P : {1e-7, 500.0, 101325.0, 20 * 101325.0, 1e10}) {
+        for (double T : {400.0, 900.0, 1800.0}) {
+            set_TP(T, P);
+            kin->getFwdRateConstants(kf.data());
+            kin->getFwdRateConstants_ddT(dkdT.data());
+            kin->getFwdRateConstants_ddP(dkdP.data());
+            for (size_t i = 0; i < 7; i++) {
+                auto rate = kin->reaction(i)->rate();
+                double k0 = rate->eval(T, P);
+                EXPECT_NEAR(kf[i], k0, 1e-12 * k0) << i << ", " << T << ", " << P;
+                // Derivatives are evaluated numerically by the Kinetics object
+                double dT = 1e-6 * T;
+                double dkdT0 = (rate->eval(T + dT, P) - rate->eval(T - dT, P)) / (2 * dT);
+                EXPECT_NEAR(dkdT[i], dkdT0, 1e-3 * std::abs(dkdT0) + 1e-12 * k0 / T);
+                double dP = 1e-6 * P;
+                double dkdP0 = (rate->eval(T, P + dP) - k0) / dP;
+                EXPECT_NEAR(dkdP[i], dkdP0, 1e-3 * std::abs(dkdP0) + 1e-12 * k0 / P);
+            }
+        }
+    }
+}
+
 } // namespace Cantera
 
 int main(int argc, char** argv)
@@ -71,8 +71,9 @@ TEST_F(FracCoeffTest, RatesOfProgress)
     kin->getFwdRatesOfProgress(&ropf[0]);
 
     EXPECT_DOUBLE_EQ(conc[kH2O]*kf[0], ropf[0]);
-    EXPECT_DOUBLE_EQ(pow(conc[kH2], 0.8)*conc[kO2]*pow(conc[kOH],2)*kf[1],
-                     ropf[1]);
+    // concentration products with fractional orders are evaluated in log space
+    double expected = pow(conc[kH2], 0.8)*conc[kO2]*pow(conc[kOH],2)*kf[1];
+    EXPECT_NEAR(expected, ropf[1], 1e-13 * expected);
 }
 
 TEST_F(FracCoeffTest, CreationDestructionRates)
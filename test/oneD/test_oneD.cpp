@@ -7,6 +7,7 @@
 #include "cantera/oneD/DomainFactory.h"
 #include "cantera/oneD/StFlow.h"
 #include "cantera/oneD/IonFlow.h"
+#include "cantera/base/SolutionArray.h"
 
 using namespace Cantera;
 
@@ -220,6 +221,94 @@ TEST(onedim, ion_flame_types)
     ASSERT_EQ(burner->type(), "unstrained-ion-flow");
 }
 
+TEST(onedim, brute_force_sensitivity)
+{
+    string X = "H2:0.65, O2:0.5, AR:2";
+    auto factory = [X](shared_ptr<Solution> sol) {
+        auto gas = sol->thermo();
+        size_t nsp = gas->nSpecies();
+        double uin = .3;
+        double T = gas->temperature();
+        double rho_in = gas->density();
+        vector<double> yin(nsp), yout(nsp), state;
+        gas->getMassFractions(yin.data());
+        gas->saveState(state);
+        gas->equilibrate("HP");
+        gas->getMassFractions(yout.data());
+        double rho_out = gas->density();
+        double Tad = gas->temperature();
+        gas->restoreState(state);
+
+        auto flow = newDomain<Flow1D>("free-flow", sol, "flow");
+        int nz = 21;
+        vector<double> z(nz);
+        for (int iz = 0; iz < nz; iz++) {
+            z[iz] = iz * 0.02 / (nz - 1);
+        }
+        flow->setupGrid(nz, z.data());
+        auto inlet = newDomain<Inlet1D>("inlet", sol);
+        inlet->setMoleFractions(X);
+        inlet->setMdot(uin * rho_in);
+        inlet->setTemperature(T);
+        auto outlet = newDomain<Outlet1D>("outlet", sol);
+        double uout = inlet->mdot() / rho_out;
+
+        vector<shared_ptr<Domain1D>> domains { inlet, flow, outlet };
+        auto flame = make_shared<Sim1D>(domains);
+        vector<double> locs{0.0, 0.3, 0.7, 1.0};
+        vector<double> value{uin, uin, uout, uout};
+        flame->setInitialGuess("velocity", locs, value);
+        value = {T, T, Tad, Tad};
+        flame->setInitialGuess("T", locs, value);
+        for (size_t i = 0; i < nsp; i++) {
+            value = {yin[i], yin[i], yout[i], yout[i]};
+            flame->setInitialGuess(gas->speciesName(i), locs, value);
+        }
+        flame->setFixedTemperature(0.85 * T + .15 * Tad);
+        flow->solveEnergyEqn();
+        flow->setSteadyTolerances(1e-8, 1e-14);
+        return flame;
+    };
+
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    sol->thermo()->setState_TPX(300, OneAtm, X);
+    Sim1DSensitivity sens(sol, factory);
+    sens.addFlameSpeed();
+    sens.setRefineGrid(false);
+    sens.setPerturbation(0.05);
+    sens.setReactions({9, 10});
+    sens.setMaxThreads(1);
+    auto arr = sens.compute();
+    ASSERT_EQ(arr->size(), 2);
+    EXPECT_EQ(arr->meta()["failed-runs"].asInt(), 0);
+
+    // Distributing the perturbed runs over two threads should not change the results
+    sens.setMaxThreads(2);
+    auto arr2 = sens.compute();
+    ASSERT_EQ(arr2->size(), 2);
+    EXPECT_EQ(arr2->meta()["failed-runs"].asInt(), 0);
+    auto Su1 = arr->getComponent("flame-speed").asVector<double>();
+    auto Su2 = arr2->getComponent("flame-speed").asVector<double>();
+    for (size_t i = 0; i < 2; i++) {
+        EXPECT_NEAR(Su2[i], Su1[i], 1e-6 * std::abs(Su1[i])) << "reaction " << i;
+    }
+
+    // The warm-started perturbed solution should match a solution started from
+    // the initial guess
+    auto flame = factory(sol);
+    flame->solve(0, false);
+    size_t iu = flame->domain(1).componentIndex("velocity");
+    double Su0 = flame->value(1, iu, 0);
+    EXPECT_NEAR(sens.baseValues()[0], Su0, 1e-6);
+    sol->thermo()->setState_TPX(300, OneAtm, X);
+    sol->kinetics()->setMultiplier(9, 1.05);
+    flame = factory(sol);
+    flame->solve(0, false);
+    double ref = (flame->value(1, iu, 0) - Su0) / (Su0 * 0.05);
+    EXPECT_NEAR(arr->getComponent("flame-speed").asVector<double>()[0], ref,
+                1e-2 * std::abs(ref));
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_oneD.cpp\n");
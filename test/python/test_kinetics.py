@@ -1233,6 +1233,22 @@ class TestReaction:
         assert data['efficiencies'] == {'H2': 2.4, 'H2O': 15.4, 'AR': 0.83}
         assert data['equation'] == R.equation
 
+    def test_clear_reaction_input(self):
+        gas = ct.Solution("h2o2.yaml", transport_model=None)
+        R = ct.Reaction.from_yaml('''
+            equation: O + H2 <=> H + OH
+            rate-constant: {A: 3.87e+04, b: 2.7, Ea: 6260.0}
+            note: user-defined field''', gas)
+        gas.add_reaction(R)
+        data = [r.input_data for r in gas.reactions()]
+        assert data[-1]['note'] == 'user-defined field'
+
+        gas.clear_reaction_input()
+        assert 'note' not in gas.reaction(gas.n_reactions - 1).input_data
+        for i, r in enumerate(gas.reactions()):
+            data[i].pop('note', None)
+            assert r.input_data == data[i]
+
     def test_input_data_from_scratch(self):
         r = ct.Reaction({"O": 1, "H2": 1}, {"H": 1, "OH": 1},
                         ct.ArrheniusRate(3.87e1, 2.7, 2.6e7))
@@ -1239,6 +1239,18 @@ class TestPlasmaPhase:
                            match='Only one electron species is allowed'):
             phase.add_species(electron)
 
+    def test_two_term_electron_energy_distribution(self):
+        phase = ct.Solution('oxygen-plasma.yaml', 'two-term-electron-energy-plasma')
+        assert phase.electron_energy_distribution_type == 'Boltzmann-two-term'
+        assert phase.reduced_electric_field == approx(1e-21)
+        Te1 = phase.Te
+        assert Te1 > phase.T
+        k1 = phase.forward_rate_constants[1]
+        phase.reduced_electric_field = 3e-21
+        assert phase.Te > Te1
+        assert phase.forward_rate_constants[1] > k1
+        assert min(phase.electron_energy_distribution) >= 0.0
+
 
 class TestImport:
     """
@@ -0,0 +1,209 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/EEDFTwoTermApproximation.h"
+#include "cantera/thermo/PlasmaPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/Reaction.h"
+#include "cantera/base/Solution.h"
+
+namespace Cantera
+{
+
+class EEDFTwoTermApproximation_Test : public testing::Test
+{
+public:
+    EEDFTwoTermApproximation_Test() {
+        levels = Eigen::ArrayXd::LinSpaced(401, 0.0, 10.0);
+        // Constant elastic momentum transfer cross section of a single target
+        solver.addCollision(0, "elastic", massRatio, 0.0, {0.0, 100.0},
+                            {sigma, sigma});
+    }
+
+    EEDFTwoTermApproximation solver;
+    Eigen::ArrayXd levels;
+    Eigen::ArrayXd dist;
+    double massRatio = 1e-5;
+    double sigma = 1e-19;
+    double x[1] = {1.0};
+};
+
+TEST_F(EEDFTwoTermApproximation_Test, maxwellian)
+{
+    // Without electric field, electrons are in equilibrium with the gas
+    double T = 10000;
+    double kT = Boltzmann * T / ElectronCharge;
+    EXPECT_TRUE(solver.solve(levels, 0.0, T, x, dist));
+    ASSERT_EQ(dist.size(), levels.size());
+    for (Eigen::Index i = 0; i < levels.size(); i += 40) {
+        EXPECT_NEAR(dist[i] / dist[0], exp(-levels[i] / kT), 1e-10);
+    }
+    // normalized Maxwellian distribution
+    EXPECT_NEAR(dist[0], 2.0 / sqrt(Pi) * pow(kT, -1.5), 1e-3 * dist[0]);
+}
+
+TEST_F(EEDFTwoTermApproximation_Test, druyvesteyn)
+{
+    // Druyvesteyn distribution for constant cross section and cold gas
+    double EN = 2e-21;
+    EXPECT_TRUE(solver.solve(levels, EN, 0.0, x, dist));
+    double c = 3.0 * massRatio * sigma * sigma / (EN * EN);
+    for (Eigen::Index i = 0; i < levels.size(); i += 40) {
+        double expected = exp(-c * levels[i] * levels[i]);
+        EXPECT_NEAR(dist[i] / dist[0], expected, 2e-3 * expected) << levels[i];
+    }
+}
+
+TEST_F(EEDFTwoTermApproximation_Test, tabulation)
+{
+    // Exact solutions at a grid point and between grid points
+    Eigen::ArrayXd dist1, dist2;
+    EXPECT_TRUE(solver.solve(levels, 1e-21, 300, x, dist1));
+    EXPECT_FALSE(solver.solve(levels, 1e-21, 300, x, dist));
+    EXPECT_TRUE(solver.solve(levels, 1.5e-21, 300, x, dist2));
+    EXPECT_GT(dist2[200], dist1[200]);
+
+    solver.setTabulation(20, 1e-3);
+    EXPECT_EQ(solver.tabulationPointsPerDecade(), 20u);
+    EXPECT_TRUE(solver.solve(levels, 1e-21, 300, x, dist));
+    for (Eigen::Index i = 0; i < levels.size(); i++) {
+        EXPECT_NEAR(dist[i], dist1[i], 1e-12 * dist1[0]);
+    }
+    // Interpolated between grid points
+    EXPECT_TRUE(solver.solve(levels, 1.5e-21, 300, x, dist));
+    for (Eigen::Index i = 0; i < 160; i++) {
+        EXPECT_NEAR(dist[i], dist2[i], 2e-2 * dist2[i]) << levels[i];
+    }
+
+    // Changes within the tolerance reuse the tabulated distributions
+    Eigen::ArrayXd dist3;
+    EXPECT_FALSE(solver.solve(levels, 1.5e-21, 300.1, x, dist3));
+    EXPECT_TRUE(solver.solve(levels, 1.5e-21, 301, x, dist3));
+    EXPECT_GT((dist3 - dist).abs().maxCoeff(), 0.0);
+
+    solver.setTabulation(0);
+    EXPECT_TRUE(solver.solve(levels, 1.5e-21, 300, x, dist));
+    for (Eigen::Index i = 0; i < levels.size(); i++) {
+        EXPECT_NEAR(dist[i], dist2[i], 1e-12 * dist2[0]);
+    }
+}
+
+TEST_F(EEDFTwoTermApproximation_Test, inelastic)
+{
+    Eigen::ArrayXd dist0;
+    double EN = 3e-21;
+    solver.solve(levels, EN, 300, x, dist0);
+    solver.addCollision(0, "excitation", massRatio, 2.0, {2.0, 3.0, 100.0},
+                        {0.0, 1e-20, 1e-20});
+    EXPECT_EQ(solver.nCollisions(), 2u);
+    EXPECT_TRUE(solver.solve(levels, EN, 300, x, dist));
+    EXPECT_GT(dist.minCoeff(), -1e-300);
+    // Energy losses by excitation deplete the high energy tail
+    EXPECT_LT(dist[300], dist0[300]);
+    EXPECT_GT(dist[0], dist0[0]);
+    Eigen::ArrayXd h = levels.tail(400) - levels.head(400);
+    Eigen::ArrayXd f = (levels.sqrt() * dist);
+    double norm = (0.5 * h * (f.head(400) + f.tail(400))).sum();
+    EXPECT_NEAR(norm, 1.0, 5e-3);
+    EXPECT_THROW(solver.addCollision(0, "recombination", 1e-5, 0.0, {0.0}, {0.0}),
+                 CanteraError);
+}
+
+TEST(PlasmaPhase, TwoTermBoltzmann)
+{
+    auto sol = newSolution("oxygen-plasma.yaml", "two-term-electron-energy-plasma");
+    auto phase = std::dynamic_pointer_cast<PlasmaPhase>(sol->thermo());
+    ASSERT_TRUE(phase);
+    EXPECT_EQ(phase->electronEnergyDistributionType(), "Boltzmann-two-term");
+    EXPECT_DOUBLE_EQ(phase->reducedElectricField(), 1e-21);
+    size_t nLevels = phase->nElectronEnergyLevels();
+    EXPECT_EQ(nLevels, 25u);
+    vector<double> dist(nLevels);
+    phase->getElectronEnergyDistribution(dist.data());
+    EXPECT_GT(dist[0], 0.0);
+    EXPECT_LT(dist.back(), 0.01 * dist[0]);
+    double Te1 = phase->electronTemperature();
+    EXPECT_GT(Te1, phase->temperature());
+
+    // Electron collision rates follow the distribution
+    auto kin = sol->kinetics();
+    vector<double> kf(kin->nReactions());
+    kin->getFwdRateConstants(kf.data());
+    int distNum = phase->distributionNumber();
+    phase->setReducedElectricField(2e-21);
+    EXPECT_EQ(phase->distributionNumber(), distNum + 1);
+    double Te2 = phase->electronTemperature();
+    EXPECT_GT(Te2, Te1);
+    vector<double> kf2(kin->nReactions());
+    kin->getFwdRateConstants(kf2.data());
+    EXPECT_GT(kf2[1], kf[1]);
+
+    // Unchanged target composition does not require a new solution
+    phase->setState_TP(phase->temperature(), 2 * phase->pressure());
+    EXPECT_EQ(phase->distributionNumber(), distNum + 1);
+    phase->setState_TP(phase->temperature() + 1000, phase->pressure());
+    EXPECT_EQ(phase->distributionNumber(), distNum + 2);
+    phase->setState_TP(phase->temperature() - 1000, phase->pressure());
+    EXPECT_NEAR(phase->electronTemperature(), Te2, 1e-12 * Te2);
+
+    AnyMap params = phase->parameters();
+    auto& eedf = params["electron-energy-distribution"];
+    EXPECT_EQ(eedf["type"].asString(), "Boltzmann-two-term");
+    EXPECT_TRUE(eedf.as<AnyMap>().hasKey("reduced-electric-field"));
+
+    auto copy = sol->clone();
+    auto phase2 = std::dynamic_pointer_cast<PlasmaPhase>(copy->thermo());
+    EXPECT_DOUBLE_EQ(phase2->reducedElectricField(), 2e-21);
+    EXPECT_NEAR(phase2->electronTemperature(), Te2, 1e-8 * Te2);
+
+    EXPECT_THROW(phase->setReducedElectricField(-1.0), CanteraError);
+}
+
+TEST(PlasmaPhase, TwoTermBoltzmannUpdates)
+{
+    auto sol = newSolution("oxygen-plasma.yaml", "two-term-electron-energy-plasma");
+    auto phase = std::dynamic_pointer_cast<PlasmaPhase>(sol->thermo());
+    double T = phase->temperature();
+    double P = phase->pressure();
+    double Te1 = phase->electronTemperature();
+    int distNum = phase->distributionNumber();
+
+    // The distribution is only recalculated once it is used, so intermediate
+    // states do not require a solution of the Boltzmann equation
+    phase->setState_TP(T + 1000, P);
+    phase->setState_TP(T + 500, P);
+    phase->setState_TP(T, P);
+    EXPECT_EQ(phase->distributionNumber(), distNum);
+    EXPECT_DOUBLE_EQ(phase->electronTemperature(), Te1);
+    phase->setState_TP(T + 500, P);
+    EXPECT_EQ(phase->distributionNumber(), distNum + 1);
+    phase->setState_TP(T, P);
+    EXPECT_NEAR(phase->electronTemperature(), Te1, 1e-12 * Te1);
+
+    // Tabulated distributions are reused for small changes of the temperature
+    phase->setElectronEnergyDistributionTabulation(20, 1e-3);
+    double Te2 = phase->electronTemperature();
+    EXPECT_NEAR(Te2, Te1, 1e-2 * Te1);
+    distNum = phase->distributionNumber();
+    phase->setState_TP(T * (1 + 1e-4), P);
+    EXPECT_EQ(phase->electronTemperature(), Te2);
+    EXPECT_EQ(phase->distributionNumber(), distNum);
+    phase->setElectronEnergyDistributionTabulation(0);
+
+    // Modified cross sections are detected even though the number of reactions is
+    // unchanged
+    auto kin = sol->kinetics();
+    size_t i = 0;
+    while (kin->reaction(i)->type() != "electron-collision-plasma") {
+        i++;
+    }
+    AnyMap rxn = kin->reaction(i)->parameters();
+    auto sigma = rxn["cross-sections"].asVector<double>();
+    for (auto& value : sigma) {
+        value *= 2.0;
+    }
+    rxn["cross-sections"] = sigma;
+    kin->modifyReaction(i, newReaction(rxn, *kin));
+    phase->setState_TP(T, P);
+    EXPECT_LT(phase->electronTemperature(), 0.99 * Te1);
+}
+
+}
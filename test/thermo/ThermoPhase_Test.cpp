@@ -92,6 +92,43 @@ TEST_F(TestThermoMethods, setState_AnyMap)
     EXPECT_NEAR(thermo->temperature(), 298.15, 1e-6);
 }
 
+TEST_F(TestThermoMethods, setState_HP_UV_roundtrip)
+{
+    // h2o2.yaml uses NASA polynomials for all species, so IdealGasPhase finds
+    // the temperature using the mixture polynomial
+    thermo->setMassFractionsByName("H2:0.1, O2:0.6, H2O:0.2, AR:0.1");
+    for (double T : {310.0, 999.0, 1000.0, 1850.0, 2900.0}) {
+        thermo->setState_TP(T, 2 * OneAtm);
+        double h = thermo->enthalpy_mass();
+        double u = thermo->intEnergy_mass();
+        double v = 1.0 / thermo->density();
+
+        thermo->setState_TP(600, OneAtm);
+        thermo->setState_HP(h, 2 * OneAtm);
+        EXPECT_NEAR(thermo->temperature(), T, 1e-6 * T);
+        EXPECT_DOUBLE_EQ(thermo->pressure(), 2 * OneAtm);
+        EXPECT_NEAR(thermo->enthalpy_mass(), h, 1e-8 * std::abs(h) + 1e-3);
+
+        thermo->setState_TP(2500, OneAtm);
+        thermo->setState_UV(u, v);
+        EXPECT_NEAR(thermo->temperature(), T, 1e-6 * T);
+        EXPECT_NEAR(thermo->density(), 1.0 / v, 1e-12 / v);
+        EXPECT_NEAR(thermo->intEnergy_mass(), u, 1e-8 * std::abs(u) + 1e-3);
+    }
+}
+
+TEST(ThermoPhase, setState_HP_nonNasa)
+{
+    // Species using NASA9 polynomials use the general iteration
+    auto gas = newThermo("gasNASA9.yaml", "nasa9");
+    gas->setMoleFractionsByName("H2:0.5, H2_NASA9:0.3, H2_NASA9_4REG:0.2");
+    gas->setState_TP(1234, OneAtm);
+    double h = gas->enthalpy_mass();
+    gas->setState_TP(500, OneAtm);
+    gas->setState_HP(h, OneAtm);
+    EXPECT_NEAR(gas->temperature(), 1234, 1e-5);
+}
+
 TEST_F(TestThermoMethods, setConcentrations)
 {
     vector<double> C0(thermo->nSpecies());
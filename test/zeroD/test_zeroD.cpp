@@ -3,6 +3,7 @@
 #include "cantera/kinetics.h"
 #include "cantera/zerodim.h"
 #include "cantera/base/Interface.h"
+#include "cantera/base/SolutionArray.h"
 #include "cantera/numerics/eigen_sparse.h"
 #include "cantera/numerics/PreconditionerFactory.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
@@ -208,6 +209,399 @@ TEST(AdaptivePreconditionerTests, test_precon_solver_stats)
     EXPECT_GE(stats["nonlinear_conv_fails"].asInt(), 0);
 }
 
+TEST(IsatTable, retrieve_and_add)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    string X0 = "H2:2.0, O2:1.0, AR:7.0";
+    IdealGasReactor reactor(sol);
+    ReactorNet net;
+    net.addReactor(reactor);
+    IsatTable isat(net);
+    isat.setTolerance(1e-3);
+    double dt = 2e-5;
+
+    // reference solution obtained by direct integration
+    auto sol2 = newSolution("h2o2.yaml", "", "none");
+    IdealGasReactor reactor2(sol2);
+    ReactorNet net2;
+    net2.addReactor(reactor2);
+    auto direct = [&](double T) {
+        sol2->thermo()->setState_TPX(T, OneAtm, X0);
+        reactor2.syncState();
+        net2.setInitialTime(0.0);
+        net2.advance(dt);
+        vector<double> y(net2.neq());
+        net2.getState(y.data());
+        return y;
+    };
+    auto query = [&](double T) {
+        sol->thermo()->setState_TPX(T, OneAtm, X0);
+        reactor.syncState();
+        isat.advance(dt);
+        vector<double> y(net.neq());
+        net.getState(y.data());
+        return y;
+    };
+    size_t kT = reactor.componentIndex("temperature");
+    size_t kH2O = reactor.componentIndex("H2O");
+
+    // first query adds a record
+    auto r0 = query(1200.0);
+    EXPECT_NEAR(r0[kT], direct(1200.0)[kT], 1e-8);
+    EXPECT_EQ(isat.size(), 1u);
+
+    // identical states are retrieved exactly
+    EXPECT_NEAR(query(1200.0)[kT], r0[kT], 1e-8);
+
+    // nearby states are retrieved using the mapping gradient, which has to be
+    // much closer to the direct solution than the mapping of the stored record
+    auto ret = query(1200.5);
+    auto ref = direct(1200.5);
+    for (size_t k : {kT, kH2O}) {
+        ASSERT_GT(std::abs(r0[k] - ref[k]), 0.0);
+        EXPECT_LT(std::abs(ret[k] - ref[k]), 0.1 * std::abs(r0[k] - ref[k]));
+    }
+    AnyMap stats = isat.stats();
+    EXPECT_EQ(stats["queries"].asInt(), 3);
+    EXPECT_EQ(stats["retrieves"].asInt(), 2);
+    EXPECT_EQ(stats["direct_evals"].asInt(), 1);
+
+    // the first state outside the initial EOA is still accurately represented by
+    // the linear approximation, so the EOA is grown instead of adding a record
+    double dT = 1.0;
+    for (; dT < 100; dT *= 2) {
+        query(1200.0 + dT);
+        if (isat.stats()["direct_evals"].asInt() > 1) {
+            break;
+        }
+    }
+    stats = isat.stats();
+    EXPECT_EQ(stats["direct_evals"].asInt(), 2);
+    EXPECT_EQ(stats["grows"].asInt(), 1);
+    EXPECT_EQ(stats["adds"].asInt(), 1);
+    EXPECT_EQ(isat.size(), 1u);
+
+    // states inside the grown EOA are now retrieved
+    int nRetrieve = stats["retrieves"].asInt();
+    ret = query(1200.0 + 0.9 * dT);
+    ref = direct(1200.0 + 0.9 * dT);
+    EXPECT_NEAR(ret[kT], ref[kT], 1e-3 * 1200);
+    EXPECT_EQ(isat.stats()["retrieves"].asInt(), nRetrieve + 1);
+    EXPECT_EQ(isat.stats()["direct_evals"].asInt(), 2);
+
+    // distant states require direct evaluation and add a new record
+    EXPECT_NEAR(query(1500.0)[kT], direct(1500.0)[kT], 1e-8);
+    stats = isat.stats();
+    EXPECT_EQ(stats["direct_evals"].asInt(), 3);
+    EXPECT_EQ(stats["adds"].asInt(), 2);
+    EXPECT_EQ(isat.size(), 2u);
+
+    // table size limit evicts least recently used records
+    isat.setMaxSize(1);
+    EXPECT_EQ(isat.size(), 1u);
+    query(1800.0);
+    EXPECT_EQ(isat.size(), 1u);
+    EXPECT_NEAR(query(1800.0)[kT], direct(1800.0)[kT], 1e-3 * 1800);
+
+    // changing the interval clears the table
+    isat.advance(2 * dt);
+    EXPECT_EQ(isat.stats()["queries"].asInt(), 1);
+}
+
+TEST(AdaptiveChemistry, reactor_net)
+{
+    string X0 = "CH4:1.0, O2:2.0, N2:7.52";
+    double T0 = 1400;
+    auto sol1 = newSolution("gri30.yaml", "gri30", "none");
+    sol1->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor1(sol1);
+    ReactorNet net1;
+    net1.addReactor(reactor1);
+
+    auto sol2 = newSolution("gri30.yaml", "gri30", "none");
+    sol2->thermo()->setState_TPX(T0, OneAtm, X0);
+    IdealGasConstPressureReactor reactor2(sol2);
+    ReactorNet net2;
+    net2.addReactor(reactor2);
+
+    AnyMap settings;
+    settings["threshold"] = 1e-3;
+    EXPECT_THROW(net2.setAdaptiveChemistry(settings), CanteraError);
+    settings["targets"] = vector<string>{"CH4", "O2", "CO2", "H2O"};
+    settings["interval"] = 2e-5;
+    net2.setAdaptiveChemistry(settings);
+
+    // Ignition delay of the complete mechanism, defined as the time where the
+    // temperature first exceeds the initial temperature by 400 K
+    double dt = 1e-5;
+    auto crossingTime = [&](double T, double Tprev, double t) {
+        return t - dt * (T - T0 - 400) / (T - Tprev);
+    };
+    double tIgn1 = 0, Tprev = T0;
+    for (double t = dt; t < 2e-2 && !tIgn1; t += dt) {
+        net1.advance(t);
+        if (reactor1.temperature() > T0 + 400) {
+            tIgn1 = crossingTime(reactor1.temperature(), Tprev, t);
+        }
+        Tprev = reactor1.temperature();
+    }
+    ASSERT_GT(tIgn1, 0.0);
+
+    // Integrate the reduced mechanism through ignition, recording the number of
+    // active reactions after each update
+    auto& kin = *sol2->kinetics();
+    long int nTotal = static_cast<long int>(kin.nReactions());
+    vector<double> times;
+    vector<long int> nActive;
+    double tIgn2 = 0;
+    Tprev = T0;
+    for (double t = dt; t < 1.5 * tIgn1; t += dt) {
+        net2.advance(t);
+        if (!tIgn2 && reactor2.temperature() > T0 + 400) {
+            tIgn2 = crossingTime(reactor2.temperature(), Tprev, t);
+        }
+        Tprev = reactor2.temperature();
+        times.push_back(t);
+        nActive.push_back(
+            net2.adaptiveChemistryStats()["active_reactions"].asVector<long int>()[0]);
+    }
+    EXPECT_NEAR(tIgn2, tIgn1, 0.05 * tIgn1);
+
+    // The reduced mechanism is small during the early part of the induction
+    // period, where the radical pool is not yet established, and grows again
+    // as the mixture ignites.
+    long int nInduction = nTotal, nIgnition = 0;
+    for (size_t j = 0; j < times.size(); j++) {
+        if (times[j] < 0.2 * tIgn1) {
+            nInduction = std::min(nInduction, nActive[j]);
+        } else if (std::abs(times[j] - tIgn2) < 0.1 * tIgn1) {
+            nIgnition = std::max(nIgnition, nActive[j]);
+        }
+    }
+    EXPECT_GT(nInduction, 0);
+    EXPECT_LT(nInduction, nTotal);
+    EXPECT_GT(nIgnition, nInduction);
+
+    // The complete mechanism is restored after integration
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        EXPECT_DOUBLE_EQ(kin.multiplier(i), 1.0);
+    }
+
+    AnyMap stats = net2.adaptiveChemistryStats();
+    EXPECT_GE(stats["updates"].asInt(), static_cast<long int>(times.size()));
+
+    // Disabling adaptive chemistry
+    net2.setAdaptiveChemistry(AnyMap());
+    net2.advance(2 * tIgn1);
+    EXPECT_EQ(net2.adaptiveChemistryStats()["updates"].asInt(), 0);
+}
+
+class ReactorSensitivityTest : public testing::Test
+{
+public:
+    ReactorSensitivityTest() {
+        sol = newSolution("h2o2.yaml", "", "none");
+        sol->thermo()->setState_TPX(T0, OneAtm, X0);
+        reactor = make_unique<IdealGasReactor>(sol);
+        net.addReactor(*reactor);
+        for (size_t i : rxns) {
+            reactor->addSensitivityReaction(i);
+        }
+    }
+
+    //! Temperature at *tf* with the multiplier of reaction *i* set to *multiplier*.
+    //! If *dTdt* is given, it is set to the rate of change of the temperature.
+    double solveT(size_t i, double multiplier, double* dTdt=nullptr) {
+        auto sol2 = newSolution("h2o2.yaml", "", "none");
+        sol2->thermo()->setState_TPX(T0, OneAtm, X0);
+        sol2->kinetics()->setMultiplier(i, multiplier);
+        IdealGasReactor reactor2(sol2);
+        ReactorNet net2;
+        net2.addReactor(reactor2);
+        net2.advance(tf);
+        if (dTdt) {
+            vector<double> ydot(net2.neq());
+            net2.getDerivative(1, ydot.data());
+            *dTdt = ydot[reactor2.componentIndex("temperature")];
+        }
+        return reactor2.temperature();
+    }
+
+    //! Central difference approximations of the derivatives of the temperature at
+    //! *tf* with respect to the multipliers of the sensitivity reactions
+    vector<double> temperatureDerivatives() {
+        double eps = 1e-3;
+        vector<double> dTdp(rxns.size());
+        for (size_t j = 0; j < rxns.size(); j++) {
+            dTdp[j] = (solveT(rxns[j], 1 + eps) - solveT(rxns[j], 1 - eps)) / (2 * eps);
+        }
+        return dTdp;
+    }
+
+    void checkNear(const vector<double>& sens, const vector<double>& ref,
+                   double rtol) {
+        ASSERT_EQ(sens.size(), ref.size());
+        double smax = 0.0;
+        for (double r : ref) {
+            smax = std::max(smax, std::abs(r));
+        }
+        ASSERT_GT(smax, 0.0);
+        for (size_t j = 0; j < ref.size(); j++) {
+            EXPECT_NEAR(sens[j], ref[j], rtol * smax) << "parameter " << j;
+        }
+    }
+
+    string X0 = "H2:2.0, O2:1.0, AR:7.0";
+    double T0 = 1200.0;
+    double tf = 1e-4;
+    vector<size_t> rxns = {0, 1, 2, 9};
+    shared_ptr<Solution> sol;
+    unique_ptr<IdealGasReactor> reactor;
+    ReactorNet net;
+};
+
+TEST_F(ReactorSensitivityTest, reactor_net)
+{
+    AdjointSensitivity adjoint(net);
+    EXPECT_THROW(adjoint.setCheckpointInterval(0), CanteraError);
+    EXPECT_THROW(adjoint.solve({}), CanteraError);
+    adjoint.setCheckpointInterval(10);
+    adjoint.integrate(tf);
+    EXPECT_DOUBLE_EQ(net.time(), tf);
+    EXPECT_TRUE(net.forwardSensitivities());
+    double Tf = reactor->temperature();
+    vector<double> sens = adjoint.sensitivities("temperature");
+    EXPECT_TRUE(net.forwardSensitivities());
+
+    vector<double> ref = temperatureDerivatives();
+    for (auto& r : ref) {
+        r /= reactor->temperature();
+    }
+    checkNear(sens, ref, 2e-2);
+
+    AnyMap stats = adjoint.stats();
+    EXPECT_GE(stats["checkpoints"].asInt(), 2);
+    EXPECT_GT(stats["forward_steps"].asInt(), 0);
+    EXPECT_GT(stats["backward_steps"].asInt(), 0);
+    EXPECT_THROW(adjoint.solve(vector<double>(net.neq() + 1)), CanteraError);
+
+    // The checkpoints can be reused for further objectives
+    vector<double> sens2 = adjoint.sensitivities("temperature");
+    for (size_t j = 0; j < sens.size(); j++) {
+        EXPECT_NEAR(sens2[j], sens[j], 1e-8 * std::abs(sens[j]));
+    }
+    EXPECT_DOUBLE_EQ(reactor->temperature(), Tf);
+
+    // Advancing further discards the checkpoints
+    net.advance(2 * tf);
+    EXPECT_THROW(adjoint.solve(vector<double>(net.neq())), CanteraError);
+}
+
+TEST_F(ReactorSensitivityTest, event_time)
+{
+    net.setForwardSensitivities(false);
+    AdjointSensitivity adjoint(net);
+    adjoint.integrate(tf);
+    EXPECT_FALSE(net.forwardSensitivities());
+    vector<double> sens = adjoint.eventTimeSensitivities("temperature");
+
+    // Shift of the time where the temperature reaches its value at tf
+    double dTdt;
+    solveT(0, 1.0, &dTdt);
+    ASSERT_GT(dTdt, 0.0);
+    vector<double> ref = temperatureDerivatives();
+    for (auto& r : ref) {
+        r *= -1.0 / (dTdt * tf);
+    }
+    checkNear(sens, ref, 2e-2);
+}
+
+TEST(AdjointSensitivity, parameter_derivatives)
+{
+    // Compare the single-pass evaluation for reaction multipliers and the finite
+    // difference evaluation for enthalpies with central differences
+    vector<string> models = {"Reactor", "IdealGasReactor", "ConstPressureReactor",
+        "IdealGasConstPressureReactor", "MoleReactor", "IdealGasMoleReactor",
+        "ConstPressureMoleReactor", "IdealGasConstPressureMoleReactor"};
+    for (const auto& model : models) {
+        for (bool energy : {true, false}) {
+            auto sol = newSolution("h2o2.yaml", "", "none");
+            sol->thermo()->setState_TPX(1500.0, OneAtm,
+                                        "H2:2.0, O2:1.0, H:0.1, OH:0.1, AR:7.0");
+            auto reactor = std::dynamic_pointer_cast<Reactor>(newReactor(model, sol));
+            reactor->setEnergy(energy);
+            ReactorNet net;
+            net.addReactor(*reactor);
+            for (size_t i : {0, 1, 2, 9, 20}) {
+                reactor->addSensitivityReaction(i);
+            }
+            reactor->addSensitivitySpeciesEnthalpy(sol->thermo()->speciesIndex("OH"));
+            net.initialize();
+
+            size_t nv = net.neq();
+            size_t np = net.m_sens_params.size();
+            vector<double> y(nv), lambda(nv), dfdp(np), ydotp(nv), ydotm(nv);
+            net.getState(y.data());
+            for (size_t i = 0; i < nv; i++) {
+                lambda[i] = (1.0 + 0.1 * i) / (std::abs(y[i]) + 1e-3);
+            }
+            vector<double> p = net.m_sens_params;
+            net.evalSensitivityAdjoint(0.0, y.data(), p.data(), lambda.data(),
+                                       dfdp.data());
+
+            vector<double> ref(np);
+            double rmax = 0.0;
+            for (size_t j = 0; j < np; j++) {
+                double dp = 1e-3 * net.m_paramScales[j];
+                p[j] += dp;
+                net.eval(0.0, y.data(), ydotp.data(), p.data());
+                p[j] -= 2 * dp;
+                net.eval(0.0, y.data(), ydotm.data(), p.data());
+                p[j] += dp;
+                for (size_t i = 0; i < nv; i++) {
+                    ref[j] += lambda[i] * (ydotp[i] - ydotm[i]) / (2 * dp);
+                }
+                rmax = std::max(rmax, std::abs(ref[j]));
+            }
+            ASSERT_GT(rmax, 0.0);
+            for (size_t j = 0; j < np; j++) {
+                EXPECT_NEAR(dfdp[j], ref[j], 1e-5 * rmax)
+                    << model << ", energy = " << energy << ", parameter " << j;
+            }
+        }
+    }
+}
+
+TEST_F(ReactorSensitivityTest, brute_force)
+{
+    ReactorNetSensitivity sens(sol);
+    EXPECT_THROW(sens.compute(), CanteraError);
+    sens.addIgnitionDelay();
+    sens.addComponent("temperature");
+    EXPECT_THROW(sens.addComponent("temperature"), CanteraError);
+    EXPECT_THROW(sens.compute(), CanteraError);
+    sens.setEndTime(tf);
+    sens.setPerturbation(0.05);
+    sens.setReactions(rxns);
+    sens.setMaxThreads(2);
+    auto arr = sens.compute();
+    ASSERT_EQ(arr->size(), static_cast<int>(rxns.size()));
+    auto index = arr->getComponent("reaction-index").asVector<long int>();
+    auto equations = arr->getComponent("equation").asVector<string>();
+    EXPECT_EQ(equations[1], sol->kinetics()->reaction(index[1])->equation());
+    EXPECT_GT(sens.baseValues()[0], 0.0);
+    EXPECT_EQ(arr->meta()["failed-runs"].asInt(), 0);
+
+    // Forward differences with the same perturbation
+    double Tbase = solveT(0, 1.0);
+    EXPECT_NEAR(sens.baseValues()[1], Tbase, 1e-4 * Tbase);
+    vector<double> ref;
+    for (size_t i : rxns) {
+        ref.push_back((solveT(i, 1.05) - Tbase) / (Tbase * 0.05));
+    }
+    checkNear(arr->getComponent("temperature").asVector<double>(), ref, 1e-2);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_zeroD.cpp\n");